@@ -17,6 +17,9 @@
  *
  */
 #include "src/st7789.h"
+#if defined(ST7789_HAL_SPIDEV)
+  #include <stdlib.h>
+#endif
 
 /** @var Screen definition */
 extern struct S_SCREEN Screen;
@@ -33,13 +36,30 @@ int main (void)
   uint16_t i;
   // LCD - init struct
   // ----------------------------------------------------------
+#if defined(ST7789_HAL_SPIDEV)
+  struct signal cs = { .line = HAL_SPIDEV_CS };                           // Chip Select of spidev
+  struct signal bl = { .chip = "/dev/gpiochip0", .line = 18 };            // Back Light
+  struct signal rs = { .chip = "/dev/gpiochip0", .line = 27 };            // Reset
+  struct signal dc = { .chip = "/dev/gpiochip0", .line = 25 };            // Data / Command
+  const char * device = getenv ("ST7789_SPIDEV");                         // default /dev/spidev0.0
+#else
   struct signal cs = { .ddr = &DDRB, .port = &PORTB, .pin = 2 };          // Chip Select
   struct signal bl = { .ddr = &DDRB, .port = &PORTB, .pin = 1 };          // Back Light
   struct signal rs = { .ddr = &DDRB, .port = &PORTB, .pin = 0 };          // Reset
   struct signal dc = { .ddr = &DDRD, .port = &PORTD, .pin = 7 };          // Data / Command
+#endif
 
   struct st7789 lcd = { .cs = &cs, .bl = &bl, .dc = &dc, .rs = &rs };     // LCD struct
 
+#if !defined(__AVR__) && (!defined(ST7789_HAL_SPIDEV) || defined(ST7789_SPIDEV_MOCK))
+  HAL_Mock_Panel (&cs, &dc);                                              // host, panel model
+#endif
+#if defined(ST7789_HAL_SPIDEV)
+  if (HAL_Spidev_Open (device ? device : "/dev/spidev0.0", 32000000) != ST77XX_SUCCESS) {
+    return 1;
+  }
+#endif
+
   // LCD INIT
   // ----------------------------------------------------------
   ST7789_Init (&lcd, ST77XX_ROTATE_270 | ST77XX_RGB);
@@ -59,7 +79,19 @@ int main (void)
   ST7789_SetPosition (75, 5);
   ST7789_DrawString (&lcd, "ST7789V2 DRIVER", WHITE, X3);
 
+#if defined(ST7789_FRAMEBUFFER)
+  ST7789_Flush (&lcd);                                                    // frame to panel
+#endif
+#if !defined(__AVR__) && (!defined(ST7789_HAL_SPIDEV) || defined(ST7789_SPIDEV_MOCK))
+  HAL_Mock_Dump ("main.ppm");                                             // host, GRAM to file
+#endif
+
   // EXIT
   // ----------------------------------------------------------
+#if defined(ST7789_HAL_SPIDEV)
+  HAL_Wait ();                                                            // collected bytes out
+  return HAL_Spidev_Errors () ? 1 : 0;                                    // failed ioctls
+#else
   return 0;
+#endif
 }
\ No newline at end of file
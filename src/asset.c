@@ -0,0 +1,248 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 External Assets
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        asset.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      asset.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "asset.h"
+
+/** @var View definition, st7789.c */
+extern struct S_VIEW View;
+
+/** @struct Stream position in asset store, context of stream read */
+struct S_ASSET_CURSOR {
+  const struct S_ASSETS * assets;                       // store
+  uint32_t address;                                     // next byte
+};
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/* Flash read command & 24 bit address, flash selected */
+static void ST7789_Flash_Address (struct S_FLASH * flash, uint32_t address)
+{
+  HAL_Pin_Clear (flash->cs);                            // chip enable - active low
+  HAL_Transfer (FLASH_READ);                            // command
+  HAL_Transfer ((uint8_t) (address >> 16));             // address
+  HAL_Transfer ((uint8_t) (address >> 8));
+  HAL_Transfer ((uint8_t) address);
+}
+
+/* Stream read callback over asset store */
+static uint8_t ST7789_Asset_Next (void * context, uint8_t * buffer, uint8_t length)
+{
+  struct S_ASSET_CURSOR * cursor = context;
+
+  length = cursor->assets->read (cursor->assets->context, cursor->address, buffer, length);
+  cursor->address += length;
+
+  return length;
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Read callback of SPI NOR flash
+ *
+ * @param   void * context
+ * @param   uint32_t address
+ * @param   uint8_t * buffer
+ * @param   uint8_t length
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Flash_Read (void * context, uint32_t address, uint8_t * buffer, uint8_t length)
+{
+  struct S_FLASH * flash = context;
+  uint8_t count = length;
+
+  ST7789_Flash_Address (flash, address);
+  while (count--) {
+    *buffer++ = HAL_Transfer (FLASH_DUMMY);             // data out
+  }
+  HAL_Pin_Set (flash->cs);                              // chip disable - idle high
+
+  return length;
+}
+
+/**
+ * @desc    Draw image from SPI NOR flash
+ *
+ *          Read command is sent with panel idle, then panel is selected
+ *          as well: clock k writes byte k-1 to panel while flash shifts
+ *          out byte k. Panel gets the window & RAMWR before, the
+ *          visible part of every row is one flash read.
+ *
+ * @param   struct st7789 *
+ * @param   struct S_FLASH *
+ * @param   uint32_t address of image
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Flash_Image (struct st7789 * lcd, struct S_FLASH * flash, uint32_t address, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
+{
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;           // signed positions
+  int16_t left, top;
+  uint16_t width, rows;
+  uint32_t count;
+  uint8_t data;
+  ST7789_STATS_API (STATS_ASSET);
+
+  ST7789_Order (&x1, &x2);                              // image starts at top left corner
+  ST7789_Order (&y1, &y2);
+  left = x1;
+  top = y1;
+  width = x2 - x1 + 1;                                  // image stride
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // nothing visible
+  }
+  address += ((uint32_t) (y1 - top - View.originY) * width + (x1 - left - View.originX)) << 1;
+  rows = y2 - y1 + 1;
+  count = (uint32_t) (x2 - x1 + 1) << 1;                // visible bytes of row
+  if ((uint16_t) (x2 - x1 + 1) == width) {
+    count *= rows;                                      // no columns clipped, one read
+    rows = 1;
+  }
+
+  ST7789_Write_Begin (lcd, x1, x2, y1, y2);             // one window, RAMWR
+  ST7789_Write_End (lcd);                               // panel idle, data mode kept
+  while (rows--) {
+    ST7789_Flash_Address (flash, address);
+    data = HAL_Transfer (FLASH_DUMMY);                  // first byte, panel idle
+    ST7789_Batch_Begin (lcd);                           // both selected
+    while (--count) {
+      data = HAL_Transfer (data);                       // write k-1, read k
+    }
+    HAL_Pin_Set (flash->cs);                            // flash idle
+    HAL_Transfer (data);                                // last byte to panel only
+    ST7789_Batch_End (lcd);                             // chip disable - idle high
+    count = (uint32_t) (x2 - x1 + 1) << 1;
+    address += (uint32_t) width << 1;                   // next row
+  }
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Draw image from asset store
+ *
+ * @param   struct st7789 *
+ * @param   const struct S_ASSETS *
+ * @param   uint32_t address of image
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Asset_Image (struct st7789 * lcd, const struct S_ASSETS * assets, uint32_t address, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
+{
+  uint8_t chunk[ST7789_ASSET_CHUNK];
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;           // signed positions
+  int16_t left, top;
+  uint16_t width, rows, count;
+  uint32_t next;
+  uint8_t length;
+  ST7789_STATS_API (STATS_ASSET);
+
+  ST7789_Order (&x1, &x2);                              // image starts at top left corner
+  ST7789_Order (&y1, &y2);
+  left = x1;
+  top = y1;
+  width = x2 - x1 + 1;                                  // image stride
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // nothing visible
+  }
+  address += ((uint32_t) (y1 - top - View.originY) * width + (x1 - left - View.originX)) << 1;
+  rows = y2 - y1 + 1;
+
+  ST7789_Write_Begin (lcd, x1, x2, y1, y2);             // one window, RAMWR
+  while (rows--) {
+    next = address;
+    count = (x2 - x1 + 1) << 1;                         // visible bytes of row
+    while (count) {
+      length = (count > ST7789_ASSET_CHUNK) ? ST7789_ASSET_CHUNK : count;
+      ST7789_Batch_End (lcd);                           // store may share the bus
+      if (assets->read (assets->context, next, chunk, length) != length) {
+        return ST77XX_ERROR;                            // store failed
+      }
+      ST7789_Batch_Begin (lcd);
+      HAL_Write (chunk, length);                        // burst
+      next += length;
+      count -= length;
+    }
+    address += (uint32_t) width << 1;                   // next row
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Run command stream from asset store
+ *
+ * @param   struct st7789 *
+ * @param   const struct S_ASSETS *
+ * @param   uint32_t address of stream
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Asset_Stream (struct st7789 * lcd, const struct S_ASSETS * assets, uint32_t address)
+{
+  struct S_ASSET_CURSOR cursor = { assets, address };
+  struct S_STREAM stream;
+  ST7789_STATS_API (STATS_ASSET);
+
+  stream.read = ST7789_Asset_Next;
+  stream.context = &cursor;
+
+  return ST7789_Stream_Run (lcd, &stream);
+}
+
+#if !defined(__AVR__)
+
+/**
+ * @desc    Read callback of file standing in for flash on host
+ *
+ * @param   void * context
+ * @param   uint32_t address
+ * @param   uint8_t * buffer
+ * @param   uint8_t length
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_File_Read (void * context, uint32_t address, uint8_t * buffer, uint8_t length)
+{
+  FILE * file = context;
+
+  if (fseek (file, address, SEEK_SET) != 0) {
+    return 0;                                           // out of file
+  }
+  return (uint8_t) fread (buffer, 1, length, file);
+}
+
+#endif
@@ -0,0 +1,123 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 External Assets
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        asset.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      st7789.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Images (RGB565, big endian, row by row from top left corner,
+ *              corners of rectangle in any order) & command streams kept in
+ *              external memory on the display SPI bus
+ *
+ *              SPI NOR flash: panel & flash selected together, every byte read
+ *              from flash is written to panel by the next clock, one bus byte
+ *              per pixel byte, 5 bytes overhead per image row read
+ *
+ *              Other stores (SD card, file on host): read callback fills chunks
+ *              of ST7789_ASSET_CHUNK bytes, display released during read
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __ASSET_H__
+#define __ASSET_H__
+
+  #include "st7789.h"
+
+  // SPI NOR flash commands
+  // -----------------------------------
+  #define FLASH_READ            0x03                    // Read Data, 24 bit address follows
+  #define FLASH_DUMMY           0xFF                    // clock for data out
+
+  #define ST7789_ASSET_CHUNK    32                      // bytes read by callback at once
+
+  /** @struct Asset store, read callback & its context */
+  struct S_ASSETS {
+    uint8_t (*read) (void *, uint32_t, uint8_t *, uint8_t); // read n bytes at address, return count
+    void * context;                                     // flash, file, ...
+  };
+
+  /** @struct SPI NOR flash on display bus */
+  struct S_FLASH {
+    struct signal * cs;                                 // Chip Select
+  };
+
+  /**
+   * @desc    Read callback of SPI NOR flash, context = struct S_FLASH *
+   *
+   * @param   void * context
+   * @param   uint32_t address
+   * @param   uint8_t * buffer
+   * @param   uint8_t length
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Flash_Read (void *, uint32_t, uint8_t *, uint8_t);
+
+  /**
+   * @desc    Draw image from SPI NOR flash, flash data passed through to panel
+   *
+   * @param   struct st7789 *
+   * @param   struct S_FLASH *
+   * @param   uint32_t address of image
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Flash_Image (struct st7789 *, struct S_FLASH *, uint32_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Draw image from asset store, chunks through RAM
+   *
+   * @param   struct st7789 *
+   * @param   const struct S_ASSETS *
+   * @param   uint32_t address of image
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Asset_Image (struct st7789 *, const struct S_ASSETS *, uint32_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Run command stream from asset store (tools/scr2stream.py --binary)
+   *
+   * @param   struct st7789 *
+   * @param   const struct S_ASSETS *
+   * @param   uint32_t address of stream
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Asset_Stream (struct st7789 *, const struct S_ASSETS *, uint32_t);
+
+#if !defined(__AVR__)
+
+  #include <stdio.h>
+
+  /**
+   * @desc    Read callback of file standing in for flash on host, context = FILE *
+   *
+   * @param   void * context
+   * @param   uint32_t address
+   * @param   uint8_t * buffer
+   * @param   uint8_t length
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_File_Read (void *, uint32_t, uint8_t *, uint8_t);
+
+#endif
+
+#endif
@@ -0,0 +1,363 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Display List
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        dlist.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      dlist.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "dlist.h"
+
+/** @var View definition, st7789.c */
+extern struct S_VIEW View;
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/* Next byte of list */
+static inline uint8_t ST7789_List_Byte (const uint8_t ** list, uint8_t memory)
+{
+  if (memory == LIST_PROGMEM) {
+    return pgm_read_byte ((*list)++);
+  }
+  return *(*list)++;
+}
+
+/* Next word of list, big endian */
+static uint16_t ST7789_List_Word (const uint8_t ** list, uint8_t memory)
+{
+  uint16_t word = ST7789_List_Byte (list, memory) << 8;
+
+  return word | ST7789_List_Byte (list, memory);
+}
+
+/* Start record of given length, 32 bit sum no wrap, closing LIST_OP_END kept free */
+static uint8_t ST7789_List_Open (struct S_LIST * list, uint8_t op, uint32_t length)
+{
+  if ((uint32_t) list->length + length + 1 > list->size) {
+    return ST77XX_ERROR;                                // buffer full
+  }
+  list->buffer[list->length++] = op;
+
+  return ST77XX_SUCCESS;
+}
+
+/* Append word, big endian */
+static void ST7789_List_Put (struct S_LIST * list, uint16_t word)
+{
+  list->buffer[list->length++] = (uint8_t) (word >> 8);
+  list->buffer[list->length++] = (uint8_t) word;
+}
+
+/* Close list */
+static uint8_t ST7789_List_Close (struct S_LIST * list)
+{
+  list->buffer[list->length] = LIST_OP_END;
+
+  return ST77XX_SUCCESS;
+}
+
+/* Record of five words: fill & line */
+static uint8_t ST7789_List_Rect (struct S_LIST * list, uint8_t op, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint16_t color)
+{
+  if (ST7789_List_Open (list, op, 11) == ST77XX_ERROR) {
+    return ST77XX_ERROR;
+  }
+  ST7789_List_Put (list, xs);
+  ST7789_List_Put (list, xe);
+  ST7789_List_Put (list, ys);
+  ST7789_List_Put (list, ye);
+  ST7789_List_Put (list, color);
+
+  return ST7789_List_Close (list);
+}
+
+/* Record of four words: horizontal & vertical line */
+static uint8_t ST7789_List_Run (struct S_LIST * list, uint8_t op, uint16_t a, uint16_t b, uint16_t c, uint16_t color)
+{
+  if (ST7789_List_Open (list, op, 9) == ST77XX_ERROR) {
+    return ST77XX_ERROR;
+  }
+  ST7789_List_Put (list, a);
+  ST7789_List_Put (list, b);
+  ST7789_List_Put (list, c);
+  ST7789_List_Put (list, color);
+
+  return ST7789_List_Close (list);
+}
+
+/* Solid rectangle in view coordinates, chip select held by caller */
+static void ST7789_List_Solid (struct st7789 * lcd, int16_t xs, int16_t xe, int16_t ys, int16_t ye, uint16_t color)
+{
+  if (ST7789_Clip_Rect (&xs, &xe, &ys, &ye) == ST77XX_SUCCESS) {
+    ST7789_Fill_Window (lcd, xs, xe, ys, ye, color);    // cached CASET / RASET & pixels
+  }
+}
+
+/* Image in view coordinates, pixels outside clip skipped, chip select held by caller */
+static void ST7789_List_Image (struct st7789 * lcd, const uint8_t ** list, uint8_t memory, int16_t xs, int16_t xe, int16_t ys, int16_t ye)
+{
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;
+  uint16_t width = xe - xs + 1;
+  int16_t x, y;
+  uint8_t high;
+
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    *list += (uint32_t) width * (ye - ys + 1) * 2;      // nothing visible
+    return;
+  }
+  xs += View.originX;                                   // view to screen coordinates
+  ys += View.originY;
+  ye += View.originY;
+  ST7789_Write_Window (lcd, x1, x2, y1, y2);
+
+  for (y = ys; y <= ye; y++) {
+    if ((y < y1) || (y > y2)) {
+      *list += width * 2;                               // row out of clip
+      continue;
+    }
+    for (x = 0; x < width; x++) {
+      high = ST7789_List_Byte (list, memory);
+      if ((xs + x >= x1) && (xs + x <= x2)) {
+        ST7789_WRITE (high);                            // transfer High Byte
+        ST7789_WRITE (ST7789_List_Byte (list, memory)); // transfer low Byte
+      } else {
+        (*list)++;                                      // column out of clip
+      }
+    }
+  }
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Empty display list
+ *
+ * @param   struct S_LIST *
+ *
+ * @return  void
+ */
+void ST7789_List_Clear (struct S_LIST * list)
+{
+  list->length = 0;
+  list->buffer[0] = LIST_OP_END;
+}
+
+/**
+ * @desc    Record rectangle fill
+ *
+ * @param   struct S_LIST *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_List_Fill (struct S_LIST * list, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint16_t color)
+{
+  return ST7789_List_Rect (list, LIST_OP_FILL, xs, xe, ys, ye, color);
+}
+
+/**
+ * @desc    Record horizontal line
+ *
+ * @param   struct S_LIST *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t y - position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_List_HLine (struct S_LIST * list, uint16_t xs, uint16_t xe, uint16_t y, uint16_t color)
+{
+  return ST7789_List_Run (list, LIST_OP_HLINE, xs, xe, y, color);
+}
+
+/**
+ * @desc    Record vertical line
+ *
+ * @param   struct S_LIST *
+ * @param   uint16_t x - position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_List_VLine (struct S_LIST * list, uint16_t x, uint16_t ys, uint16_t ye, uint16_t color)
+{
+  return ST7789_List_Run (list, LIST_OP_VLINE, x, ys, ye, color);
+}
+
+/**
+ * @desc    Record line
+ *
+ * @param   struct S_LIST *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_List_Line (struct S_LIST * list, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint16_t color)
+{
+  return ST7789_List_Rect (list, LIST_OP_LINE, xs, xe, ys, ye, color);
+}
+
+/**
+ * @desc    Record opaque text
+ *
+ * @param   struct S_LIST *
+ * @param   uint16_t x - position
+ * @param   uint16_t y - position
+ * @param   uint16_t foreground
+ * @param   uint16_t background
+ * @param   uint8_t font index
+ * @param   char * string
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_List_Text (struct S_LIST * list, uint16_t x, uint16_t y, uint16_t fg, uint16_t bg, uint8_t font, char * str)
+{
+  uint16_t length = 0;
+
+  while (str[length]) {
+    length++;
+  }
+  if (ST7789_List_Open (list, LIST_OP_TEXT, 10 + length + 1) == ST77XX_ERROR) {
+    return ST77XX_ERROR;
+  }
+  ST7789_List_Put (list, x);
+  ST7789_List_Put (list, y);
+  ST7789_List_Put (list, fg);
+  ST7789_List_Put (list, bg);
+  list->buffer[list->length++] = font;
+  do {
+    list->buffer[list->length++] = *str;                // string incl. terminator
+  } while (*str++);
+
+  return ST7789_List_Close (list);
+}
+
+/**
+ * @desc    Record image
+ *
+ * @param   struct S_LIST *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   const uint16_t * pixels in RAM
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_List_Blit (struct S_LIST * list, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, const uint16_t * pixels)
+{
+  uint32_t count = (uint32_t) ((int16_t) xe - (int16_t) xs + 1) * ((int16_t) ye - (int16_t) ys + 1);
+
+  if (((int16_t) xs > (int16_t) xe) || ((int16_t) ys > (int16_t) ye) || (count > 0x7FFF) ||
+      (ST7789_List_Open (list, LIST_OP_BLIT, 9 + (count << 1)) == ST77XX_ERROR)) {
+    return ST77XX_ERROR;
+  }
+  ST7789_List_Put (list, xs);
+  ST7789_List_Put (list, xe);
+  ST7789_List_Put (list, ys);
+  ST7789_List_Put (list, ye);
+  while (count--) {
+    ST7789_List_Put (list, *pixels++);
+  }
+
+  return ST7789_List_Close (list);
+}
+
+/**
+ * @desc    Replay display list
+ *
+ *          Chip select stays active for the whole list, fills & lines
+ *          go through cached window (CASET / RASET only sent when
+ *          changed). Line & text records use drawing functions which
+ *          release chip select, batch is restarted after them.
+ *
+ * @param   struct st7789 *
+ * @param   const uint8_t * list
+ * @param   uint8_t LIST_RAM / LIST_PROGMEM
+ * @param   const struct S_FONT * const * font table
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_List_Play (struct st7789 * lcd, const uint8_t * list, uint8_t memory, const struct S_FONT * const * fonts)
+{
+  uint16_t xs, xe, ys, ye, fg, bg;
+  uint8_t op, font;
+  char character;
+  ST7789_STATS_API (STATS_LIST);
+
+  ST7789_Batch_Begin (lcd);                             // chip enable - active low
+
+  while ((op = ST7789_List_Byte (&list, memory)) != LIST_OP_END) {
+    xs = ST7789_List_Word (&list, memory);
+    xe = ST7789_List_Word (&list, memory);
+    ys = ST7789_List_Word (&list, memory);
+    switch (op) {
+      case LIST_OP_FILL:
+        ye = ST7789_List_Word (&list, memory);
+        ST7789_List_Solid (lcd, xs, xe, ys, ye, ST7789_List_Word (&list, memory));
+        break;
+      case LIST_OP_HLINE:
+        ST7789_List_Solid (lcd, xs, xe, ys, ys, ST7789_List_Word (&list, memory));
+        break;
+      case LIST_OP_VLINE:
+        ST7789_List_Solid (lcd, xs, xs, xe, ys, ST7789_List_Word (&list, memory));
+        break;
+      case LIST_OP_LINE:
+        ye = ST7789_List_Word (&list, memory);
+        ST7789_DrawLine (lcd, xs, xe, ys, ye, ST7789_List_Word (&list, memory));
+        ST7789_Batch_Begin (lcd);                       // released by line
+        break;
+      case LIST_OP_TEXT:
+        fg = ys;                                        // x, y, fg already read
+        bg = ST7789_List_Word (&list, memory);
+        font = ST7789_List_Byte (&list, memory);
+        ST7789_SetPosition (xs, xe);
+        while ((character = ST7789_List_Byte (&list, memory)) != 0) {
+          if (fonts) {
+            ST7789_Text_DrawChar (lcd, fonts[font], character, fg, bg);
+          }
+        }
+        ST7789_Batch_Begin (lcd);                       // released by text
+        break;
+      case LIST_OP_BLIT:
+        ye = ST7789_List_Word (&list, memory);
+        ST7789_List_Image (lcd, &list, memory, xs, xe, ys, ye);
+        break;
+      default:
+        ST7789_Batch_End (lcd);                         // chip disable - idle high
+        return ST77XX_ERROR;                            // unknown record
+    }
+  }
+  ST7789_Batch_End (lcd);                               // chip disable - idle high
+
+  return ST77XX_SUCCESS;
+}
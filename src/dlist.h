@@ -0,0 +1,181 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Display List
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        dlist.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      st7789.h, text.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Compact binary list of drawing operations, recorded at runtime
+ *              into RAM or written into PROGMEM with the LIST_* macros, replayed
+ *              by one call with chip select held and windows cached
+ *
+ *              Record = opcode + arguments, words big endian, list ends with
+ *              LIST_OP_END:
+ *
+ *                FILL    xs xe ys ye color
+ *                HLINE   xs xe y color
+ *                VLINE   x ys ye color
+ *                LINE    xs xe ys ye color
+ *                TEXT    x y fg bg font string 0x00  (font = index into font table)
+ *                BLIT    xs xe ys ye pixels          (RGB565, row by row)
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __DLIST_H__
+#define __DLIST_H__
+
+  #include "st7789.h"
+  #include "text.h"
+
+  // Opcodes
+  // -----------------------------------
+  #define LIST_OP_END           0x00
+  #define LIST_OP_FILL          0x01
+  #define LIST_OP_HLINE         0x02
+  #define LIST_OP_VLINE         0x03
+  #define LIST_OP_LINE          0x04
+  #define LIST_OP_TEXT          0x05
+  #define LIST_OP_BLIT          0x06
+
+  // Memory of list
+  // -----------------------------------
+  #define LIST_RAM              0x00
+  #define LIST_PROGMEM          0x01
+
+  // Records for lists written in source
+  // -----------------------------------
+  #define LIST_WORD(w)          (uint8_t) ((w) >> 8), (uint8_t) (w)
+  #define LIST_FILL(xs, xe, ys, ye, color) \
+    LIST_OP_FILL, LIST_WORD (xs), LIST_WORD (xe), LIST_WORD (ys), LIST_WORD (ye), LIST_WORD (color)
+  #define LIST_HLINE(xs, xe, y, color) \
+    LIST_OP_HLINE, LIST_WORD (xs), LIST_WORD (xe), LIST_WORD (y), LIST_WORD (color)
+  #define LIST_VLINE(x, ys, ye, color) \
+    LIST_OP_VLINE, LIST_WORD (x), LIST_WORD (ys), LIST_WORD (ye), LIST_WORD (color)
+  #define LIST_LINE(xs, xe, ys, ye, color) \
+    LIST_OP_LINE, LIST_WORD (xs), LIST_WORD (xe), LIST_WORD (ys), LIST_WORD (ye), LIST_WORD (color)
+  #define LIST_TEXT(x, y, fg, bg, font) \
+    LIST_OP_TEXT, LIST_WORD (x), LIST_WORD (y), LIST_WORD (fg), LIST_WORD (bg), (font)
+  #define LIST_BLIT(xs, xe, ys, ye) \
+    LIST_OP_BLIT, LIST_WORD (xs), LIST_WORD (xe), LIST_WORD (ys), LIST_WORD (ye)
+  #define LIST_END              LIST_OP_END
+
+  /** @struct Display list in RAM */
+  struct S_LIST {
+    uint8_t * buffer;                                   // records
+    uint16_t size;                                      // size of buffer in bytes
+    uint16_t length;                                    // used bytes without closing LIST_OP_END
+  };
+
+  /**
+   * @desc    Empty display list
+   *
+   * @param   struct S_LIST *
+   *
+   * @return  void
+   */
+  void ST7789_List_Clear (struct S_LIST *);
+
+  /**
+   * @desc    Record rectangle fill
+   *
+   * @param   struct S_LIST *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_List_Fill (struct S_LIST *, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Record horizontal line
+   *
+   * @param   struct S_LIST *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t y - position
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_List_HLine (struct S_LIST *, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Record vertical line
+   *
+   * @param   struct S_LIST *
+   * @param   uint16_t x - position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_List_VLine (struct S_LIST *, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Record line
+   *
+   * @param   struct S_LIST *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_List_Line (struct S_LIST *, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Record opaque text
+   *
+   * @param   struct S_LIST *
+   * @param   uint16_t x - position
+   * @param   uint16_t y - position
+   * @param   uint16_t foreground
+   * @param   uint16_t background
+   * @param   uint8_t font index
+   * @param   char * string
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_List_Text (struct S_LIST *, uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, char *);
+
+  /**
+   * @desc    Record image, pixels copied into list
+   *
+   * @param   struct S_LIST *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   const uint16_t * pixels in RAM
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_List_Blit (struct S_LIST *, uint16_t, uint16_t, uint16_t, uint16_t, const uint16_t *);
+
+  /**
+   * @desc    Replay display list
+   *
+   * @param   struct st7789 *
+   * @param   const uint8_t * list
+   * @param   uint8_t LIST_RAM / LIST_PROGMEM
+   * @param   const struct S_FONT * const * font table, NULL = no text
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_List_Play (struct st7789 *, const uint8_t *, uint8_t, const struct S_FONT * const *);
+
+#endif
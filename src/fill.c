@@ -0,0 +1,314 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Gradient & Pattern Fills
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        fill.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      fill.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "fill.h"
+
+/** @var View definition, st7789.c */
+extern struct S_VIEW View;
+
+// Checker board, mode of ST7789_Fill_Periodic next to STRIPES_*
+// -----------------------------------
+#define FILL_CHECKER            0x03
+
+/** @struct Color ramp, 8.8 fixed point, steps wrap modulo 2^16 */
+struct S_RAMP {
+  uint16_t r, g, b;                                     // 8.8 channel value
+  uint16_t dr, dg, db;                                  // 8.8 step, two's complement
+};
+
+/** @array 8x8 patterns */
+const uint8_t PATTERN_DOTS[8] PROGMEM = { 0x80, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00 };
+const uint8_t PATTERN_GRID[8] PROGMEM = { 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 };
+const uint8_t PATTERN_HATCH[8] PROGMEM = { 0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81 };
+const uint8_t PATTERN_BRICK[8] PROGMEM = { 0xFF, 0x80, 0x80, 0x80, 0xFF, 0x08, 0x08, 0x08 };
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/* 8.8 step of channel at bit shift over steps */
+static uint16_t ST7789_Ramp_Step (uint32_t from, uint32_t to, uint8_t shift, uint16_t steps)
+{
+  int16_t delta = (int16_t) ((to >> shift) & 0xFF) - (int16_t) ((from >> shift) & 0xFF);
+
+  return steps ? (uint16_t) ((int32_t) delta * 256 / steps) : 0;
+}
+
+/* Ramp of steps + 1 colors, advanced by skip steps of clipped part */
+static void ST7789_Ramp_Init (struct S_RAMP * ramp, uint32_t from, uint32_t to, uint16_t steps, uint16_t skip)
+{
+  ramp->dr = ST7789_Ramp_Step (from, to, 16, steps);
+  ramp->dg = ST7789_Ramp_Step (from, to, 8, steps);
+  ramp->db = ST7789_Ramp_Step (from, to, 0, steps);
+  // step truncated toward zero & half level added, last color never overshoots
+  ramp->r = ((uint16_t) (from >> 8) & 0xFF00) + 0x80 + (uint16_t) ((uint32_t) ramp->dr * skip);
+  ramp->g = ((uint16_t) from & 0xFF00) + 0x80 + (uint16_t) ((uint32_t) ramp->dg * skip);
+  ramp->b = ((uint16_t) (from << 8)) + 0x80 + (uint16_t) ((uint32_t) ramp->db * skip);
+}
+
+/* Next color of ramp */
+static inline void ST7789_Ramp_Next (struct S_RAMP * ramp)
+{
+  ramp->r += ramp->dr;
+  ramp->g += ramp->dg;
+  ramp->b += ramp->db;
+}
+
+/* Color of ramp truncated to RGB565 */
+static inline uint16_t ST7789_Ramp_565 (const struct S_RAMP * ramp)
+{
+  return (ramp->r & 0xF800) | ((ramp->g >> 5) & 0x07E0) | (ramp->b >> 11);
+}
+
+/* Color of ramp dithered to RGB565 at screen position */
+static inline uint16_t ST7789_Ramp_Dither (const struct S_RAMP * ramp, int16_t x, int16_t y)
+{
+  return ST7789_Pixel_Dither_565 (ramp->r >> 8, ramp->g >> 8, ramp->b >> 8, ST7789_BAYER (x, y));
+}
+
+/* Row of alternating runs of size, phase 0 .. 2 x size - 1 of first pixel */
+static void ST7789_Fill_Runs (uint16_t phase, uint8_t size, uint16_t width, uint16_t fg, uint16_t bg)
+{
+  uint16_t color = (phase < size) ? fg : bg;
+  uint16_t run = size - ((phase < size) ? phase : phase - size);
+
+  while (width) {
+    if (run > width) {
+      run = width;                                      // end of row
+    }
+    HAL_Write_Repeat (color, run);                      // run of one color
+    width -= run;
+    run = size;
+    color ^= fg ^ bg;                                   // other color
+  }
+}
+
+/* Stripes or checker board in one window */
+static uint8_t ST7789_Fill_Periodic (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint8_t size, uint8_t mode, uint16_t fg, uint16_t bg)
+{
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;           // signed positions
+  int16_t left, top, y;
+  uint16_t width, period, column, row;
+
+  ST7789_Order (&x1, &x2);
+  ST7789_Order (&y1, &y2);
+  left = x1 + View.originX;                             // anchor on screen
+  top = y1 + View.originY;
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // nothing visible
+  }
+  if (size == 0) {
+    size = 1;
+  }
+  width = x2 - x1 + 1;
+  period = (uint16_t) size << 1;                        // foreground & background
+  column = (uint16_t) (x1 - left) % period;
+  row = (uint16_t) (y1 - top) % period;
+
+  ST7789_Write_Begin (lcd, x1, x2, y1, y2);             // one window
+  for (y = y1; y <= y2; y++) {
+    if (mode == STRIPES_HORIZONTAL) {
+      HAL_Write_Repeat ((row < size) ? fg : bg, width); // row of one color
+    } else if (mode == STRIPES_VERTICAL) {
+      ST7789_Fill_Runs (column, size, width, fg, bg);
+    } else if (mode == STRIPES_DIAGONAL) {
+      ST7789_Fill_Runs ((column + row) % period, size, width, fg, bg);
+    } else {
+      ST7789_Fill_Runs ((row < size) ? column : (column + size) % period, size, width, fg, bg);
+    }
+    if (++row == period) {
+      row = 0;
+    }
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Fill rectangle by linear gradient
+ *
+ * @param   struct st7789 *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint32_t color of first column / row, RGB888
+ * @param   uint32_t color of last column / row, RGB888
+ * @param   uint8_t GRADIENT_HORIZONTAL / GRADIENT_VERTICAL [| GRADIENT_DITHER]
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_FillGradient (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint32_t from, uint32_t to, uint8_t mode)
+{
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;           // signed positions
+  int16_t left, top, x, y;
+  uint16_t width, height, color[4];                     // dithered row of vertical gradient
+  uint8_t i;
+  struct S_RAMP line, ramp;
+  ST7789_STATS_API (STATS_FILL);
+
+  ST7789_Order (&x1, &x2);
+  ST7789_Order (&y1, &y2);
+  width = x2 - x1;                                      // steps of ramp
+  height = y2 - y1;
+  left = x1 + View.originX;                             // anchor on screen
+  top = y1 + View.originY;
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // nothing visible
+  }
+
+  ST7789_Write_Begin (lcd, x1, x2, y1, y2);             // one window
+  if (mode & GRADIENT_VERTICAL) {
+    ST7789_Ramp_Init (&ramp, from, to, height, y1 - top);
+    for (y = y1; y <= y2; y++) {
+      if (mode & GRADIENT_DITHER) {
+        for (i = 0; i < 4; i++) {
+          color[i] = ST7789_Ramp_Dither (&ramp, i, y);  // row repeats after 4 columns
+        }
+        for (x = x1; x <= x2; x++) {
+          ST7789_WRITE_565 (color[x & 3]);
+        }
+      } else {
+        HAL_Write_Repeat (ST7789_Ramp_565 (&ramp), x2 - x1 + 1);
+      }
+      ST7789_Ramp_Next (&ramp);                         // next row
+    }
+  } else {
+    ST7789_Ramp_Init (&line, from, to, width, x1 - left);
+    for (y = y1; y <= y2; y++) {
+      ramp = line;                                      // first visible column
+      if (mode & GRADIENT_DITHER) {
+        for (x = x1; x <= x2; x++) {
+          ST7789_WRITE_565 (ST7789_Ramp_Dither (&ramp, x, y));
+          ST7789_Ramp_Next (&ramp);
+        }
+      } else {
+        for (x = x1; x <= x2; x++) {
+          ST7789_WRITE_565 (ST7789_Ramp_565 (&ramp));
+          ST7789_Ramp_Next (&ramp);
+        }
+      }
+    }
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Fill rectangle by checker board, top left cell foreground
+ *
+ * @param   struct st7789 *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint8_t size of cell
+ * @param   uint16_t foreground color
+ * @param   uint16_t background color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_FillChecker (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint8_t size, uint16_t fg, uint16_t bg)
+{
+  ST7789_STATS_API (STATS_FILL);
+  return ST7789_Fill_Periodic (lcd, xs, xe, ys, ye, size, FILL_CHECKER, fg, bg);
+}
+
+/**
+ * @desc    Fill rectangle by stripes, foreground first
+ *
+ * @param   struct st7789 *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint8_t width of stripe
+ * @param   uint8_t STRIPES_HORIZONTAL / STRIPES_VERTICAL / STRIPES_DIAGONAL
+ * @param   uint16_t foreground color
+ * @param   uint16_t background color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_FillStripes (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint8_t width, uint8_t mode, uint16_t fg, uint16_t bg)
+{
+  ST7789_STATS_API (STATS_FILL);
+  if (mode > STRIPES_DIAGONAL) {
+    return ST77XX_ERROR;                                // unknown mode
+  }
+  return ST7789_Fill_Periodic (lcd, xs, xe, ys, ye, width, mode, fg, bg);
+}
+
+/**
+ * @desc    Fill rectangle by repeated 8x8 1 bpp pattern
+ *
+ * @param   struct st7789 *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   const uint8_t * pattern, 8 bytes in PROGMEM, set bit = foreground
+ * @param   uint16_t foreground color
+ * @param   uint16_t background color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_FillPattern (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, const uint8_t * pattern, uint16_t fg, uint16_t bg)
+{
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;           // signed positions
+  int16_t left, top, x, y;
+  uint8_t bits, mask, first, row;
+  ST7789_STATS_API (STATS_FILL);
+
+  ST7789_Order (&x1, &x2);
+  ST7789_Order (&y1, &y2);
+  left = x1 + View.originX;                             // anchor on screen
+  top = y1 + View.originY;
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // nothing visible
+  }
+  first = 0x80 >> ((x1 - left) & 0x07);
+  row = (y1 - top) & 0x07;
+
+  ST7789_Write_Begin (lcd, x1, x2, y1, y2);             // one window
+  for (y = y1; y <= y2; y++) {
+    bits = pgm_read_byte (&pattern[row]);
+    row = (row + 1) & 0x07;
+    if ((bits == 0x00) || (bits == 0xFF)) {
+      HAL_Write_Repeat (bits ? fg : bg, x2 - x1 + 1);   // row of one color
+      continue;
+    }
+    mask = first;
+    for (x = x1; x <= x2; x++) {
+      ST7789_WRITE_565 ((bits & mask) ? fg : bg);
+      mask = (mask >> 1) | (mask << 7);                 // rotate, 8 columns
+    }
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+
+  return ST77XX_SUCCESS;
+}
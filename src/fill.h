@@ -0,0 +1,123 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Gradient & Pattern Fills
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        fill.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      st7789.h, pixel.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Backgrounds generated while streaming, one window & RAMWR per fill,
+ *              nothing stored in flash or RAM
+ *
+ *              Gradients step channels in 8.8 fixed point, per column (horizontal)
+ *              or per row (vertical), end colors RGB888 for optional 4x4 ordered
+ *              dither. Rows of one color and pattern runs go out as repeats of
+ *              one value, like ST7789_Send_Color_565.
+ *
+ *              Gradients & patterns are anchored at the top left corner of the
+ *              rectangle, corners may come in any order, clipped parts do not
+ *              shift them. Dither uses screen position, so
+ *              neighbouring gradients match.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __FILL_H__
+#define __FILL_H__
+
+  #include "st7789.h"
+  #include "pixel.h"
+
+  // Gradient mode
+  // -----------------------------------
+  #define GRADIENT_HORIZONTAL   0x00                    // color changes left to right
+  #define GRADIENT_VERTICAL     0x01                    // color changes top to bottom
+  #define GRADIENT_DITHER       0x02                    // ordered dither, or-ed with direction
+
+  // Stripes mode
+  // -----------------------------------
+  #define STRIPES_HORIZONTAL    0x00                    // rows of width
+  #define STRIPES_VERTICAL      0x01                    // columns of width
+  #define STRIPES_DIAGONAL      0x02                    // 45 degrees, width measured along row
+
+  // RGB888 end color of gradient
+  #define RGB888(r, g, b)       (((uint32_t) (r) << 16) | ((uint16_t) (g) << 8) | (b))
+
+  /** @array 8x8 patterns, bit 7 of byte 0 = top left, fill.c */
+  extern const uint8_t PATTERN_DOTS[8] PROGMEM;
+  extern const uint8_t PATTERN_GRID[8] PROGMEM;
+  extern const uint8_t PATTERN_HATCH[8] PROGMEM;
+  extern const uint8_t PATTERN_BRICK[8] PROGMEM;
+
+  /**
+   * @desc    Fill rectangle by linear gradient
+   *
+   * @param   struct st7789 *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint32_t color of first column / row, RGB888
+   * @param   uint32_t color of last column / row, RGB888
+   * @param   uint8_t GRADIENT_HORIZONTAL / GRADIENT_VERTICAL [| GRADIENT_DITHER]
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_FillGradient (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t, uint32_t, uint32_t, uint8_t);
+
+  /**
+   * @desc    Fill rectangle by checker board, top left cell foreground
+   *
+   * @param   struct st7789 *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint8_t size of cell
+   * @param   uint16_t foreground color
+   * @param   uint16_t background color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_FillChecker (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Fill rectangle by stripes, foreground first
+   *
+   * @param   struct st7789 *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint8_t width of stripe
+   * @param   uint8_t STRIPES_HORIZONTAL / STRIPES_VERTICAL / STRIPES_DIAGONAL
+   * @param   uint16_t foreground color
+   * @param   uint16_t background color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_FillStripes (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Fill rectangle by repeated 8x8 1 bpp pattern
+   *
+   * @param   struct st7789 *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   const uint8_t * pattern, 8 bytes in PROGMEM, set bit = foreground
+   * @param   uint16_t foreground color
+   * @param   uint16_t background color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_FillPattern (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t, const uint8_t *, uint16_t, uint16_t);
+
+#endif
@@ -13,7 +13,7 @@
  * @depend      
  * ---------------------------------------------------------------+
  */
-#include <avr/pgmspace.h>
+#include "hal.h"
 
 #ifndef __FONT_H__
 #define __FONT_H__
@@ -25,4 +25,23 @@
   // @const Characters
   extern const uint8_t FONTS[][CHARS_COLS_LENGTH];
 
+  /** @struct Proportional font, all arrays in PROGMEM */
+  struct S_FONT {
+    uint8_t height;                       // glyph height in pixels
+    uint8_t first;                        // first character
+    uint8_t last;                         // last character
+    uint8_t spacing;                      // blank columns after glyph
+    uint8_t bpp;                          // bits per pixel, 1 or coverage 2 / 4
+    const uint8_t * widths;               // glyph widths
+    const uint16_t * offsets;             // glyph offsets into bitmap
+    const uint8_t * bitmap;               // glyph rows, MSB first, byte aligned glyphs
+  };
+
+  // @const Proportional fonts, src/fonts/
+  extern const struct S_FONT FONT_8;
+  extern const struct S_FONT FONT_16;
+  extern const struct S_FONT FONT_24;
+  extern const struct S_FONT FONT_16_AA;
+  extern const struct S_FONT FONT_24_AA;
+
 #endif
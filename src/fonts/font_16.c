@@ -0,0 +1,157 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       FONT_16 16px proportional font, 1 bpp
+ * ---------------------------------------------------------------+ 
+ * @file        font_16.c
+ * @source      src/font.c
+ *
+ * @notes       generated by tools/bdf2font.py, do not edit
+ *              flash 1985 bytes
+ * ---------------------------------------------------------------+
+ */
+#include "../font.h"
+
+/** @array Glyph widths */
+static const uint8_t FONT_16_WIDTHS[] PROGMEM = {
+  4, 10, 6, 10, 10, 10, 10, 4, 6, 6, 10, 10, 4, 10, 4, 10,
+  10, 6, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 8, 10, 8, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 10, 6, 10, 10,
+  6, 10, 10, 10, 10, 10, 10, 10, 10, 6, 8, 8, 6, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 2, 6, 10,
+};
+
+/** @array Glyph offsets into bitmap */
+static const uint16_t FONT_16_OFFSETS[] PROGMEM = {
+  0, 8, 28, 40, 60, 80, 100, 120, 128, 140, 152, 172,
+  192, 200, 220, 228, 248, 268, 280, 300, 320, 340, 360, 380,
+  400, 420, 440, 448, 456, 472, 492, 508, 528, 548, 568, 588,
+  608, 628, 648, 668, 688, 708, 720, 740, 760, 780, 800, 820,
+  840, 860, 880, 900, 920, 940, 960, 980, 1000, 1020, 1040, 1060,
+  1072, 1092, 1104, 1124, 1144, 1156, 1176, 1196, 1216, 1236, 1256, 1276,
+  1296, 1316, 1328, 1344, 1360, 1372, 1392, 1412, 1432, 1452, 1472, 1492,
+  1512, 1532, 1552, 1572, 1592, 1612, 1632, 1652, 1664, 1668, 1680,
+};
+
+/** @array Glyph bitmap, row by row, MSB first, 1 bpp */
+static const uint8_t FONT_16_BITMAP[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xfc, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc0, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0xcf, 0xcf, 0x3c, 0xf3, 0xcf,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc3, 0x31, 0xce, 0xff, 0xff, 0xf3,
+  0x30, 0xcc, 0xff, 0xff, 0xf7, 0x38, 0xcc, 0x33, 0x0c, 0xc0, 0x00, 0x00, 0x0c, 0x07, 0x83, 0xfd,
+  0xff, 0xcc, 0x33, 0x07, 0xf0, 0xfe, 0x0c, 0xc3, 0x3f, 0xfb, 0xfc, 0x1e, 0x03, 0x00, 0x00, 0x00,
+  0x60, 0x3c, 0x0f, 0x0d, 0x87, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x1b, 0x0f, 0x03,
+  0xc0, 0x60, 0x00, 0x00, 0x3c, 0x1f, 0x8e, 0x33, 0x0c, 0xce, 0x33, 0x03, 0x00, 0xc0, 0xcc, 0xf3,
+  0x3c, 0x33, 0x8c, 0x7c, 0xcf, 0x30, 0x00, 0x00, 0xef, 0x33, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x73, 0x9c, 0xe3, 0x0c, 0x30, 0xc3, 0x87, 0x0e, 0x1c, 0x30, 0x00, 0xc3, 0x87, 0x0e, 0x1c,
+  0x30, 0xc3, 0x0c, 0x73, 0x9c, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0xcc, 0xf3, 0x33,
+  0xf0, 0xfc, 0xcc, 0xf3, 0x30, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+  0x30, 0x0c, 0x07, 0x8f, 0xff, 0xff, 0x1e, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xef, 0x33, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c,
+  0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x0f, 0x03, 0xc3, 0xf1, 0xfc,
+  0xcf, 0x33, 0xf8, 0xfc, 0x3c, 0x0f, 0x07, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0x31, 0xcf, 0x3c, 0x70,
+  0xc3, 0x0c, 0x30, 0xc3, 0x1e, 0xff, 0xf0, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0x00, 0xc0, 0x70,
+  0x38, 0x1c, 0x0e, 0x07, 0x03, 0x01, 0xc0, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x38,
+  0x0c, 0x0c, 0x03, 0x00, 0x70, 0x0e, 0x01, 0xc0, 0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00,
+  0x03, 0x01, 0xc0, 0xf0, 0x7c, 0x33, 0x1c, 0xcc, 0x33, 0x1e, 0xff, 0xdf, 0xf0, 0x78, 0x0c, 0x03,
+  0x00, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xfc, 0x03, 0x00, 0xff, 0x1f, 0xe0, 0x1c, 0x03, 0x00, 0xc0,
+  0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0x0f, 0x07, 0xc3, 0x81, 0xc0, 0xc0, 0x30, 0x0f,
+  0xf3, 0xfe, 0xe1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0xff, 0xbf, 0xf0, 0x0c,
+  0x03, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00,
+  0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x73, 0xf0, 0xfc, 0xe1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f,
+  0x8f, 0xc0, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x77, 0xfc, 0xff, 0x00, 0xc0,
+  0x30, 0x38, 0x1c, 0x3e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf6, 0x00, 0x6f, 0xf6, 0x00, 0x00,
+  0x00, 0x6f, 0xf6, 0x00, 0xef, 0x33, 0xec, 0x00, 0x03, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xc0, 0xc0,
+  0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x70, 0x38,
+  0x1c, 0x0e, 0x03, 0x03, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xc0, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f,
+  0x03, 0x00, 0xc0, 0x70, 0x38, 0x1c, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00,
+  0x3f, 0x1f, 0xee, 0x1f, 0x03, 0x00, 0xc0, 0x33, 0x8d, 0xf3, 0xcc, 0xf3, 0x3c, 0xcf, 0x33, 0x7f,
+  0x8f, 0xc0, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x87, 0xff, 0xff,
+  0xfe, 0x1f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00, 0x7f, 0x3f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x7f,
+  0xf3, 0xfc, 0xe1, 0xf0, 0x3c, 0x0f, 0x87, 0xff, 0x9f, 0xc0, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f,
+  0x03, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00,
+  0x7c, 0x3f, 0x8e, 0x73, 0x0e, 0xc1, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x7c, 0x3b, 0x9c, 0xfe,
+  0x1f, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x03, 0x00, 0xc0, 0x38, 0x0f, 0xf3, 0xfc, 0xe0, 0x30,
+  0x0c, 0x03, 0x80, 0xff, 0xdf, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xfe, 0x03, 0x00, 0xc0, 0x38, 0x0f,
+  0xf3, 0xfc, 0xe0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f,
+  0x03, 0xc0, 0x30, 0x0c, 0xfb, 0x3f, 0xc1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0xcf, 0xe0, 0x00, 0x00,
+  0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf8, 0x7f, 0xff, 0xff, 0xe1, 0xf0, 0x3c, 0x0f, 0x03, 0xc0,
+  0xf0, 0x30, 0x00, 0x00, 0xff, 0xf7, 0x8c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x1e, 0xff, 0xf0, 0x00,
+  0x0f, 0xc3, 0xf0, 0x78, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xcc, 0x33, 0x9c, 0x7e,
+  0x0f, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x7c, 0x3b, 0x1c, 0xce, 0x33, 0x0f, 0x03, 0xc0, 0xcc, 0x33,
+  0x8c, 0x73, 0x0e, 0xc1, 0xf0, 0x30, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
+  0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x80, 0xff, 0xdf, 0xf0, 0x00, 0x00, 0xc0, 0xf8, 0x7f, 0x3f,
+  0xcf, 0xcc, 0xf3, 0x3c, 0xcf, 0x33, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00,
+  0xc0, 0xf0, 0x3c, 0x0f, 0x83, 0xf0, 0xfe, 0x3c, 0xcf, 0x33, 0xc7, 0xf0, 0xfc, 0x1f, 0x03, 0xc0,
+  0xf0, 0x30, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0,
+  0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0x7f, 0x3f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x7f,
+  0xfb, 0xfc, 0xe0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f,
+  0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xcc, 0xf3, 0x3c, 0x33, 0x8c, 0x7c, 0xcf, 0x30, 0x00, 0x00,
+  0x7f, 0x3f, 0xee, 0x1f, 0x03, 0xc0, 0xf8, 0x7f, 0xfb, 0xfc, 0xcc, 0x33, 0x0c, 0x73, 0x0e, 0xc1,
+  0xf0, 0x30, 0x00, 0x00, 0x3f, 0xdf, 0xfe, 0x03, 0x00, 0xc0, 0x38, 0x07, 0xf0, 0xfe, 0x01, 0xc0,
+  0x30, 0x0c, 0x07, 0xff, 0xbf, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xf1, 0xe0, 0x30, 0x0c, 0x03, 0x00,
+  0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f,
+  0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00,
+  0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf8, 0x77, 0x38, 0xcc, 0x1e,
+  0x03, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0xcf, 0x33, 0xcc, 0xf3,
+  0x3c, 0xcf, 0x33, 0x73, 0x8c, 0xc0, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x87, 0x73, 0x8c, 0xc0,
+  0xc0, 0x30, 0x33, 0x1c, 0xee, 0x1f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f,
+  0x03, 0xc0, 0xf8, 0x77, 0x38, 0xcc, 0x1e, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00,
+  0xff, 0xbf, 0xf0, 0x0c, 0x03, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0c, 0x03, 0x00, 0xff,
+  0xdf, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x38, 0xfd, 0xf0, 0x00,
+  0x00, 0x00, 0x0c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfb, 0xf1, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc7, 0xff, 0xe0, 0x00,
+  0x0c, 0x07, 0x83, 0x31, 0xce, 0xe1, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xc3, 0x87, 0x0e, 0x1c, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0f, 0xe0, 0x0c, 0x03, 0x3f, 0xdf,
+  0xfc, 0x0f, 0x03, 0x7f, 0xcf, 0xe0, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xcf, 0x33, 0xef,
+  0x9f, 0xc3, 0xe0, 0xf0, 0x3c, 0x0f, 0x87, 0xff, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0x1f, 0xce, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00,
+  0x00, 0xc0, 0x30, 0x0c, 0x03, 0x3c, 0xdf, 0x3e, 0x7f, 0x0f, 0xc1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f,
+  0xcf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xec, 0x0f, 0x03, 0xff, 0xff,
+  0xec, 0x03, 0x00, 0x7f, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0x07, 0xe3, 0x9c, 0xc3, 0x30, 0x1e, 0x0f,
+  0xc3, 0xf0, 0x78, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf9,
+  0xff, 0xe1, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0xcf, 0xf0, 0x0c, 0x03, 0x3f, 0x8f, 0xc0, 0x00, 0x00,
+  0xc0, 0x30, 0x0c, 0x03, 0x00, 0xcf, 0x33, 0xef, 0x9f, 0xc3, 0xe0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0,
+  0xf0, 0x30, 0x00, 0x00, 0x30, 0xc0, 0x00, 0xe3, 0xc7, 0x0c, 0x30, 0xc3, 0x1e, 0xff, 0xf0, 0x00,
+  0x03, 0x03, 0x00, 0x00, 0x0e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0xc3, 0xe7, 0x7e, 0x3c, 0x00, 0x00,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc7, 0xce, 0xcc, 0xf0, 0xf0, 0xcc, 0xce, 0xc7, 0xc3, 0x00, 0x00,
+  0xe3, 0xc7, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x1e, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x73, 0x3c, 0xec, 0xcf, 0x33, 0xcc, 0xf3, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x33, 0xef, 0x9f, 0xc3, 0xe0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0,
+  0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0, 0xf0,
+  0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3f, 0xec,
+  0x0f, 0x03, 0xff, 0xbf, 0xce, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0x9f, 0xfc, 0x0f, 0x03, 0x7f, 0xcf, 0xf0, 0x1c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x33, 0xef, 0x9f, 0xc3, 0xe0, 0x30, 0x0c, 0x03, 0x00, 0xc0,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0xcc, 0x03, 0x00, 0x7f, 0x0f,
+  0xe0, 0x0c, 0x03, 0xff, 0xbf, 0xc0, 0x00, 0x00, 0x30, 0x0c, 0x03, 0x01, 0xe0, 0xfc, 0x3f, 0x07,
+  0x80, 0xc0, 0x30, 0x0c, 0x03, 0x0c, 0xe7, 0x1f, 0x83, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x7c, 0x3f, 0x9f, 0x7c, 0xcf, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf8, 0x77, 0x38, 0xcc, 0x1e,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xcc, 0xf3,
+  0x3c, 0xcf, 0x33, 0x73, 0x8c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0x77,
+  0x38, 0xcc, 0x0c, 0x03, 0x03, 0x31, 0xce, 0xe1, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0xcf, 0xf0, 0x0c, 0x03, 0x3f, 0x8f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x38, 0x0c, 0x0e, 0x07, 0x03, 0x01, 0xc0, 0xff,
+  0xff, 0xf0, 0x00, 0x00, 0x0c, 0x73, 0x8c, 0x31, 0xcc, 0x30, 0x70, 0xc3, 0x0e, 0x1c, 0x30, 0x00,
+  0xff, 0xff, 0xff, 0xf0, 0xc3, 0x87, 0x0c, 0x30, 0xe0, 0xc3, 0x38, 0xc3, 0x1c, 0xe3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcd, 0xf3, 0xe7, 0xb0, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+
+/** @const Font */
+const struct S_FONT FONT_16 PROGMEM = {
+  .height = 16,
+  .first = 0x20,
+  .last = 0x7e,
+  .spacing = 2,
+  .bpp = 1,
+  .widths = FONT_16_WIDTHS,
+  .offsets = FONT_16_OFFSETS,
+  .bitmap = FONT_16_BITMAP
+};
@@ -0,0 +1,263 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       FONT_16_AA 16px proportional font, 2 bpp
+ * ---------------------------------------------------------------+ 
+ * @file        font_16_aa.c
+ * @source      src/font.c
+ *
+ * @notes       generated by tools/bdf2font.py, do not edit
+ *              flash 3685 bytes
+ * ---------------------------------------------------------------+
+ */
+#include "../font.h"
+
+/** @array Glyph widths */
+static const uint8_t FONT_16_AA_WIDTHS[] PROGMEM = {
+  4, 10, 6, 10, 10, 10, 10, 4, 6, 6, 10, 10, 4, 10, 4, 10,
+  10, 6, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 8, 10, 8, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 10, 6, 10, 10,
+  6, 10, 10, 10, 10, 10, 10, 10, 10, 6, 8, 8, 6, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 2, 6, 10,
+};
+
+/** @array Glyph offsets into bitmap */
+static const uint16_t FONT_16_AA_OFFSETS[] PROGMEM = {
+  0, 16, 56, 80, 120, 160, 200, 240, 256, 280, 304, 344,
+  384, 400, 440, 456, 496, 536, 560, 600, 640, 680, 720, 760,
+  800, 840, 880, 896, 912, 944, 984, 1016, 1056, 1096, 1136, 1176,
+  1216, 1256, 1296, 1336, 1376, 1416, 1440, 1480, 1520, 1560, 1600, 1640,
+  1680, 1720, 1760, 1800, 1840, 1880, 1920, 1960, 2000, 2040, 2080, 2120,
+  2144, 2184, 2208, 2248, 2288, 2312, 2352, 2392, 2432, 2472, 2512, 2552,
+  2592, 2632, 2656, 2688, 2720, 2744, 2784, 2824, 2864, 2904, 2944, 2984,
+  3024, 3064, 3104, 3144, 3184, 3224, 3264, 3304, 3328, 3336, 3360,
+};
+
+/** @array Glyph bitmap, row by row, MSB first, 2 bpp */
+static const uint8_t FONT_16_AA_BITMAP[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbe, 0x0b, 0xeb, 0xe0, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbe, 0x0b, 0xeb, 0xe0, 0xbe, 0xa0, 0xaf, 0x0f, 0xf0, 0xff, 0x0f, 0xf0, 0xfa,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x0a, 0x00, 0xf0, 0xf0, 0x1f, 0x0f, 0x46, 0xf5, 0xf9, 0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x1f,
+  0x5f, 0x41, 0xf5, 0xf4, 0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x6f, 0x5f, 0x91, 0xf0, 0xf4, 0x0f, 0x0f,
+  0x00, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa4, 0x00, 0x6f, 0x90, 0x1b, 0xff, 0xe6,
+  0xff, 0xfe, 0xb5, 0xf4, 0x0b, 0x5f, 0x40, 0x6f, 0xfe, 0x41, 0xbf, 0xf9, 0x01, 0xf5, 0xe0, 0x1f,
+  0x5e, 0xbf, 0xff, 0x9b, 0xff, 0xe4, 0x06, 0xf9, 0x00, 0x1a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x00, 0x0b, 0xe0, 0x00, 0xbe, 0x01, 0xa6, 0x90, 0x6e, 0x00, 0x1b, 0x90, 0x06, 0xe4, 0x01,
+  0xb9, 0x00, 0x6e, 0x40, 0x1b, 0x90, 0x06, 0xe4, 0x00, 0xb9, 0x06, 0x9a, 0x40, 0xbe, 0x00, 0x0b,
+  0xe0, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xe4, 0x06, 0xff, 0x90, 0xb9, 0x1e, 0x0f,
+  0x41, 0xe0, 0xf0, 0xb9, 0x0a, 0x5a, 0x40, 0x1a, 0x40, 0x01, 0xa4, 0x00, 0xa5, 0xa0, 0xaf, 0x0a,
+  0x5a, 0xf4, 0x1a, 0x4b, 0x91, 0xa4, 0x6f, 0xe5, 0xa1, 0xbe, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb9, 0xbe, 0x1f, 0x1e, 0xb9, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xa0, 0x6e, 0x1b, 0x96, 0xe4, 0xb9, 0x0f, 0x40, 0xf0, 0x0f, 0x00, 0xf4, 0x0b, 0x90, 0x6e,
+  0x41, 0xb9, 0x06, 0xe0, 0x1a, 0x00, 0x00, 0x00, 0xa4, 0x0b, 0x90, 0x6e, 0x41, 0xb9, 0x06, 0xe0,
+  0x1f, 0x00, 0xf0, 0x0f, 0x01, 0xf0, 0x6e, 0x1b, 0x96, 0xe4, 0xb9, 0x0a, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x0f, 0x00, 0xa0, 0xf0, 0xaa, 0x5f, 0x5a, 0x1b,
+  0xfe, 0x41, 0xbf, 0xe4, 0xa5, 0xf5, 0xaa, 0x0f, 0x0a, 0x00, 0xf0, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00,
+  0x0f, 0x00, 0x01, 0xf4, 0x00, 0x6f, 0x90, 0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x06, 0xf9, 0x00, 0x1f,
+  0x40, 0x00, 0xf0, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xbe, 0x1f, 0x1e, 0xb9, 0xa4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xff, 0xeb, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x69, 0xbe, 0xbe, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa0,
+  0x00, 0x6e, 0x00, 0x1b, 0x90, 0x06, 0xe4, 0x01, 0xb9, 0x00, 0x6e, 0x40, 0x1b, 0x90, 0x06, 0xe4,
+  0x00, 0xb9, 0x00, 0x0a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x01, 0xef, 0x40, 0x1f, 0xf0, 0x1b, 0xff, 0x06, 0xff, 0xf0,
+  0xb5, 0xff, 0x5e, 0x0f, 0xff, 0x90, 0xff, 0xe4, 0x0f, 0xf4, 0x01, 0xfb, 0x40, 0x6e, 0x6f, 0xff,
+  0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x06, 0xf0, 0xbf, 0x0b, 0xf0, 0x6f, 0x01,
+  0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x1f, 0x46, 0xf9, 0xbf, 0xeb, 0xfe, 0x00, 0x00, 0x00,
+  0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xea, 0x40, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x6e, 0x00,
+  0x1b, 0x90, 0x06, 0xe4, 0x01, 0xb9, 0x00, 0x6e, 0x40, 0x1b, 0x40, 0x06, 0xf4, 0x00, 0xbf, 0xff,
+  0xeb, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x00, 0x1f, 0x90,
+  0x01, 0xa4, 0x00, 0xa4, 0x00, 0x0b, 0x40, 0x00, 0x6e, 0x40, 0x01, 0xb9, 0x00, 0x06, 0xe0, 0x00,
+  0x1f, 0xa4, 0x01, 0xfb, 0x90, 0x6e, 0x6f, 0xff, 0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1a, 0x00, 0x06, 0xf0, 0x01, 0xbf, 0x00, 0x6f, 0xf0, 0x1b, 0x5f, 0x06, 0xe0, 0xf0, 0xb4,
+  0x1f, 0x4f, 0x46, 0xf9, 0xbf, 0xff, 0xe6, 0xff, 0xfe, 0x00, 0x6f, 0x90, 0x01, 0xf4, 0x00, 0x0f,
+  0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xeb, 0xff, 0xfe, 0xf4, 0x00, 0x0f,
+  0x40, 0x00, 0xbf, 0xfe, 0x46, 0xff, 0xf9, 0x00, 0x06, 0xe0, 0x00, 0x1f, 0x00, 0x00, 0xf0, 0x00,
+  0x0f, 0xa4, 0x01, 0xfb, 0x90, 0x6e, 0x6f, 0xff, 0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xbe, 0x00, 0x6f, 0xe0, 0x1b, 0x90, 0x06, 0xe4, 0x00, 0xb4, 0x00, 0x0f, 0x40, 0x00, 0xff,
+  0xfe, 0x4f, 0xff, 0xf9, 0xf9, 0x06, 0xef, 0x40, 0x1f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6f, 0xff,
+  0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x9b, 0xff, 0xfe, 0x00, 0x01, 0xf0,
+  0x00, 0x1e, 0x00, 0x1b, 0x90, 0x06, 0xe4, 0x01, 0xb9, 0x00, 0x6e, 0x40, 0x0b, 0x90, 0x00, 0xf4,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xef, 0x40, 0x1f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x1f,
+  0xff, 0x41, 0xff, 0xf4, 0xb9, 0x06, 0xef, 0x40, 0x1f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6f, 0xff,
+  0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xef,
+  0x40, 0x1f, 0xf4, 0x01, 0xfb, 0x90, 0x6f, 0x6f, 0xff, 0xf1, 0xbf, 0xff, 0x00, 0x01, 0xf0, 0x00,
+  0x1e, 0x00, 0x1b, 0x90, 0x06, 0xe4, 0x0b, 0xf9, 0x00, 0xbe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x69, 0xbe, 0xbe, 0x69, 0x00, 0x00, 0x69, 0xbe, 0xbe, 0x69, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x69, 0xbe, 0xbe, 0x69, 0x00, 0x00, 0xb9, 0xbe, 0x1f, 0x1e, 0xb9, 0xa4, 0x00, 0x00,
+  0x00, 0x1a, 0x00, 0x6e, 0x01, 0xb9, 0x06, 0xe4, 0x1b, 0x90, 0x6e, 0x40, 0xb4, 0x00, 0xb4, 0x00,
+  0x6e, 0x40, 0x1b, 0x90, 0x06, 0xe4, 0x01, 0xb9, 0x00, 0x6e, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xb9, 0x00, 0x6e, 0x40, 0x1b, 0x90,
+  0x06, 0xe4, 0x01, 0xb9, 0x00, 0x1e, 0x00, 0x1e, 0x01, 0xb9, 0x06, 0xe4, 0x1b, 0x90, 0x6e, 0x40,
+  0xb9, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xea,
+  0x40, 0x1f, 0x00, 0x01, 0xf0, 0x00, 0x6e, 0x00, 0x1b, 0x90, 0x06, 0xe4, 0x00, 0xb9, 0x00, 0x0a,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xea, 0x40, 0x1f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x1b,
+  0x90, 0xf6, 0xfe, 0x0f, 0xb5, 0xf0, 0xff, 0x0f, 0x0f, 0xf0, 0xf0, 0xfb, 0x5f, 0x5e, 0x6f, 0xff,
+  0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xef,
+  0x40, 0x1f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf4, 0x01, 0xff, 0x90, 0x6f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xf9, 0x06, 0xff, 0x40, 0x1f, 0xf0, 0x00, 0xfa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xfe, 0x4b, 0xff, 0xf9, 0xf9, 0x06, 0xef, 0x40, 0x1f, 0xf4, 0x01, 0xff, 0x90, 0x6e, 0xff,
+  0xff, 0x4f, 0xff, 0xf4, 0xf9, 0x06, 0xef, 0x40, 0x1f, 0xf4, 0x01, 0xff, 0x90, 0x6e, 0xbf, 0xff,
+  0x96, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xef,
+  0x40, 0x1a, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+  0x00, 0xf4, 0x01, 0xab, 0x90, 0x6e, 0x6f, 0xff, 0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xe4, 0x0b, 0xff, 0x90, 0xf9, 0x6e, 0x4f, 0x41, 0xb9, 0xf0, 0x06, 0xef, 0x00, 0x1f, 0xf0,
+  0x00, 0xff, 0x00, 0x0f, 0xf0, 0x01, 0xff, 0x00, 0x6e, 0xf4, 0x1b, 0x9f, 0x96, 0xe4, 0xbf, 0xf9,
+  0x06, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xeb, 0xff, 0xfe, 0xf9, 0x00, 0x0f,
+  0x40, 0x00, 0xf4, 0x00, 0x0f, 0x90, 0x00, 0xff, 0xfe, 0x0f, 0xff, 0xe0, 0xf9, 0x00, 0x0f, 0x40,
+  0x00, 0xf4, 0x00, 0x0f, 0x90, 0x00, 0xbf, 0xff, 0xe6, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xff, 0xeb, 0xff, 0xfe, 0xf9, 0x00, 0x0f, 0x40, 0x00, 0xf4, 0x00, 0x0f, 0x90, 0x00, 0xff,
+  0xfe, 0x0f, 0xff, 0xe0, 0xf9, 0x00, 0x0f, 0x40, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xef,
+  0x40, 0x1a, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0xbf, 0x9f, 0x0b, 0xfe, 0xf0, 0x06, 0xff, 0x00,
+  0x1f, 0xf4, 0x01, 0xfb, 0x90, 0x6f, 0x6f, 0xff, 0xe1, 0xbf, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf4, 0x01, 0xff, 0x90, 0x6f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf9, 0x06, 0xff, 0x40, 0x1f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00,
+  0xfa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xeb, 0xfe, 0x6f, 0x91, 0xf4, 0x0f, 0x00,
+  0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x1f, 0x46, 0xf9, 0xbf, 0xeb, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0xe0, 0x0b, 0xfe, 0x00, 0x6f, 0x90, 0x01, 0xf4, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0xa4, 0x1f, 0x0b, 0x96, 0xe0, 0x6f, 0xf9,
+  0x01, 0xbe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x01, 0xaf, 0x00, 0x6e, 0xf0, 0x1b, 0x9f,
+  0x06, 0xe4, 0xf0, 0xb9, 0x0f, 0x5a, 0x40, 0xfe, 0x40, 0x0f, 0xe4, 0x00, 0xf5, 0xa4, 0x0f, 0x0b,
+  0x90, 0xf0, 0x6e, 0x4f, 0x01, 0xb9, 0xf0, 0x06, 0xea, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf4, 0x00, 0x0f, 0x90, 0x00, 0xbf, 0xff,
+  0xe6, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x01, 0xaf, 0x90, 0x6f, 0xfe, 0x0b, 0xff,
+  0xe5, 0xbf, 0xf5, 0xa5, 0xff, 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0x0a, 0x0f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xfa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf4, 0x00, 0xff, 0x90, 0x0f, 0xfe, 0x40, 0xff, 0xf9, 0x0f, 0xf5,
+  0xe0, 0xff, 0x0b, 0x5f, 0xf0, 0x6f, 0xff, 0x01, 0xbf, 0xf0, 0x06, 0xff, 0x00, 0x1f, 0xf0, 0x00,
+  0xfa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xef,
+  0x40, 0x1f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6f, 0xff, 0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xfe, 0x4b, 0xff, 0xf9, 0xf9, 0x06, 0xef, 0x40, 0x1f, 0xf4, 0x01, 0xff, 0x90, 0x6e, 0xff,
+  0xff, 0x9f, 0xff, 0xe4, 0xf9, 0x00, 0x0f, 0x40, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xef,
+  0x40, 0x1f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0xa0, 0xff, 0x0a,
+  0x5a, 0xf4, 0x1a, 0x4b, 0x91, 0xa4, 0x6f, 0xe5, 0xa1, 0xbe, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xfe, 0x4b, 0xff, 0xf9, 0xf9, 0x06, 0xef, 0x40, 0x1f, 0xf4, 0x01, 0xff, 0x90, 0x6e, 0xff,
+  0xff, 0x9f, 0xff, 0xe4, 0xf5, 0xf4, 0x0f, 0x0b, 0x40, 0xf0, 0x6e, 0x4f, 0x01, 0xb9, 0xf0, 0x06,
+  0xea, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xe6, 0xff, 0xfe, 0xb9, 0x00, 0x0f,
+  0x40, 0x00, 0xf4, 0x00, 0x0b, 0x90, 0x00, 0x6f, 0xfe, 0x41, 0xbf, 0xf9, 0x00, 0x06, 0xe0, 0x00,
+  0x1f, 0x00, 0x01, 0xf0, 0x00, 0x6e, 0xbf, 0xff, 0x9b, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x06, 0xf9, 0x00, 0x1f, 0x40, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00,
+  0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0,
+  0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf0, 0x00, 0xff,
+  0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6f, 0xff, 0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0,
+  0x00, 0xff, 0x00, 0x0f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6e, 0x0b, 0x91, 0xb5, 0xe4, 0x06, 0xf9,
+  0x00, 0x1a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf0, 0x00, 0xff,
+  0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0xa0, 0xff, 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0x0f,
+  0x0f, 0xf0, 0xf0, 0xfb, 0x5a, 0x5e, 0x6e, 0x5b, 0x91, 0xa0, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6e, 0x0b, 0x91, 0xa5, 0xa4, 0x01,
+  0xa4, 0x00, 0x1a, 0x40, 0x1a, 0x5a, 0x46, 0xe0, 0xb9, 0xb9, 0x06, 0xef, 0x40, 0x1f, 0xf0, 0x00,
+  0xfa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf0, 0x00, 0xff,
+  0x00, 0x0f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6e, 0x0b, 0x91, 0xb5, 0xe4, 0x06, 0xf9, 0x00, 0x1f,
+  0x40, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xff, 0x9b, 0xff, 0xfe, 0x00, 0x01, 0xf0, 0x00, 0x1e, 0x00, 0x1b, 0x90, 0x06, 0xe4, 0x01,
+  0xb9, 0x00, 0x6e, 0x40, 0x1b, 0x90, 0x06, 0xe4, 0x00, 0xb4, 0x00, 0x0f, 0x40, 0x00, 0xbf, 0xff,
+  0xe6, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xeb, 0xfe, 0xf9, 0x0f, 0x40, 0xf0, 0x0f,
+  0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf4, 0x0f, 0x90, 0xbf, 0xe6, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x0b, 0x90, 0x00, 0x6e, 0x40, 0x01, 0xb9, 0x00, 0x06,
+  0xe4, 0x00, 0x1b, 0x90, 0x00, 0x6e, 0x40, 0x01, 0xb9, 0x00, 0x06, 0xe0, 0x00, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x9b, 0xfe, 0x06, 0xf0, 0x1f, 0x00, 0xf0,
+  0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x01, 0xf0, 0x6f, 0xbf, 0xeb, 0xf9, 0x00, 0x00, 0x00,
+  0x01, 0xa4, 0x00, 0x6f, 0x90, 0x1b, 0x5e, 0x46, 0xe0, 0xb9, 0xb9, 0x06, 0xea, 0x40, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa4, 0x0b, 0x90, 0x6e, 0x41, 0xb9, 0x06, 0xe0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0xfe, 0x40, 0xbf, 0xf9, 0x00, 0x01, 0xe0, 0x00, 0x1f, 0x1b, 0xff, 0xf6, 0xff,
+  0xff, 0xb4, 0x01, 0xfb, 0x40, 0x1f, 0x6f, 0xff, 0xe1, 0xbf, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0xbe, 0x4f, 0x5f, 0xf9, 0xff,
+  0x96, 0xef, 0xe4, 0x1f, 0xf9, 0x00, 0xff, 0x40, 0x0f, 0xf4, 0x01, 0xff, 0x90, 0x6e, 0xbf, 0xff,
+  0x96, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xfe, 0x06, 0xff, 0xe0, 0xb9, 0x00, 0x0f, 0x40, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+  0x00, 0xf4, 0x01, 0xab, 0x90, 0x6e, 0x6f, 0xff, 0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x1b, 0xe0, 0xf6, 0xff, 0x5f, 0xb9,
+  0x6f, 0xff, 0x41, 0xbf, 0xf0, 0x06, 0xff, 0x00, 0x1f, 0xf4, 0x01, 0xfb, 0x90, 0x6f, 0x6f, 0xff,
+  0xe1, 0xbf, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb4, 0x01, 0xef, 0x40, 0x1f, 0xff, 0xff, 0xef, 0xff,
+  0xf9, 0xf4, 0x00, 0x0b, 0x40, 0x00, 0x6f, 0xfe, 0x01, 0xbf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xbe, 0x40, 0x6f, 0xf9, 0x0b, 0x96, 0xe0, 0xf4, 0x1a, 0x1f, 0x40, 0x06, 0xf9, 0x00, 0xbf,
+  0xe0, 0x0b, 0xfe, 0x00, 0x6f, 0x90, 0x01, 0xf4, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+  0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x96,
+  0xff, 0xfe, 0xb9, 0x06, 0xff, 0x40, 0x1f, 0xf4, 0x01, 0xfb, 0x90, 0x6f, 0x6f, 0xff, 0xf1, 0xbf,
+  0xff, 0x00, 0x01, 0xf0, 0x00, 0x1e, 0x0b, 0xff, 0x90, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0xbe, 0x4f, 0x5f, 0xf9, 0xff,
+  0x96, 0xef, 0xe4, 0x1f, 0xf9, 0x00, 0xff, 0x40, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00,
+  0xfa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xb9, 0x0b,
+  0xe0, 0x6f, 0x01, 0xf0, 0x0f, 0x00, 0xf0, 0x1f, 0x46, 0xf9, 0xbf, 0xeb, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0xbe, 0x00, 0x6f, 0x00, 0x1f,
+  0x00, 0x0f, 0x00, 0x0f, 0xa4, 0x1f, 0xb9, 0x6e, 0x6f, 0xf9, 0x1b, 0xe4, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x1a, 0xf0, 0x6e, 0xf0, 0xb9, 0xf5, 0xa4,
+  0xfe, 0x40, 0xfe, 0x40, 0xf5, 0xa4, 0xf0, 0xb9, 0xf0, 0x6e, 0xa0, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0xb9, 0x0b, 0xe0, 0x6f, 0x01, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x1f,
+  0x46, 0xf9, 0xbf, 0xeb, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6e, 0x0a, 0x4b, 0xe5, 0xb9, 0xf5, 0xa5, 0xef, 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0x0a,
+  0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xfa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xbe, 0x4f, 0x5f, 0xf9, 0xff,
+  0x96, 0xef, 0xe4, 0x1f, 0xf9, 0x00, 0xff, 0x40, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00,
+  0xfa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xfe, 0x46, 0xff, 0xf9, 0xb9, 0x06, 0xef, 0x40, 0x1f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6f, 0xff, 0x91, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xfe, 0x4b, 0xff, 0xf9, 0xf4,
+  0x01, 0xef, 0x40, 0x1e, 0xff, 0xff, 0x9f, 0xff, 0xe4, 0xf9, 0x00, 0x0f, 0x40, 0x00, 0xf0, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xff, 0x96, 0xff, 0xfe, 0xb4, 0x01, 0xfb, 0x40, 0x1f, 0x6f, 0xff, 0xf1, 0xbf,
+  0xff, 0x00, 0x06, 0xf0, 0x00, 0x1f, 0x00, 0x00, 0xf0, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xbe, 0x4f, 0x5f, 0xf9, 0xff,
+  0x96, 0xef, 0xe4, 0x1a, 0xf9, 0x00, 0x0f, 0x40, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xfe, 0x06, 0xff, 0xe0, 0xb4, 0x00, 0x0b, 0x40, 0x00, 0x6f, 0xfe, 0x41, 0xbf,
+  0xf9, 0x00, 0x01, 0xe0, 0x00, 0x1e, 0xbf, 0xff, 0x9b, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0xf0, 0x00, 0x1f, 0x40, 0x06, 0xf9, 0x00, 0xbf, 0xe0, 0x0b, 0xfe, 0x00, 0x6f,
+  0x90, 0x01, 0xf4, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x41, 0xa0, 0xb9, 0x6e, 0x06, 0xff,
+  0x90, 0x1b, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x01, 0xff, 0x00,
+  0x6f, 0xf4, 0x1b, 0xfb, 0x96, 0xff, 0x6f, 0xf5, 0xf1, 0xbe, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf0,
+  0x00, 0xff, 0x00, 0x0f, 0xf4, 0x01, 0xfb, 0x90, 0x6e, 0x6e, 0x0b, 0x91, 0xb5, 0xe4, 0x06, 0xf9,
+  0x00, 0x1a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0xa0, 0xff, 0x0f,
+  0x0f, 0xf0, 0xf0, 0xfb, 0x5a, 0x5e, 0x6e, 0x5b, 0x91, 0xa0, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x01, 0xab, 0x90, 0x6e, 0x6e,
+  0x0b, 0x91, 0xa5, 0xa4, 0x01, 0xa4, 0x00, 0x1a, 0x40, 0x1a, 0x5a, 0x46, 0xe0, 0xb9, 0xb9, 0x06,
+  0xea, 0x40, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa0, 0x00, 0xaf, 0x00, 0x0f, 0xf4, 0x01, 0xfb, 0x90, 0x6f, 0x6f, 0xff, 0xf1, 0xbf,
+  0xff, 0x00, 0x01, 0xf0, 0x00, 0x1e, 0x0b, 0xff, 0x90, 0xbf, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xeb, 0xff, 0xfe, 0x00,
+  0x1f, 0x90, 0x01, 0xe4, 0x01, 0xb9, 0x00, 0x6e, 0x40, 0x1b, 0x40, 0x06, 0xf4, 0x00, 0xbf, 0xff,
+  0xeb, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa0, 0x6e, 0x0b, 0x90, 0xf4, 0x1f, 0x06,
+  0xe0, 0xb4, 0x0b, 0x40, 0x6e, 0x01, 0xf0, 0x0f, 0x40, 0xb9, 0x06, 0xe0, 0x1a, 0x00, 0x00, 0x00,
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0xa4, 0x0b, 0x90, 0x6e, 0x01, 0xf0, 0x0f, 0x40,
+  0xb9, 0x01, 0xe0, 0x1e, 0x0b, 0x90, 0xf4, 0x1f, 0x06, 0xe0, 0xb9, 0x0a, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0xe0, 0xa6, 0xff, 0x5e, 0xb9, 0x6f, 0x9a, 0x41, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+/** @const Font */
+const struct S_FONT FONT_16_AA PROGMEM = {
+  .height = 16,
+  .first = 0x20,
+  .last = 0x7e,
+  .spacing = 2,
+  .bpp = 2,
+  .widths = FONT_16_AA_WIDTHS,
+  .offsets = FONT_16_AA_OFFSETS,
+  .bitmap = FONT_16_AA_BITMAP
+};
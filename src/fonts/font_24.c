@@ -0,0 +1,290 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       FONT_24 24px proportional font, 1 bpp
+ * ---------------------------------------------------------------+ 
+ * @file        font_24.c
+ * @source      src/font.c
+ *
+ * @notes       generated by tools/bdf2font.py, do not edit
+ *              flash 4110 bytes
+ * ---------------------------------------------------------------+
+ */
+#include "../font.h"
+
+/** @array Glyph widths */
+static const uint8_t FONT_24_WIDTHS[] PROGMEM = {
+  6, 15, 9, 15, 15, 15, 15, 6, 9, 9, 15, 15, 6, 15, 6, 15,
+  15, 9, 15, 15, 15, 15, 15, 15, 15, 15, 6, 6, 12, 15, 12, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 9, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 9, 15, 9, 15, 15,
+  9, 15, 15, 15, 15, 15, 15, 15, 15, 9, 12, 12, 9, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 9, 3, 9, 15,
+};
+
+/** @array Glyph offsets into bitmap */
+static const uint16_t FONT_24_OFFSETS[] PROGMEM = {
+  0, 18, 63, 90, 135, 180, 225, 270, 288, 315, 342, 387,
+  432, 450, 495, 513, 558, 603, 630, 675, 720, 765, 810, 855,
+  900, 945, 990, 1008, 1026, 1062, 1107, 1143, 1188, 1233, 1278, 1323,
+  1368, 1413, 1458, 1503, 1548, 1593, 1620, 1665, 1710, 1755, 1800, 1845,
+  1890, 1935, 1980, 2025, 2070, 2115, 2160, 2205, 2250, 2295, 2340, 2385,
+  2412, 2457, 2484, 2529, 2574, 2601, 2646, 2691, 2736, 2781, 2826, 2871,
+  2916, 2961, 2988, 3024, 3060, 3087, 3132, 3177, 3222, 3267, 3312, 3357,
+  3402, 3447, 3492, 3537, 3582, 3627, 3672, 3717, 3744, 3753, 3780,
+};
+
+/** @array Glyph bitmap, row by row, MSB first, 1 bpp */
+static const uint8_t FONT_24_BITMAP[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xfc, 0x7f, 0xf8, 0xff, 0xf1, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x8f, 0xff, 0x1f, 0xfe, 0x3f, 0xe3,
+  0xf1, 0xf8, 0xfc, 0x7e, 0x3f, 0x1f, 0x8f, 0xc7, 0xe3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x38, 0xe0, 0x71, 0xc0,
+  0xe3, 0x83, 0xc7, 0x87, 0x8f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x38, 0xe0, 0x71, 0xc0, 0xe3,
+  0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x3c, 0x3c, 0x78, 0x38, 0xe0, 0x71, 0xc0, 0xe3, 0x81,
+  0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0x00, 0x1f, 0x80, 0xff, 0xf1, 0xff,
+  0xe7, 0xff, 0xf8, 0xe0, 0x71, 0xc0, 0xe3, 0x80, 0x7f, 0xe0, 0x7f, 0xc0, 0xff, 0xc0, 0x38, 0xe0,
+  0x71, 0xc0, 0xe3, 0xff, 0xfc, 0xff, 0xf1, 0xff, 0xe0, 0x3f, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xf0, 0x03, 0xf0, 0x07, 0xe0, 0x77, 0x80, 0xe6, 0x03, 0xc0,
+  0x1e, 0x00, 0x38, 0x00, 0xf0, 0x07, 0x80, 0x0e, 0x00, 0x3c, 0x01, 0xe0, 0x03, 0x80, 0x0f, 0x00,
+  0x78, 0x0c, 0xe0, 0x3d, 0xc0, 0xfc, 0x01, 0xf8, 0x01, 0xe0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x80, 0x3f, 0x00, 0xff, 0x07, 0xc3, 0x8f, 0x07, 0x1c, 0x0e, 0x38, 0xf0, 0x71, 0xc0,
+  0xe3, 0x80, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x0e, 0x38, 0xfc, 0x71, 0xf8, 0xe3, 0xf0, 0x38, 0xf0,
+  0x71, 0xf0, 0xe0, 0xfe, 0x38, 0xfc, 0x71, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xef,
+  0xc7, 0x1c, 0x7f, 0x38, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x81, 0xc1, 0xe3, 0xc1, 0xc1, 0xe3, 0xc1, 0xe0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x83,
+  0xc0, 0x78, 0x1c, 0x0f, 0x01, 0xe0, 0x70, 0x38, 0x00, 0x00, 0x00, 0xe0, 0x70, 0x3c, 0x07, 0x81,
+  0xc0, 0xf0, 0x1e, 0x0f, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x3c, 0x1e, 0x3c, 0x1c, 0x1e, 0x3c,
+  0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00,
+  0x70, 0x38, 0xe3, 0xf1, 0xc7, 0xe3, 0x8e, 0x3f, 0xe0, 0x7f, 0xc0, 0xff, 0x8e, 0x38, 0xfc, 0x71,
+  0xf8, 0xe3, 0x81, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0,
+  0x03, 0xe0, 0x0f, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfe, 0x00, 0xf8, 0x00, 0xe0, 0x01,
+  0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xef, 0xc7, 0x1c, 0x7f, 0x38, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x7b, 0xff, 0xde, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x03, 0xc0, 0x1e, 0x00, 0x38,
+  0x00, 0xf0, 0x07, 0x80, 0x0e, 0x00, 0x3c, 0x01, 0xe0, 0x03, 0x80, 0x0f, 0x00, 0x78, 0x00, 0xe0,
+  0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,
+  0x3f, 0xe0, 0xff, 0xe7, 0xc0, 0x7f, 0x00, 0xfc, 0x01, 0xf8, 0x1f, 0xf0, 0x3f, 0xe0, 0xff, 0xc7,
+  0x1f, 0x8e, 0x3f, 0x1c, 0x7f, 0xe0, 0xff, 0x81, 0xff, 0x03, 0xf0, 0x07, 0xe0, 0x1f, 0xc0, 0x7c,
+  0xff, 0xe0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x0f, 0x1f, 0x8f,
+  0xc7, 0xe0, 0xf0, 0x78, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x3e, 0x1f, 0x3f,
+  0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xfe, 0x01, 0xfc,
+  0x01, 0xc0, 0x03, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0xf0, 0x01, 0xc0, 0x07, 0x80, 0x3c, 0x00, 0x70,
+  0x01, 0xe0, 0x0e, 0x00, 0x1c, 0x00, 0x78, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x03, 0xc0, 0x07, 0x00, 0x0e, 0x00, 0xe0,
+  0x01, 0xc0, 0x03, 0x80, 0x01, 0xe0, 0x01, 0xc0, 0x03, 0xc0, 0x01, 0xe0, 0x03, 0xc0, 0x03, 0xf0,
+  0x07, 0xe0, 0x1f, 0xf0, 0x7c, 0xff, 0xe0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x00, 0xe0, 0x03, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0xfe, 0x07, 0x1c, 0x0e, 0x38, 0x3c,
+  0x71, 0xc0, 0xe3, 0x83, 0xe7, 0x0f, 0xcf, 0xff, 0xef, 0xff, 0xcf, 0xff, 0x80, 0xfc, 0x00, 0xf8,
+  0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x3f, 0xfc, 0x3f, 0xf8, 0x3f, 0xf8, 0x00, 0x7c,
+  0x00, 0x78, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0xf0, 0x07, 0xe0, 0x1f, 0xf0, 0x7c, 0xff,
+  0xe0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x07, 0xe0, 0x1f, 0xc0,
+  0xf8, 0x01, 0xc0, 0x07, 0x80, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xff, 0xe3, 0xff, 0xc7, 0xff,
+  0xcf, 0x83, 0xfe, 0x03, 0xf8, 0x03, 0xf0, 0x07, 0xf0, 0x1f, 0xf0, 0x7c, 0xff, 0xe0, 0xff, 0x81,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf8, 0x00, 0x70, 0x00,
+  0xe0, 0x01, 0xc0, 0x1e, 0x00, 0x38, 0x00, 0xf0, 0x07, 0x80, 0x0e, 0x00, 0x3c, 0x01, 0xe0, 0x03,
+  0xc0, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xff, 0x01, 0xfc, 0x01, 0xf8,
+  0x03, 0xf8, 0x0f, 0xf8, 0x3e, 0x3f, 0xe0, 0x7f, 0xc0, 0xff, 0x8f, 0x83, 0xfe, 0x03, 0xf8, 0x03,
+  0xf0, 0x07, 0xf0, 0x1f, 0xf0, 0x7c, 0xff, 0xe0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xff, 0x01, 0xfc, 0x01, 0xf8, 0x03, 0xf8, 0x0f,
+  0xf8, 0x3e, 0x7f, 0xfc, 0x7f, 0xf8, 0xff, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x3c, 0x00,
+  0x70, 0x03, 0xe0, 0x7f, 0x00, 0xfc, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x7b, 0xff, 0xde, 0x30, 0x00, 0x00, 0x31, 0xef, 0xff, 0x78, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x7b, 0xff, 0xde, 0x30, 0x00, 0x00, 0xf3, 0xef, 0xc7, 0x1c, 0x7f, 0x38, 0xe0,
+  0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0xf0, 0x3c, 0x03, 0x80, 0x78, 0x1e, 0x01, 0xc0, 0x3c, 0x0e,
+  0x00, 0xe0, 0x0e, 0x00, 0x3c, 0x01, 0xc0, 0x1e, 0x00, 0x78, 0x03, 0x80, 0x3c, 0x00, 0xf0, 0x07,
+  0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0xf0, 0x03, 0xc0, 0x1c, 0x01, 0xe0, 0x07, 0x80, 0x38, 0x03,
+  0xc0, 0x07, 0x00, 0x70, 0x07, 0x03, 0xc0, 0x38, 0x07, 0x81, 0xe0, 0x1c, 0x03, 0xc0, 0xf0, 0x0e,
+  0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xfe, 0x01,
+  0xfc, 0x01, 0xc0, 0x03, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0xf0, 0x01, 0xc0, 0x07, 0x80, 0x3c, 0x00,
+  0x70, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xfe, 0x01, 0xfc, 0x01, 0xc0,
+  0x03, 0x80, 0x07, 0x00, 0x0e, 0x3c, 0x1c, 0x7c, 0x39, 0xfc, 0x7e, 0x38, 0xfc, 0x71, 0xf8, 0xe3,
+  0xf1, 0xc7, 0xe3, 0x8f, 0xc7, 0x1c, 0xff, 0xe0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xff, 0x01, 0xfc, 0x01, 0xf8, 0x03, 0xf0, 0x07,
+  0xe0, 0x0f, 0xc0, 0x1f, 0xc0, 0x7f, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xf0,
+  0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0,
+  0xff, 0xe3, 0xff, 0xe7, 0xc1, 0xff, 0x01, 0xfc, 0x01, 0xf8, 0x03, 0xf8, 0x0f, 0xf8, 0x3f, 0xff,
+  0xe3, 0xff, 0xc7, 0xff, 0x8f, 0x83, 0xfe, 0x03, 0xf8, 0x03, 0xf0, 0x07, 0xf0, 0x1f, 0xf0, 0x7f,
+  0xff, 0xe3, 0xff, 0x83, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xe0, 0xff,
+  0xe7, 0xc1, 0xff, 0x00, 0xfc, 0x01, 0xf8, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07,
+  0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x07, 0xf0, 0x0f, 0xf0, 0x7c, 0xff, 0xe0, 0xff,
+  0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0xff, 0x03, 0xff, 0x07, 0xcf, 0x8f,
+  0x07, 0x1c, 0x0f, 0x38, 0x07, 0xf0, 0x0f, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00,
+  0xfc, 0x03, 0xf8, 0x07, 0xf0, 0x3c, 0xf0, 0x71, 0xf3, 0xe3, 0xff, 0x03, 0xfc, 0x03, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0x00, 0x1c, 0x00,
+  0x38, 0x00, 0x78, 0x00, 0xf8, 0x01, 0xff, 0xe3, 0xff, 0xc7, 0xff, 0x8f, 0x80, 0x1e, 0x00, 0x38,
+  0x00, 0x70, 0x00, 0xf0, 0x01, 0xf0, 0x03, 0xff, 0xfb, 0xff, 0xf3, 0xff, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x78,
+  0x00, 0xf8, 0x01, 0xff, 0xe3, 0xff, 0xc7, 0xff, 0x8f, 0x80, 0x1e, 0x00, 0x38, 0x00, 0x70, 0x00,
+  0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xff, 0x00, 0xfc, 0x01, 0xf8, 0x00, 0x70, 0x00, 0xe0, 0x01,
+  0xc7, 0xf3, 0x8f, 0xf7, 0x1f, 0xfe, 0x03, 0xfc, 0x03, 0xf8, 0x03, 0xf0, 0x07, 0xf0, 0x1f, 0xf0,
+  0x7c, 0xff, 0xf8, 0xff, 0xe1, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0xc0, 0x1f,
+  0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfc, 0x01, 0xf8, 0x03, 0xf8, 0x0f, 0xf8, 0x3f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x83, 0xfe, 0x03, 0xf8, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f,
+  0x00, 0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe7, 0xc3, 0xe0, 0xe0,
+  0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x3e, 0x1f, 0x3f, 0xff, 0xff,
+  0xf8, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x07, 0xfc, 0x0f, 0xf8, 0x07, 0xc0, 0x0f, 0x80, 0x0e, 0x00,
+  0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c,
+  0x70, 0x38, 0xe0, 0xf1, 0xf3, 0xe0, 0xff, 0x00, 0xfc, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x7f, 0x03, 0xce, 0x07, 0x1c, 0x1e, 0x38, 0xf0, 0x71, 0xc0,
+  0xe3, 0x81, 0xf8, 0x03, 0xf0, 0x07, 0xe0, 0x0e, 0x38, 0x1c, 0x70, 0x38, 0xf0, 0x70, 0x78, 0xe0,
+  0x71, 0xc0, 0xf3, 0x80, 0x7f, 0x00, 0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01,
+  0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
+  0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xf0, 0x01, 0xf0, 0x03,
+  0xff, 0xfb, 0xff, 0xf3, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0xc0, 0x1f, 0xc0,
+  0x7f, 0xe3, 0xff, 0xc7, 0xff, 0x8f, 0xf8, 0xe3, 0xf1, 0xc7, 0xe3, 0x8f, 0xc7, 0x1f, 0x8e, 0x3f,
+  0x1c, 0x7e, 0x00, 0xfc, 0x01, 0xf8, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00,
+  0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7f,
+  0x00, 0xfe, 0x01, 0xff, 0x03, 0xfe, 0x07, 0xfe, 0x0f, 0xc7, 0x1f, 0x8e, 0x3f, 0x1c, 0x7e, 0x0f,
+  0xfc, 0x0f, 0xf8, 0x1f, 0xf0, 0x0f, 0xe0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xff, 0x01, 0xfc, 0x01,
+  0xf8, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfc, 0x01, 0xf8,
+  0x03, 0xf0, 0x07, 0xf0, 0x1f, 0xf0, 0x7c, 0xff, 0xe0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3f, 0xf0, 0xff, 0xe3, 0xff, 0xe7, 0xc1, 0xff, 0x01, 0xfc, 0x01, 0xf8, 0x03, 0xf8,
+  0x0f, 0xf8, 0x3f, 0xff, 0xf3, 0xff, 0xc7, 0xff, 0x8f, 0x80, 0x1e, 0x00, 0x38, 0x00, 0x70, 0x00,
+  0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xf0, 0x3f, 0xe0, 0xff, 0xe7, 0xc1, 0xff, 0x01, 0xfc, 0x01, 0xf8, 0x03, 0xf0, 0x07, 0xe0, 0x0f,
+  0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x38, 0xfc, 0x71, 0xf8, 0xe3, 0xf0, 0x38, 0xf0, 0x71, 0xf0,
+  0xe0, 0xfe, 0x38, 0xfc, 0x71, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0xff, 0xe3,
+  0xff, 0xe7, 0xc1, 0xff, 0x01, 0xfc, 0x01, 0xf8, 0x03, 0xf8, 0x0f, 0xf8, 0x3f, 0xff, 0xf3, 0xff,
+  0xc7, 0xff, 0x8e, 0x38, 0x1c, 0x70, 0x38, 0xe0, 0x70, 0x78, 0xe0, 0x71, 0xc0, 0xf3, 0x80, 0x7f,
+  0x00, 0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x3f, 0xfc, 0xff, 0xff, 0xc0,
+  0x0f, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x78, 0x00, 0xf8, 0x00, 0x7f, 0xe0, 0x7f, 0xc0, 0xff, 0xc0,
+  0x03, 0xe0, 0x03, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x1e, 0x00, 0x7f, 0xff, 0xe7, 0xff, 0x8f, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0x00, 0x7c, 0x00,
+  0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfc, 0x01, 0xf8, 0x03,
+  0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfc, 0x01, 0xf8, 0x03, 0xf0,
+  0x07, 0xf0, 0x1f, 0xf0, 0x7c, 0xff, 0xe0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfc, 0x01, 0xf8, 0x03, 0xf0, 0x07, 0xe0,
+  0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfe, 0x03, 0xfc, 0x07, 0x9e, 0x3c, 0x1c, 0x70,
+  0x38, 0xe0, 0x1f, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0xc0,
+  0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfc, 0x01, 0xf8, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc7, 0x1f,
+  0x8e, 0x3f, 0x1c, 0x7e, 0x38, 0xfc, 0x71, 0xf8, 0xe3, 0xf1, 0xc7, 0xe3, 0x8f, 0xc7, 0x1c, 0xf1,
+  0xe0, 0xe3, 0x81, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f,
+  0x00, 0x7f, 0x01, 0xfe, 0x03, 0xcf, 0x1e, 0x0e, 0x38, 0x1c, 0x70, 0x07, 0x00, 0x0e, 0x00, 0x1c,
+  0x01, 0xc7, 0x03, 0x8e, 0x0f, 0x1e, 0x78, 0x0f, 0xf0, 0x1f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e,
+  0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00,
+  0xfc, 0x01, 0xf8, 0x03, 0xf8, 0x0f, 0xf0, 0x1e, 0x78, 0xf0, 0x71, 0xc0, 0xe3, 0x80, 0x7c, 0x00,
+  0xf8, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf8, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
+  0x1e, 0x00, 0x38, 0x00, 0xf0, 0x07, 0x80, 0x0e, 0x00, 0x3c, 0x01, 0xe0, 0x03, 0x80, 0x0f, 0x00,
+  0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0xff, 0xfb, 0xff, 0xf3, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0xbf, 0xff, 0xff, 0x0f, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07,
+  0x03, 0x81, 0xc0, 0xf0, 0x7c, 0x3f, 0xef, 0xf3, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x0f, 0x00, 0x0e,
+  0x00, 0x1e, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0xbf, 0xe1, 0xf0, 0x78, 0x1c,
+  0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x07, 0x87, 0xff, 0xff, 0xef,
+  0xe0, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0x00, 0x1f, 0x00, 0xe3, 0x81, 0xc7, 0x07, 0x8f, 0x3c,
+  0x07, 0xf0, 0x07, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x70,
+  0x3c, 0x07, 0x81, 0xc0, 0xf0, 0x1e, 0x07, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x0f, 0xf8, 0x1f, 0xf8, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x71,
+  0xff, 0xe3, 0xff, 0xcf, 0xff, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1c, 0xff, 0xf8, 0xff, 0xe1, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c,
+  0x00, 0x38, 0xfc, 0x71, 0xf8, 0xe3, 0xf9, 0xfe, 0x7f, 0xf0, 0x7f, 0xe0, 0x7f, 0x00, 0xfe, 0x01,
+  0xf8, 0x03, 0xf0, 0x07, 0xf0, 0x1f, 0xf0, 0x7f, 0xff, 0xe3, 0xff, 0x83, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc,
+  0x0f, 0xf8, 0x3f, 0xf1, 0xf0, 0x03, 0xc0, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70,
+  0x07, 0xf0, 0x0f, 0xf0, 0x7c, 0xff, 0xe0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc7, 0xe3, 0x8f, 0xc7, 0x3f,
+  0x8f, 0xf3, 0xff, 0xc1, 0xff, 0x03, 0xfe, 0x01, 0xfc, 0x03, 0xf8, 0x03, 0xf0, 0x07, 0xf0, 0x1f,
+  0xf0, 0x7c, 0xff, 0xf8, 0xff, 0xe1, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x0f, 0xf8, 0x3f, 0xf9, 0xc0, 0x1f,
+  0x80, 0x3f, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xbf, 0xfe, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0xff,
+  0xc0, 0xff, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x07, 0xe0, 0x1f, 0xe0,
+  0xf9, 0xf1, 0xe0, 0xe3, 0x81, 0xc7, 0x00, 0x1f, 0x00, 0x3e, 0x01, 0xff, 0x03, 0xfe, 0x07, 0xfc,
+  0x03, 0xe0, 0x07, 0xc0, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc1, 0xff,
+  0xc7, 0xff, 0xfe, 0x0f, 0xf8, 0x0f, 0xe0, 0x0f, 0xc0, 0x1f, 0xc0, 0x7f, 0xc1, 0xf3, 0xff, 0xe3,
+  0xff, 0xc7, 0xff, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x7f, 0xe0, 0xff, 0x81, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38,
+  0xfc, 0x71, 0xf8, 0xe3, 0xf9, 0xfe, 0x7f, 0xf0, 0x7f, 0xe0, 0x7f, 0x00, 0xfe, 0x01, 0xf8, 0x03,
+  0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x03, 0xc1, 0xf0, 0xfc, 0x1e, 0x0f, 0x03, 0x81, 0xc0,
+  0xe0, 0x70, 0x38, 0x3e, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3e, 0x03, 0xf0, 0x0f, 0x00, 0xf0, 0x07, 0x00, 0x70,
+  0x07, 0x00, 0x7e, 0x07, 0xe0, 0xff, 0x9f, 0x3f, 0xc1, 0xf8, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x7e, 0x07, 0xe0, 0xfe, 0x3c, 0xe3,
+  0x8e, 0x38, 0xfc, 0x0f, 0xc0, 0xfc, 0x0e, 0x38, 0xe3, 0x8e, 0x3c, 0xe0, 0xfe, 0x07, 0xe0, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0xf0, 0x7c, 0x3f, 0x07, 0x83, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07,
+  0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x3e, 0x1f, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1c, 0x3e, 0x38, 0xfc, 0x79,
+  0xc7, 0x1f, 0x8e, 0x3f, 0x1c, 0x7e, 0x38, 0xfc, 0x71, 0xf8, 0xe3, 0xf0, 0x07, 0xe0, 0x0f, 0xc0,
+  0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xfc, 0x71, 0xf8, 0xe3, 0xf9, 0xfe, 0x7f, 0xf0,
+  0x7f, 0xe0, 0x7f, 0x00, 0xfe, 0x01, 0xf8, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f,
+  0x00, 0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x0f, 0xf8, 0x3f, 0xf9, 0xf0, 0x7f, 0xc0, 0x7f, 0x00, 0x7e,
+  0x00, 0xfc, 0x01, 0xf8, 0x03, 0xf0, 0x07, 0xf0, 0x1f, 0xf0, 0x7c, 0xff, 0xe0, 0xff, 0x81, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0xfc, 0x3f, 0xf8, 0xff, 0xf9, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7f, 0xff, 0x9f, 0xfe,
+  0x3f, 0xfc, 0x7c, 0x00, 0xf0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe,
+  0x0f, 0xfe, 0x3f, 0xff, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x73, 0xff, 0xe3, 0xff, 0xc7, 0xff, 0x80,
+  0x1f, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xfc, 0x71, 0xf8, 0xe3,
+  0xf9, 0xfe, 0x7f, 0xf0, 0x3f, 0xe0, 0x7f, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01,
+  0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x0f, 0xf8, 0x3f, 0xf1, 0xc0, 0x03,
+  0x80, 0x07, 0x00, 0x03, 0xff, 0x03, 0xfe, 0x07, 0xfe, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1f, 0xff,
+  0xe7, 0xff, 0x8f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00,
+  0xe0, 0x03, 0xe0, 0x07, 0xc0, 0x3f, 0xe0, 0x7f, 0xc0, 0xff, 0x80, 0x7c, 0x00, 0xf8, 0x00, 0xe0,
+  0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x07, 0x1e, 0x0e, 0x3e, 0x7c, 0x1f, 0xe0, 0x1f, 0x80,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfc,
+  0x03, 0xf8, 0x07, 0xf0, 0x3f, 0xf0, 0x7f, 0xf3, 0xfc, 0xfe, 0x38, 0xfc, 0x71, 0xf8, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+  0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x00, 0xfe, 0x03, 0xfc, 0x07,
+  0x9e, 0x3c, 0x1c, 0x70, 0x38, 0xe0, 0x1f, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xf0, 0x07,
+  0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00, 0x7e, 0x38, 0xfc, 0x71, 0xf8, 0xe3, 0xf1, 0xc7, 0xe3,
+  0x8f, 0xc7, 0x1c, 0xf1, 0xe0, 0xe3, 0x81, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xf0, 0x07, 0xf0, 0x1e, 0x78,
+  0xf0, 0x71, 0xc0, 0xe3, 0x80, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x0e, 0x38, 0x1c, 0x70, 0x78, 0xf3,
+  0xc0, 0x7f, 0x00, 0x7e, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0xc0, 0x7f,
+  0xc1, 0xf3, 0xff, 0xe3, 0xff, 0xc7, 0xff, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x7f, 0xe0, 0xff,
+  0x81, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xf0, 0x01, 0xc0, 0x03, 0x80, 0x3c,
+  0x00, 0x70, 0x01, 0xe0, 0x0e, 0x00, 0x1c, 0x00, 0x78, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0xc1, 0xe3, 0xc1, 0xe0, 0xe0, 0x70, 0x78, 0x3c, 0x70,
+  0x38, 0x1c, 0x03, 0xc1, 0xe0, 0x70, 0x38, 0x1e, 0x0f, 0x01, 0xe0, 0x70, 0x38, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xe0, 0x70, 0x3c, 0x07, 0x83, 0xc0, 0xe0,
+  0x70, 0x3c, 0x1e, 0x01, 0xc0, 0xe0, 0x71, 0xe0, 0xf0, 0x70, 0x38, 0x3c, 0x1e, 0x3c, 0x1c, 0x0e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1c, 0x7e, 0x39, 0xfc, 0x7f, 0x9f, 0x9c, 0x0e, 0x38, 0x1c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+};
+
+/** @const Font */
+const struct S_FONT FONT_24 PROGMEM = {
+  .height = 24,
+  .first = 0x20,
+  .last = 0x7e,
+  .spacing = 3,
+  .bpp = 1,
+  .widths = FONT_24_WIDTHS,
+  .offsets = FONT_24_OFFSETS,
+  .bitmap = FONT_24_BITMAP
+};
@@ -0,0 +1,529 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       FONT_24_AA 24px proportional font, 2 bpp
+ * ---------------------------------------------------------------+ 
+ * @file        font_24_aa.c
+ * @source      src/font.c
+ *
+ * @notes       generated by tools/bdf2font.py, do not edit
+ *              flash 7935 bytes
+ * ---------------------------------------------------------------+
+ */
+#include "../font.h"
+
+/** @array Glyph widths */
+static const uint8_t FONT_24_AA_WIDTHS[] PROGMEM = {
+  6, 15, 9, 15, 15, 15, 15, 6, 9, 9, 15, 15, 6, 15, 6, 15,
+  15, 9, 15, 15, 15, 15, 15, 15, 15, 15, 6, 6, 12, 15, 12, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 9, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 9, 15, 9, 15, 15,
+  9, 15, 15, 15, 15, 15, 15, 15, 15, 9, 12, 12, 9, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 9, 3, 9, 15,
+};
+
+/** @array Glyph offsets into bitmap */
+static const uint16_t FONT_24_AA_OFFSETS[] PROGMEM = {
+  0, 36, 126, 180, 270, 360, 450, 540, 576, 630, 684, 774,
+  864, 900, 990, 1026, 1116, 1206, 1260, 1350, 1440, 1530, 1620, 1710,
+  1800, 1890, 1980, 2016, 2052, 2124, 2214, 2286, 2376, 2466, 2556, 2646,
+  2736, 2826, 2916, 3006, 3096, 3186, 3240, 3330, 3420, 3510, 3600, 3690,
+  3780, 3870, 3960, 4050, 4140, 4230, 4320, 4410, 4500, 4590, 4680, 4770,
+  4824, 4914, 4968, 5058, 5148, 5202, 5292, 5382, 5472, 5562, 5652, 5742,
+  5832, 5922, 5976, 6048, 6120, 6174, 6264, 6354, 6444, 6534, 6624, 6714,
+  6804, 6894, 6984, 7074, 7164, 7254, 7344, 7434, 7488, 7506, 7560,
+};
+
+/** @array Glyph bitmap, row by row, MSB first, 2 bpp */
+static const uint8_t FONT_24_AA_BITMAP[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0xd0, 0x1f, 0xf7, 0xff, 0xc0, 0xff, 0xf7, 0xfd, 0x01, 0xff, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0,
+  0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0x40, 0x7f, 0xdf, 0xff, 0x03, 0xff, 0xdf, 0xf4, 0x07, 0xfd, 0x74, 0x07,
+  0x7f, 0x03, 0xff, 0xc0, 0xff, 0xf0, 0x3f, 0xfc, 0x0f, 0xff, 0x03, 0xff, 0xc0, 0xff, 0xf0, 0x3f,
+  0x74, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0x1d, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x3f, 0x03, 0xf0, 0x01,
+  0xfc, 0x0f, 0xd0, 0x0b, 0xf0, 0x3f, 0x80, 0xbf, 0xe2, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xbf, 0xff,
+  0xff, 0xff, 0x7f, 0xff, 0xff, 0xf4, 0x2f, 0xe2, 0xfe, 0x00, 0x3f, 0x03, 0xf0, 0x02, 0xfe, 0x2f,
+  0xe0, 0x7f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x8b, 0xfe, 0x2f, 0xf8,
+  0x0b, 0xf0, 0x3f, 0x80, 0x1f, 0xc0, 0xfd, 0x00, 0x3f, 0x03, 0xf0, 0x00, 0xfc, 0x0f, 0xc0, 0x01,
+  0xd0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x80, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x0b, 0xff, 0x90, 0x00, 0xbf, 0xff, 0xfd, 0x0b, 0xff, 0xff,
+  0xfc, 0xbf, 0xff, 0xff, 0xdb, 0xe2, 0xfe, 0x00, 0x3f, 0x03, 0xf0, 0x00, 0xbe, 0x2f, 0xe0, 0x00,
+  0xbf, 0xff, 0xf8, 0x00, 0xbf, 0xff, 0xf8, 0x00, 0xbf, 0xff, 0xf8, 0x00, 0x2f, 0xe2, 0xf8, 0x00,
+  0x3f, 0x03, 0xf0, 0x02, 0xfe, 0x2f, 0x9f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff,
+  0xf8, 0x00, 0x1b, 0xff, 0x80, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x40, 0x00, 0x01, 0xff, 0x40, 0x00, 0x0b,
+  0xfe, 0x00, 0x00, 0x2f, 0xf8, 0x00, 0x2d, 0x7f, 0xd0, 0x02, 0xfc, 0x69, 0x00, 0x2f, 0xe0, 0x00,
+  0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe,
+  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00,
+  0x2f, 0xe0, 0x01, 0xa4, 0xfe, 0x00, 0x1f, 0xf5, 0xe0, 0x00, 0xbf, 0xe0, 0x00, 0x02, 0xff, 0x80,
+  0x00, 0x07, 0xfd, 0x00, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0x80, 0x00, 0x2f, 0xff, 0x80, 0x02, 0xff, 0xff, 0x80, 0x2f, 0xe4, 0x2f,
+  0x80, 0xfe, 0x00, 0x3f, 0x03, 0xf4, 0x02, 0xf8, 0x0f, 0xc0, 0x7f, 0x80, 0x3f, 0x03, 0xf8, 0x00,
+  0x76, 0x27, 0x80, 0x00, 0x27, 0x60, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x02, 0x76, 0x00, 0x00, 0x76,
+  0x27, 0x40, 0x77, 0xf0, 0x3f, 0x03, 0xff, 0xc0, 0x76, 0x27, 0x7f, 0x40, 0x27, 0x60, 0xfe, 0x00,
+  0x3f, 0x02, 0xfe, 0x42, 0x76, 0x02, 0xff, 0xf6, 0x27, 0x42, 0xff, 0xf0, 0x3f, 0x02, 0xff, 0x40,
+  0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x4f, 0xfd, 0x7f,
+  0xe0, 0xbf, 0x03, 0xf0, 0xbe, 0x7f, 0x8f, 0xe0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0b, 0x40, 0x0b, 0xf0, 0x0b, 0xf8, 0x0b, 0xf8, 0x0b, 0xf8, 0x0b, 0xf8, 0x0b, 0xf8, 0x03,
+  0xf8, 0x00, 0xfd, 0x00, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0xfd, 0x00, 0x3f, 0x80, 0x0b,
+  0xf8, 0x00, 0xbf, 0x80, 0x0b, 0xf8, 0x00, 0xbf, 0x80, 0x0b, 0xf8, 0x00, 0xbf, 0x00, 0x0b, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0x80, 0x0b, 0xf8, 0x00, 0xbf, 0x80, 0x0b,
+  0xf8, 0x00, 0xbf, 0x80, 0x0b, 0xf8, 0x00, 0xbf, 0x00, 0x1f, 0xc0, 0x03, 0xf0, 0x00, 0xfc, 0x00,
+  0x3f, 0x00, 0x1f, 0xc0, 0x0b, 0xf0, 0x0b, 0xf8, 0x0b, 0xf8, 0x0b, 0xf8, 0x0b, 0xf8, 0x0b, 0xf8,
+  0x03, 0xf8, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00,
+  0x3f, 0x00, 0x07, 0x40, 0xfc, 0x07, 0x7f, 0x03, 0xf0, 0x3f, 0x76, 0x2f, 0xe2, 0x74, 0x27, 0xff,
+  0xf6, 0x00, 0x3f, 0xff, 0xf0, 0x02, 0x7f, 0xff, 0x60, 0x76, 0x2f, 0xe2, 0x77, 0xf0, 0x3f, 0x03,
+  0xf7, 0x40, 0xfc, 0x07, 0x40, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x01, 0xfd, 0x00,
+  0x00, 0x0b, 0xf8, 0x00, 0x01, 0xbf, 0xf9, 0x01, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf,
+  0xff, 0xff, 0xfd, 0x01, 0xbf, 0xf9, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x03,
+  0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7e, 0x4f, 0xfd, 0x7f, 0xe0, 0xbf, 0x03, 0xf0, 0xbe, 0x7f, 0x8f, 0xe0, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xa4, 0x7f, 0xdb, 0xfe, 0xbf, 0xe7, 0xfd, 0x1a, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0,
+  0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02,
+  0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0x00,
+  0x2f, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x00, 0xbe, 0xfe, 0x00, 0x00, 0xff, 0xf4,
+  0x00, 0x0b, 0xff, 0xc0, 0x02, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xfc, 0x02, 0xff, 0xff, 0xf0, 0x2f,
+  0x8b, 0xff, 0xc0, 0xfc, 0x0f, 0xff, 0x8b, 0xe0, 0x3f, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xe0, 0x03,
+  0xff, 0xfe, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x7f, 0xfc, 0x00, 0x02, 0xfe, 0xf8, 0x00, 0x6f, 0xe2,
+  0xff, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd0, 0x02, 0xfc, 0x02, 0xff, 0x02, 0xff, 0xc0, 0xff,
+  0xf0, 0x2f, 0xfc, 0x02, 0xff, 0x00, 0x2f, 0xc0, 0x07, 0xf0, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0x0f,
+  0xc0, 0x03, 0xf0, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0x1f, 0xd0, 0x0b, 0xf8, 0x0b, 0xff, 0x8b, 0xff,
+  0xfb, 0xff, 0xff, 0x7f, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0x00,
+  0x2f, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02, 0xfd, 0xe0,
+  0x00, 0x07, 0xf0, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x0b, 0xf8, 0x00, 0x00,
+  0xbf, 0x80, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0xbf, 0x80,
+  0x00, 0x0b, 0xf8, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00, 0xbf, 0xe0, 0x00, 0x0b,
+  0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
+  0xff, 0x80, 0x00, 0x2f, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x02, 0x78, 0x00, 0x00, 0x76, 0x00,
+  0x00, 0x03, 0xf0, 0x00, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0x0b, 0xf8, 0x00,
+  0x00, 0x0b, 0xf8, 0x00, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00, 0x1f, 0xde, 0x00,
+  0x00, 0x7f, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff, 0xfe, 0x02, 0xff, 0xff,
+  0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x2f, 0xf0, 0x00, 0x02, 0xff, 0xc0, 0x00,
+  0x2f, 0xff, 0x00, 0x02, 0xff, 0xfc, 0x00, 0x2f, 0x8b, 0xf0, 0x02, 0xfc, 0x0f, 0xc0, 0x2f, 0xd0,
+  0x3f, 0x02, 0xf8, 0x01, 0xfd, 0x0f, 0xc0, 0x0b, 0xf8, 0x3f, 0x81, 0xbf, 0xf8, 0xbf, 0xff, 0xff,
+  0xf9, 0xff, 0xff, 0xff, 0xf1, 0xbf, 0xff, 0xff, 0x80, 0x01, 0xbf, 0xf8, 0x00, 0x00, 0xbf, 0x80,
+  0x00, 0x01, 0xfd, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xf5, 0xff, 0xff,
+  0xff, 0xfb, 0xff, 0xff, 0xff, 0x7f, 0x80, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00,
+  0x0b, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xe0, 0x1b, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x6f, 0xe0,
+  0x00, 0x00, 0x2f, 0xc0, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00,
+  0x00, 0x0f, 0xde, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff,
+  0xfe, 0x02, 0xff, 0xff, 0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfd, 0x00, 0x00, 0xbf, 0xfc, 0x00, 0x0b, 0xff, 0xd0, 0x00,
+  0xbf, 0x90, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
+  0xf8, 0xff, 0x90, 0x1b, 0xfb, 0xf8, 0x00, 0x0b, 0xff, 0xd0, 0x00, 0x1f, 0xff, 0x40, 0x00, 0x7f,
+  0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xe0, 0x02,
+  0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
+  0xff, 0x93, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x0b, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00,
+  0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x0f,
+  0xe0, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0,
+  0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x02,
+  0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xd0,
+  0x00, 0x1f, 0xff, 0x80, 0x00, 0xbf, 0x7f, 0x90, 0x1b, 0xf4, 0x2f, 0xff, 0xfe, 0x00, 0x3f, 0xff,
+  0xf0, 0x02, 0xff, 0xff, 0xe0, 0x7f, 0x90, 0x1b, 0xf7, 0xf8, 0x00, 0x0b, 0xff, 0xd0, 0x00, 0x1f,
+  0xff, 0x40, 0x00, 0x7f, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff, 0xfe, 0x02,
+  0xff, 0xff, 0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06,
+  0xfe, 0xfe, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xd0, 0x00, 0x1f, 0xff, 0x80, 0x00, 0xbf,
+  0xbf, 0x90, 0x1b, 0xfc, 0xbf, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xff, 0x00,
+  0x00, 0x02, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x0b, 0xf8, 0x00, 0x00,
+  0xbf, 0x80, 0x00, 0x1b, 0xf8, 0x00, 0x1f, 0xff, 0x80, 0x00, 0xff, 0xf8, 0x00, 0x01, 0xff, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xa4, 0x7f, 0xdb, 0xfe, 0xbf, 0xe7, 0xfd, 0x1a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x47,
+  0xfd, 0xbf, 0xeb, 0xfe, 0x7f, 0xd1, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xa4, 0x7f, 0xdb, 0xfe, 0xbf, 0xe7, 0xfd, 0x1a, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x7e, 0x4f, 0xfd, 0x7f, 0xe0, 0xbf, 0x03, 0xf0, 0xbe, 0x7f, 0x8f, 0xe0, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0xbf, 0x00, 0x02, 0xfe, 0x00, 0x0b, 0xf8,
+  0x00, 0x2f, 0xe0, 0x00, 0xbf, 0x80, 0x02, 0xfe, 0x00, 0x0b, 0xf8, 0x00, 0x2f, 0xe0, 0x00, 0xbe,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x0b, 0xf8, 0x00, 0x02, 0xfe,
+  0x00, 0x00, 0xbf, 0x80, 0x00, 0x2f, 0xe0, 0x00, 0x0b, 0xf8, 0x00, 0x02, 0xfe, 0x00, 0x00, 0xbf,
+  0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+  0xf7, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x2f,
+  0xe0, 0x00, 0x0b, 0xf8, 0x00, 0x02, 0xfe, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x2f, 0xe0, 0x00, 0x0b,
+  0xf8, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xbe, 0x00, 0x0b, 0xf8, 0x00, 0x2f, 0xe0,
+  0x00, 0xbf, 0x80, 0x02, 0xfe, 0x00, 0x0b, 0xf8, 0x00, 0x2f, 0xe0, 0x00, 0xbf, 0x80, 0x00, 0xfe,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02,
+  0xfd, 0xe0, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x0b, 0xf8,
+  0x00, 0x00, 0xbf, 0x80, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x0b, 0xf8, 0x00, 0x00,
+  0x3f, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x02,
+  0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02, 0xfd, 0xe0, 0x00, 0x07, 0xf0, 0x00,
+  0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x0b, 0xe4, 0x03, 0xf0, 0xbf, 0xf4,
+  0x0f, 0xcb, 0xff, 0xe0, 0x3f, 0xbe, 0x2f, 0xc0, 0xff, 0xf0, 0x3f, 0x03, 0xff, 0xc0, 0xfc, 0x0f,
+  0xff, 0x03, 0xf0, 0x3f, 0xfc, 0x0f, 0xc0, 0xfe, 0xf8, 0xbf, 0x8b, 0xe2, 0xff, 0xff, 0xfe, 0x02,
+  0xff, 0xff, 0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06,
+  0xfe, 0xfe, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f,
+  0xfc, 0x00, 0x00, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x2f, 0xff, 0xe4, 0x06, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x06, 0xff, 0xfe, 0x00,
+  0x02, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0x74, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xfe, 0x01,
+  0xff, 0xff, 0xfe, 0x0b, 0xff, 0xff, 0xfe, 0x3f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02, 0xff, 0xf4,
+  0x00, 0x07, 0xff, 0xd0, 0x00, 0x1f, 0xff, 0x80, 0x00, 0xbf, 0xff, 0x90, 0x1b, 0xf7, 0xff, 0xff,
+  0xfe, 0x0f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xe0, 0xff, 0x90, 0x1b, 0xf7, 0xf8, 0x00, 0x0b,
+  0xff, 0xd0, 0x00, 0x1f, 0xff, 0x40, 0x00, 0x7f, 0xfe, 0x00, 0x02, 0xff, 0xfe, 0x40, 0x6f, 0xeb,
+  0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe0, 0x1b, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x02, 0xff, 0xff,
+  0xfe, 0x2f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x02, 0xdf, 0xc0, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x40,
+  0x00, 0x2d, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff, 0xfe, 0x02, 0xff, 0xff,
+  0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x0b, 0xff, 0xff, 0x80, 0x3f, 0xe5, 0xbf, 0x80, 0xfe,
+  0x00, 0xbf, 0x83, 0xf4, 0x00, 0xbf, 0x8f, 0xc0, 0x00, 0xbf, 0xbf, 0x00, 0x00, 0xbf, 0xfc, 0x00,
+  0x01, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x01,
+  0xff, 0xf0, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0xbf, 0xbf, 0x40, 0x0b, 0xf8, 0xfe, 0x00, 0xbf, 0x83,
+  0xfe, 0x5b, 0xf8, 0x0b, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xf8, 0x00, 0x1b, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xf5, 0xff, 0xff,
+  0xff, 0xfb, 0xff, 0xff, 0xff, 0x7f, 0xe4, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00,
+  0x0f, 0xd0, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0xff, 0x90, 0x00, 0x03, 0xff, 0xff, 0xf4, 0x0f,
+  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x40, 0xff, 0x90, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x0f, 0xd0,
+  0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x03, 0xfe, 0x40, 0x00, 0x0b, 0xff, 0xff,
+  0xff, 0x5f, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x7f,
+  0xe4, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x00, 0xff, 0x90, 0x00, 0x03, 0xff, 0xff, 0xf4, 0x0f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff,
+  0x40, 0xff, 0x90, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02,
+  0xff, 0xf4, 0x00, 0x02, 0xdf, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03,
+  0xf0, 0x1f, 0xfe, 0x4f, 0xc0, 0xff, 0xff, 0x7f, 0x01, 0xff, 0xfe, 0xfc, 0x00, 0x1b, 0xff, 0xf0,
+  0x00, 0x0b, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0x40, 0x00, 0x7f, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40,
+  0x6f, 0xf2, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xfd, 0x02, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x77, 0xf0, 0x00, 0x03, 0xff,
+  0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xd0,
+  0x00, 0x1f, 0xff, 0x80, 0x00, 0xbf, 0xff, 0x90, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x1b, 0xff, 0xf8, 0x00, 0x0b, 0xff, 0xd0, 0x00, 0x1f,
+  0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff,
+  0x00, 0x00, 0x3f, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xff, 0x7f, 0xff, 0xfb, 0xff, 0xf8, 0xbf, 0xf8, 0x0b, 0xf8, 0x01, 0xfd, 0x00,
+  0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00,
+  0xfc, 0x00, 0x3f, 0x00, 0x1f, 0xd0, 0x0b, 0xf8, 0x0b, 0xff, 0x8b, 0xff, 0xfb, 0xff, 0xff, 0x7f,
+  0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf4, 0x00, 0x3f, 0xff, 0xf0,
+  0x00, 0xbf, 0xff, 0x80, 0x00, 0xbf, 0xf8, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x01, 0xfd, 0x00, 0x00,
+  0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03,
+  0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0,
+  0x1e, 0x00, 0x1f, 0xc0, 0xfe, 0x00, 0xbf, 0x02, 0xfe, 0x5b, 0xf8, 0x02, 0xff, 0xff, 0x80, 0x02,
+  0xff, 0xf8, 0x00, 0x02, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x74, 0x00, 0x00, 0xb7, 0xf0, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0xbf, 0xbf, 0x00, 0x0b,
+  0xf8, 0xfc, 0x00, 0xbf, 0x83, 0xf0, 0x0b, 0xf8, 0x0f, 0xc0, 0xbf, 0x80, 0x3f, 0x03, 0xf8, 0x00,
+  0xfe, 0x27, 0x80, 0x03, 0xff, 0x60, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xf6, 0x00, 0x00, 0xfe,
+  0x27, 0x80, 0x03, 0xf0, 0x3f, 0x80, 0x0f, 0xc0, 0xbf, 0x80, 0x3f, 0x00, 0xbf, 0x80, 0xfc, 0x00,
+  0xbf, 0x83, 0xf0, 0x00, 0xbf, 0x8f, 0xc0, 0x00, 0xbf, 0xbf, 0x00, 0x00, 0xbf, 0x74, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03,
+  0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0,
+  0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00,
+  0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00,
+  0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x03, 0xfe, 0x40, 0x00, 0x0b,
+  0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xb7, 0xf8, 0x00, 0x0b, 0xff, 0xf8, 0x00,
+  0xbf, 0xff, 0xf8, 0x0b, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x62, 0x7f, 0xff, 0xe2, 0x76, 0x2f,
+  0xff, 0x03, 0xf0, 0x3f, 0xfc, 0x0f, 0xc0, 0xff, 0xf0, 0x3f, 0x03, 0xff, 0xc0, 0xfc, 0x0f, 0xff,
+  0x01, 0xd0, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00,
+  0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00,
+  0x3f, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x77, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x40, 0x00, 0x3f, 0xfe,
+  0x00, 0x00, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xfe,
+  0x00, 0xff, 0xf8, 0xbe, 0x03, 0xff, 0xc0, 0xfc, 0x0f, 0xff, 0x02, 0xf8, 0xbf, 0xfc, 0x02, 0xff,
+  0xff, 0xf0, 0x02, 0xff, 0xff, 0xc0, 0x02, 0xff, 0xff, 0x00, 0x02, 0xff, 0xfc, 0x00, 0x02, 0xff,
+  0xf0, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0x74, 0x00, 0x00, 0x74, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x2f, 0xff,
+  0xfe, 0x02, 0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x07,
+  0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff,
+  0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0,
+  0x00, 0x0f, 0xff, 0x40, 0x00, 0x7f, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff,
+  0xfe, 0x02, 0xff, 0xff, 0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xfe, 0x0b, 0xff, 0xff, 0xfe, 0x3f,
+  0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xd0, 0x00, 0x1f, 0xff, 0x80,
+  0x00, 0xbf, 0xff, 0x90, 0x1b, 0xfb, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
+  0x80, 0xff, 0x90, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xfe, 0x2f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02,
+  0xff, 0xf4, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff,
+  0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x07, 0x40, 0xff, 0xf0,
+  0x3f, 0x03, 0xff, 0xc0, 0x76, 0x27, 0x7f, 0x40, 0x27, 0x60, 0xfe, 0x00, 0x3f, 0x02, 0xfe, 0x42,
+  0x76, 0x02, 0xff, 0xf6, 0x27, 0x42, 0xff, 0xf0, 0x3f, 0x02, 0xff, 0x40, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xfe, 0x01, 0xff, 0xff, 0xfe, 0x0b,
+  0xff, 0xff, 0xfe, 0x3f, 0xe4, 0x06, 0xfe, 0xfe, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xd0,
+  0x00, 0x1f, 0xff, 0x80, 0x00, 0xbf, 0xff, 0x90, 0x1b, 0xfb, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
+  0xf8, 0x3f, 0xff, 0xff, 0x80, 0xfe, 0x2f, 0xe0, 0x03, 0xf0, 0x3f, 0x00, 0x0f, 0xc0, 0xbe, 0x00,
+  0x3f, 0x00, 0xbf, 0x80, 0xfc, 0x00, 0xbf, 0x83, 0xf0, 0x00, 0xbf, 0x8f, 0xc0, 0x00, 0xbf, 0xbf,
+  0x00, 0x00, 0xbf, 0x74, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x6f, 0xe4, 0x00,
+  0x00, 0xfe, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00,
+  0xbf, 0x90, 0x00, 0x00, 0xbf, 0xff, 0xf8, 0x00, 0xbf, 0xff, 0xf8, 0x00, 0xbf, 0xff, 0xf8, 0x00,
+  0x00, 0x1b, 0xf8, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x7f, 0x00, 0x00,
+  0x02, 0xfc, 0x00, 0x00, 0x6f, 0xe7, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf7,
+  0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x40, 0x6f, 0xfe, 0x40, 0x00, 0x2f, 0xe0, 0x00, 0x00,
+  0x7f, 0x40, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x77, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00,
+  0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f,
+  0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff,
+  0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x40,
+  0x00, 0x7f, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff, 0xfe, 0x02, 0xff, 0xff,
+  0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x77, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc,
+  0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00,
+  0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfd, 0x00, 0x01,
+  0xff, 0xf8, 0x00, 0x0b, 0xfb, 0xf8, 0x00, 0xbf, 0x8b, 0xf8, 0x0b, 0xf8, 0x0b, 0xf0, 0x3f, 0x80,
+  0x0b, 0xe2, 0xf8, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x77, 0xf0, 0x00,
+  0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03,
+  0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x1d, 0x03, 0xff,
+  0xc0, 0xfc, 0x0f, 0xff, 0x03, 0xf0, 0x3f, 0xfc, 0x0f, 0xc0, 0xff, 0xf0, 0x3f, 0x03, 0xff, 0xc0,
+  0xfc, 0x0f, 0xff, 0x03, 0xf0, 0x3f, 0xfc, 0x0f, 0xc0, 0xfe, 0xf8, 0x9d, 0x8b, 0xe2, 0xfd, 0x89,
+  0xfe, 0x02, 0xfc, 0x0f, 0xe0, 0x02, 0xd0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x77, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff,
+  0x40, 0x00, 0x7f, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x00, 0x2f, 0xe2, 0xfe, 0x02, 0xfe, 0x02, 0xfc,
+  0x0f, 0xe0, 0x02, 0xd8, 0x9e, 0x00, 0x00, 0x9d, 0x80, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x09, 0xd8,
+  0x00, 0x02, 0xd8, 0x9e, 0x00, 0x2f, 0xc0, 0xfe, 0x02, 0xfe, 0x02, 0xfe, 0x2f, 0xe0, 0x02, 0xfe,
+  0xfe, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0x74,
+  0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00,
+  0x00, 0x77, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00,
+  0xff, 0xf0, 0x00, 0x03, 0xff, 0xd0, 0x00, 0x1f, 0xff, 0x80, 0x00, 0xbf, 0xbf, 0x80, 0x0b, 0xf8,
+  0xbf, 0x80, 0xbf, 0x80, 0xbf, 0x03, 0xf8, 0x00, 0xbe, 0x2f, 0x80, 0x00, 0xbf, 0xf8, 0x00, 0x00,
+  0xbf, 0x80, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0xd7,
+  0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x0b, 0xe0, 0x00,
+  0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe,
+  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x02, 0xfe, 0x00, 0x00,
+  0x2f, 0x80, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x5f,
+  0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xff, 0x5f, 0xff, 0xfb, 0xff, 0xf7, 0xfe, 0x40, 0xfe, 0x00, 0x3f, 0x40, 0x0f,
+  0xc0, 0x03, 0xf0, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0xfc, 0x00, 0x3f,
+  0x00, 0x0f, 0xc0, 0x03, 0xf4, 0x00, 0xfe, 0x00, 0x3f, 0xe4, 0x0b, 0xff, 0xf5, 0xff, 0xff, 0x1b,
+  0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x02, 0xfe,
+  0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x02, 0xfe,
+  0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x02, 0xfe,
+  0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xf9, 0x3f, 0xff, 0xd7, 0xff, 0xf8, 0x06, 0xff, 0x00, 0x2f, 0xc0, 0x07, 0xf0,
+  0x00, 0xfc, 0x00, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0x0f, 0xc0,
+  0x03, 0xf0, 0x00, 0xfc, 0x00, 0x7f, 0x00, 0x2f, 0xc0, 0x6f, 0xf7, 0xff, 0xfb, 0xff, 0xfd, 0x7f,
+  0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0xbf, 0x80, 0x00,
+  0x0b, 0xff, 0x80, 0x00, 0xbe, 0x2f, 0x80, 0x0b, 0xf0, 0x3f, 0x80, 0xbf, 0x80, 0xbf, 0x8b, 0xf8,
+  0x00, 0xbf, 0xbf, 0x80, 0x00, 0xbf, 0x78, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff,
+  0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3f, 0x80,
+  0x0b, 0xf8, 0x00, 0xbf, 0x80, 0x0b, 0xf8, 0x00, 0xbf, 0x80, 0x0b, 0xf8, 0x00, 0xbf, 0x00, 0x0b,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xe0,
+  0x01, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0xbf, 0x02,
+  0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xef, 0x80, 0x00, 0xbf, 0xfc, 0x00,
+  0x00, 0xfe, 0xf8, 0x00, 0x0b, 0xf2, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xfd, 0x02, 0xff, 0xff,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03,
+  0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0,
+  0x00, 0x00, 0x0f, 0xc0, 0x7f, 0xe0, 0x3f, 0x03, 0xff, 0xe0, 0xfe, 0x2f, 0xff, 0xe3, 0xff, 0xf9,
+  0x6f, 0xef, 0xff, 0x80, 0x2f, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0x80, 0x00, 0xff, 0xf8, 0x00, 0x03,
+  0xff, 0xd0, 0x00, 0x0f, 0xff, 0x40, 0x00, 0x7f, 0xfe, 0x00, 0x02, 0xff, 0xfe, 0x40, 0x6f, 0xeb,
+  0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xe0, 0x1b, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xd0,
+  0x02, 0xff, 0xff, 0xc0, 0x2f, 0xff, 0xfd, 0x02, 0xfe, 0x40, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x3f,
+  0x40, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x40,
+  0x00, 0x2d, 0xfe, 0x00, 0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff, 0xfe, 0x02, 0xff, 0xff,
+  0xe0, 0x02, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x2f, 0xf4, 0x0f, 0xc2, 0xff, 0xf0, 0x3f, 0x2f, 0xff,
+  0xe2, 0xfe, 0xfe, 0x5b, 0xff, 0xff, 0xe0, 0x0b, 0xff, 0xff, 0x40, 0x0b, 0xff, 0xfc, 0x00, 0x0b,
+  0xff, 0xf0, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0x40, 0x00, 0x7f, 0xfe, 0x00, 0x02, 0xfe,
+  0xfe, 0x40, 0x6f, 0xf2, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xfd, 0x02, 0xff, 0xff, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2f, 0xff, 0xe0, 0x02, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff, 0xe2, 0xf8, 0x00, 0x0b, 0xef,
+  0xc0, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff,
+  0xff, 0xf9, 0x3f, 0x80, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x02, 0xf8, 0x00, 0x00, 0x02, 0xff, 0xff,
+  0xd0, 0x02, 0xff, 0xff, 0xc0, 0x02, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfe, 0x00, 0x00, 0xbf, 0xfe, 0x00, 0x0b, 0xff, 0xfe, 0x00,
+  0xbf, 0x96, 0xfe, 0x03, 0xf8, 0x02, 0xfc, 0x0f, 0xd0, 0x02, 0xd0, 0x7f, 0x40, 0x00, 0x02, 0xfe,
+  0x00, 0x00, 0x2f, 0xfe, 0x00, 0x02, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x2f, 0xff, 0xe0,
+  0x00, 0x2f, 0xfe, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x7f, 0x40, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x01,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xe4, 0x0b, 0xff, 0xff,
+  0xf4, 0xbf, 0xff, 0xff, 0xeb, 0xf9, 0x01, 0xbf, 0xff, 0x80, 0x00, 0xbf, 0xfd, 0x00, 0x01, 0xff,
+  0xf4, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x2f, 0xef, 0xe4, 0x06, 0xff, 0x2f, 0xff, 0xff, 0xfc, 0x2f,
+  0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0x0b, 0xe0, 0x1f, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0,
+  0x7f, 0xe0, 0x3f, 0x03, 0xff, 0xe0, 0xfe, 0x2f, 0xff, 0xe3, 0xff, 0xf9, 0x6f, 0xef, 0xff, 0x80,
+  0x2f, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0x80, 0x00, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xd0, 0x00, 0x0f,
+  0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff,
+  0x00, 0x00, 0x3f, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xd0, 0x00, 0xfc, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xe4, 0x03, 0xff, 0x40, 0xbf, 0xe0, 0x0b, 0xfc, 0x00, 0xbf, 0x00, 0x1f, 0xc0, 0x03, 0xf0, 0x00,
+  0xfc, 0x00, 0x3f, 0x00, 0x1f, 0xd0, 0x0b, 0xf8, 0x0b, 0xff, 0x8b, 0xff, 0xfb, 0xff, 0xff, 0x7f,
+  0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe4, 0x00, 0x0f, 0xfd,
+  0x00, 0x0b, 0xfe, 0x00, 0x02, 0xff, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x3f, 0x00,
+  0x00, 0x3f, 0x00, 0x00, 0x3f, 0x78, 0x00, 0x7f, 0xfe, 0x00, 0xbf, 0xbf, 0x96, 0xfe, 0x2f, 0xff,
+  0xf8, 0x0b, 0xff, 0xe0, 0x02, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x2d, 0xfc, 0x00, 0xbf, 0xfc, 0x02, 0xfe, 0xfc, 0x0b, 0xf8, 0xfc, 0x0f,
+  0xe0, 0xfe, 0x27, 0x80, 0xff, 0xd8, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xd8, 0x00, 0xfe, 0x27, 0x80,
+  0xfc, 0x0f, 0xe0, 0xfc, 0x0b, 0xf8, 0xfc, 0x02, 0xfe, 0xfc, 0x00, 0xbf, 0x74, 0x00, 0x2d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x40, 0x3f, 0xf4, 0x0b, 0xfe, 0x00, 0xbf,
+  0xc0, 0x0b, 0xf0, 0x01, 0xfc, 0x00, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0xfc, 0x00, 0x3f,
+  0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0x1f, 0xd0, 0x0b, 0xf8, 0x0b, 0xff,
+  0x8b, 0xff, 0xfb, 0xff, 0xff, 0x7f, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xbd, 0x01, 0xe0, 0x1f, 0xfc, 0x0f, 0xe0, 0xbf, 0xd8, 0x9f, 0xe3,
+  0xf8, 0x9d, 0x8b, 0xef, 0xc0, 0xfc, 0x0f, 0xff, 0x03, 0xf0, 0x3f, 0xfc, 0x0f, 0xc0, 0xff, 0xf0,
+  0x3f, 0x03, 0xff, 0xc0, 0x74, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00,
+  0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
+  0x7f, 0xe0, 0x3f, 0x03, 0xff, 0xe0, 0xfe, 0x2f, 0xff, 0xe3, 0xff, 0xf9, 0x6f, 0xef, 0xff, 0x80,
+  0x2f, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0x80, 0x00, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xd0, 0x00, 0x0f,
+  0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff,
+  0x00, 0x00, 0x3f, 0x74, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xe0, 0x02, 0xff, 0xff, 0xe0,
+  0x2f, 0xff, 0xff, 0xe2, 0xfe, 0x40, 0x6f, 0xef, 0xe0, 0x00, 0x2f, 0xff, 0x40, 0x00, 0x7f, 0xfc,
+  0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x40, 0x00, 0x7f, 0xfe, 0x00,
+  0x02, 0xfe, 0xfe, 0x40, 0x6f, 0xe2, 0xff, 0xff, 0xfe, 0x02, 0xff, 0xff, 0xe0, 0x02, 0xff, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xbf, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xe0, 0xbf, 0xff, 0xff, 0xe3, 0xf8, 0x00,
+  0x0b, 0xef, 0xc0, 0x00, 0x0f, 0xff, 0x80, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xfe,
+  0x0f, 0xff, 0xff, 0xe0, 0x3f, 0xe4, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xf9,
+  0x02, 0xff, 0xff, 0xfd, 0x2f, 0xff, 0xff, 0xfa, 0xf8, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0x0f, 0xef,
+  0x80, 0x00, 0xbf, 0x2f, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xc0, 0x00,
+  0x06, 0xff, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x7f, 0xe0, 0x3f, 0x03, 0xff, 0xe0, 0xfe, 0x2f,
+  0xff, 0xe3, 0xff, 0xf9, 0x6f, 0xef, 0xff, 0x80, 0x2f, 0xff, 0xf8, 0x00, 0x2d, 0xff, 0x80, 0x00,
+  0x03, 0xf8, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x03,
+  0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2f, 0xff, 0xd0, 0x02, 0xff, 0xff, 0xc0, 0x2f, 0xff, 0xfd, 0x02, 0xf8, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x00, 0x2f, 0xff, 0xfe, 0x00, 0x2f, 0xff, 0xfe, 0x00, 0x2f,
+  0xff, 0xfe, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x0b, 0xe7, 0xff, 0xff,
+  0xfe, 0x3f, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x01,
+  0xfd, 0x00, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0xbf, 0xf8, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x3f, 0xff,
+  0xf0, 0x00, 0xbf, 0xff, 0x80, 0x00, 0xbf, 0xf8, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x01, 0xfd, 0x00,
+  0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x2d,
+  0x03, 0xf8, 0x02, 0xfc, 0x0b, 0xf9, 0x6f, 0xe0, 0x0b, 0xff, 0xfe, 0x00, 0x0b, 0xff, 0xe0, 0x00,
+  0x0b, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0x7f, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff,
+  0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x01, 0xff, 0xf0,
+  0x00, 0x0b, 0xff, 0xc0, 0x00, 0xbf, 0xff, 0x40, 0x0b, 0xff, 0xfe, 0x00, 0xbf, 0xfe, 0xfe, 0x5b,
+  0xff, 0xf2, 0xff, 0xfe, 0x2f, 0xc2, 0xff, 0xf0, 0x3f, 0x02, 0xff, 0x40, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
+  0x00, 0x07, 0x7f, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00,
+  0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfd, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x0b, 0xfb, 0xf8, 0x00, 0xbf,
+  0x8b, 0xf8, 0x0b, 0xf8, 0x0b, 0xf0, 0x3f, 0x80, 0x0b, 0xe2, 0xf8, 0x00, 0x0b, 0xff, 0x80, 0x00,
+  0x0b, 0xf8, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07, 0x7f, 0x00, 0x00, 0x3f,
+  0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc,
+  0x07, 0x40, 0xff, 0xf0, 0x3f, 0x03, 0xff, 0xc0, 0xfc, 0x0f, 0xff, 0x03, 0xf0, 0x3f, 0xfc, 0x0f,
+  0xc0, 0xfe, 0xf8, 0x9d, 0x8b, 0xe2, 0xfd, 0x89, 0xfe, 0x02, 0xfc, 0x0f, 0xe0, 0x02, 0xd0, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x0b, 0x7f, 0x80, 0x00, 0xbf, 0xbf, 0x80, 0x0b, 0xf8, 0xbf, 0x80,
+  0xbf, 0x80, 0xbf, 0x03, 0xf8, 0x00, 0xb6, 0x27, 0x80, 0x00, 0x27, 0x60, 0x00, 0x00, 0x3f, 0x00,
+  0x00, 0x02, 0x76, 0x00, 0x00, 0xb6, 0x27, 0x80, 0x0b, 0xf0, 0x3f, 0x80, 0xbf, 0x80, 0xbf, 0x8b,
+  0xf8, 0x00, 0xbf, 0xbf, 0x80, 0x00, 0xbf, 0x78, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00, 0x07,
+  0x7f, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x2f, 0xef,
+  0xe4, 0x06, 0xff, 0x2f, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff, 0xc0, 0x00,
+  0x00, 0xbf, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x0b, 0xe0, 0x1f, 0xff, 0xfe, 0x00, 0xff, 0xff,
+  0xe0, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff,
+  0xff, 0xf8, 0x00, 0x02, 0xff, 0x80, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x0b, 0xf8,
+  0x00, 0x00, 0xbf, 0x80, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,
+  0xbf, 0xe0, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x40, 0x0b, 0xf0, 0x0b,
+  0xf8, 0x0b, 0xf8, 0x03, 0xf8, 0x00, 0xfd, 0x00, 0x7f, 0x00, 0x2f, 0xc0, 0x2f, 0xd0, 0x2f, 0x80,
+  0x0f, 0xc0, 0x02, 0xf8, 0x00, 0x2f, 0xd0, 0x02, 0xfc, 0x00, 0x7f, 0x00, 0x0f, 0xd0, 0x03, 0xf8,
+  0x00, 0xbf, 0x80, 0x0b, 0xf8, 0x00, 0xbf, 0x00, 0x0b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74,
+  0x00, 0x00, 0x78, 0x00, 0x3f, 0x80, 0x0b, 0xf8, 0x00, 0xbf, 0x80, 0x0b, 0xf0, 0x01, 0xfc, 0x00,
+  0x3f, 0x40, 0x0f, 0xe0, 0x01, 0xfe, 0x00, 0x0b, 0xe0, 0x00, 0xfc, 0x00, 0xbe, 0x01, 0xfe, 0x00,
+  0xfe, 0x00, 0x3f, 0x40, 0x1f, 0xc0, 0x0b, 0xf0, 0x0b, 0xf8, 0x0b, 0xf8, 0x03, 0xf8, 0x00, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfd, 0x01, 0xd0, 0xbf, 0xfc,
+  0x0f, 0xcb, 0xff, 0xf8, 0xbe, 0xbf, 0x96, 0xff, 0xe3, 0xf8, 0x02, 0xfe, 0x07, 0x80, 0x02, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+};
+
+/** @const Font */
+const struct S_FONT FONT_24_AA PROGMEM = {
+  .height = 24,
+  .first = 0x20,
+  .last = 0x7e,
+  .spacing = 3,
+  .bpp = 2,
+  .widths = FONT_24_AA_WIDTHS,
+  .offsets = FONT_24_AA_OFFSETS,
+  .bitmap = FONT_24_AA_BITMAP
+};
@@ -0,0 +1,77 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       FONT_8 8px proportional font, 1 bpp
+ * ---------------------------------------------------------------+ 
+ * @file        font_8.c
+ * @source      src/font.c
+ *
+ * @notes       generated by tools/bdf2font.py, do not edit
+ *              flash 710 bytes
+ * ---------------------------------------------------------------+
+ */
+#include "../font.h"
+
+/** @array Glyph widths */
+static const uint8_t FONT_8_WIDTHS[] PROGMEM = {
+  2, 5, 3, 5, 5, 5, 5, 2, 3, 3, 5, 5, 2, 5, 2, 5,
+  5, 3, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2, 4, 5, 4, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 5, 3, 5, 5,
+  3, 5, 5, 5, 5, 5, 5, 5, 5, 3, 4, 4, 3, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 1, 3, 5,
+};
+
+/** @array Glyph offsets into bitmap */
+static const uint16_t FONT_8_OFFSETS[] PROGMEM = {
+  0, 2, 7, 10, 15, 20, 25, 30, 32, 35, 38, 43,
+  48, 50, 55, 57, 62, 67, 70, 75, 80, 85, 90, 95,
+  100, 105, 110, 112, 114, 118, 123, 127, 132, 137, 142, 147,
+  152, 157, 162, 167, 172, 177, 180, 185, 190, 195, 200, 205,
+  210, 215, 220, 225, 230, 235, 240, 245, 250, 255, 260, 265,
+  268, 273, 276, 281, 286, 289, 294, 299, 304, 309, 314, 319,
+  324, 329, 332, 336, 340, 343, 348, 353, 358, 363, 368, 373,
+  378, 383, 388, 393, 398, 403, 408, 413, 416, 417, 420,
+};
+
+/** @array Glyph bitmap, row by row, MSB first, 1 bpp */
+static const uint8_t FONT_8_BITMAP[] PROGMEM = {
+  0x00, 0x00, 0xd8, 0x00, 0x42, 0x00, 0x1b, 0xb6, 0x80, 0x00, 0x52, 0xbe, 0xaf, 0xa9, 0x40, 0x23,
+  0xe8, 0xe2, 0xf8, 0x80, 0xc6, 0x44, 0x44, 0x4c, 0x60, 0x64, 0xa8, 0x8a, 0xc9, 0xa0, 0xd8, 0x00,
+  0x2a, 0x48, 0x88, 0x88, 0x92, 0xa0, 0x01, 0x2a, 0xea, 0x90, 0x00, 0x01, 0x09, 0xf2, 0x10, 0x00,
+  0x00, 0xd8, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x44, 0x44, 0x40, 0x00, 0x74, 0x67,
+  0x5c, 0xc5, 0xc0, 0x59, 0x24, 0xb8, 0x74, 0x42, 0x22, 0x23, 0xe0, 0xf8, 0x88, 0x20, 0xc5, 0xc0,
+  0x11, 0x95, 0x2f, 0x88, 0x40, 0xfc, 0x3c, 0x10, 0xc5, 0xc0, 0x32, 0x21, 0xe8, 0xc5, 0xc0, 0xf8,
+  0x44, 0x44, 0x21, 0x00, 0x74, 0x62, 0xe8, 0xc5, 0xc0, 0x74, 0x62, 0xf0, 0x89, 0x80, 0x3c, 0xf0,
+  0x3c, 0xd8, 0x12, 0x48, 0x42, 0x10, 0x00, 0x3e, 0x0f, 0x80, 0x00, 0x84, 0x21, 0x24, 0x80, 0x74,
+  0x42, 0x22, 0x00, 0x80, 0x74, 0x42, 0xda, 0xd5, 0xc0, 0x74, 0x63, 0x1f, 0xc6, 0x20, 0xf4, 0x63,
+  0xe8, 0xc7, 0xc0, 0x74, 0x61, 0x08, 0x45, 0xc0, 0xe4, 0xa3, 0x18, 0xcb, 0x80, 0xfc, 0x21, 0xe8,
+  0x43, 0xe0, 0xfc, 0x21, 0xe8, 0x42, 0x00, 0x74, 0x61, 0x78, 0xc5, 0xe0, 0x8c, 0x63, 0xf8, 0xc6,
+  0x20, 0xe9, 0x24, 0xb8, 0x38, 0x84, 0x21, 0x49, 0x80, 0x8c, 0xa9, 0x8a, 0x4a, 0x20, 0x84, 0x21,
+  0x08, 0x43, 0xe0, 0x8e, 0xeb, 0x58, 0xc6, 0x20, 0x8c, 0x73, 0x59, 0xc6, 0x20, 0x74, 0x63, 0x18,
+  0xc5, 0xc0, 0xf4, 0x63, 0xe8, 0x42, 0x00, 0x74, 0x63, 0x1a, 0xc9, 0xa0, 0xf4, 0x63, 0xea, 0x4a,
+  0x20, 0x7c, 0x20, 0xe0, 0x87, 0xc0, 0xf9, 0x08, 0x42, 0x10, 0x80, 0x8c, 0x63, 0x18, 0xc5, 0xc0,
+  0x8c, 0x63, 0x18, 0xa8, 0x80, 0x8c, 0x63, 0x5a, 0xd5, 0x40, 0x8c, 0x54, 0x45, 0x46, 0x20, 0x8c,
+  0x62, 0xa2, 0x10, 0x80, 0xf8, 0x44, 0x44, 0x43, 0xe0, 0xf2, 0x49, 0x38, 0x04, 0x10, 0x41, 0x04,
+  0x00, 0xe4, 0x92, 0x78, 0x22, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x88, 0x80,
+  0x00, 0x00, 0x1c, 0x17, 0xc5, 0xe0, 0x84, 0x2d, 0x98, 0xc7, 0xc0, 0x00, 0x1d, 0x08, 0x45, 0xc0,
+  0x08, 0x5b, 0x38, 0xc5, 0xe0, 0x00, 0x1d, 0x1f, 0xc1, 0xc0, 0x32, 0x51, 0xc4, 0x21, 0x00, 0x03,
+  0xe3, 0x17, 0x85, 0xc0, 0x84, 0x2d, 0x98, 0xc6, 0x20, 0x43, 0x24, 0xb8, 0x10, 0x31, 0x19, 0x60,
+  0x88, 0x9a, 0xca, 0x90, 0xc9, 0x24, 0xb8, 0x00, 0x35, 0x5a, 0xc6, 0x20, 0x00, 0x2d, 0x98, 0xc6,
+  0x20, 0x00, 0x1d, 0x18, 0xc5, 0xc0, 0x00, 0x3d, 0x1f, 0x42, 0x00, 0x00, 0x1f, 0x17, 0x84, 0x20,
+  0x00, 0x2d, 0x98, 0x42, 0x00, 0x00, 0x1d, 0x07, 0x07, 0xc0, 0x42, 0x38, 0x84, 0x24, 0xc0, 0x00,
+  0x23, 0x18, 0xcd, 0xa0, 0x00, 0x23, 0x18, 0xa8, 0x80, 0x00, 0x23, 0x1a, 0xd5, 0x40, 0x00, 0x22,
+  0xa2, 0x2a, 0x20, 0x00, 0x23, 0x17, 0x85, 0xc0, 0x00, 0x3e, 0x22, 0x23, 0xe0, 0x29, 0x44, 0x88,
+  0xfe, 0x89, 0x14, 0xa0, 0x00, 0x00, 0xd9, 0x00, 0x00,
+};
+
+/** @const Font */
+const struct S_FONT FONT_8 PROGMEM = {
+  .height = 8,
+  .first = 0x20,
+  .last = 0x7e,
+  .spacing = 1,
+  .bpp = 1,
+  .widths = FONT_8_WIDTHS,
+  .offsets = FONT_8_OFFSETS,
+  .bitmap = FONT_8_BITMAP
+};
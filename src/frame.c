@@ -0,0 +1,522 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Frame Buffer
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        frame.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      frame.h, st7789.h, pixel.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#define HAL_BACKEND                                     // calls go to bus
+#include "st7789.h"
+#include "pixel.h"
+
+#if defined(ST7789_FRAMEBUFFER)
+
+#define HAL_FRAME_PIXELS      (ST7789_WIDTH * ST7789_HEIGHT)
+#define HAL_FRAME_CLEAN       0xFFFF                    // left end of row without changes
+
+/** @var Display RAM drawn & last sent, row by row */
+static uint16_t frame[HAL_FRAME_PIXELS];
+static uint16_t shadow[HAL_FRAME_PIXELS];
+
+/** @var Changed columns of rows since last flush, left > right = none */
+static uint16_t left[ST7789_HEIGHT];
+static uint16_t right[ST7789_HEIGHT];
+
+/** @var Window of last flush, CASET / RASET / RAMWR */
+static uint8_t windowBytes[11] = { ST77XX_CASET, 0, 0, 0, 0, ST77XX_RASET, 0, 0, 0, 0, ST77XX_RAMWR };
+
+/** @struct Decoder of driver bytes */
+static struct {
+  struct signal * cs;                                   // chip select of panel
+  struct signal * dc;                                   // data / command of panel
+  uint8_t selected;                                     // chip select active
+  uint8_t level;                                        // DC level
+  uint8_t command;                                      // last command
+  uint8_t capture;                                      // command decoded, not sent
+  uint8_t count;                                        // arguments of CASET / RASET
+  uint8_t arguments[4];
+  uint8_t high;                                         // high byte of pixel
+  uint8_t half;                                         // high byte received
+  uint8_t read;                                         // RAMRD, 0 = dummy, 1..3 = R, G, B
+  uint8_t valid;                                        // shadow equals panel
+  uint16_t xs, xe, ys, ye;                              // window
+  uint16_t x, y;                                        // memory pointer
+  uint16_t stride;                                      // columns of RAM
+  uint16_t rows;                                        // rows of RAM
+} Frame;
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+/* Memory pointer to next pixel, wraps in window */
+static void HAL_Frame_Next (uint16_t count)
+{
+  Frame.x += count;
+  if (Frame.x > Frame.xe) {
+    Frame.x = Frame.xs;
+    Frame.y = (Frame.y >= Frame.ye) ? Frame.ys : Frame.y + 1;
+  }
+}
+
+/* Pixels from words or one value repeated into window, split by rows */
+static void HAL_Frame_Pixels (const uint16_t * words, uint16_t value, uint32_t count)
+{
+  uint16_t * pixel;
+  uint16_t run;
+
+  if ((Frame.xs > Frame.xe) || (Frame.ys > Frame.ye)) {
+    return;                                             // panel ignores invalid window
+  }
+  while (count) {
+    run = Frame.xe - Frame.x + 1;                       // rest of row in window
+    if (run > count) {
+      run = count;
+    }
+    if ((Frame.y < Frame.rows) && (Frame.xe < Frame.stride)) {
+      pixel = &frame[(uint32_t) Frame.y * Frame.stride + Frame.x];
+      if (words != NULL) {
+        memcpy (pixel, words, run << 1);
+      } else {
+        ST7789_Pixel_Fill (pixel, value, run);
+      }
+      if (Frame.x < left[Frame.y]) {
+        left[Frame.y] = Frame.x;
+      }
+      if (Frame.x + run - 1 > right[Frame.y]) {
+        right[Frame.y] = Frame.x + run - 1;
+      }
+    }
+    if (words != NULL) {
+      words += run;
+    }
+    count -= run;
+    HAL_Frame_Next (run);
+  }
+}
+
+/* RAM geometry of MADCTL, content of other geometry is not valid */
+static void HAL_Frame_Geometry (uint8_t madctl)
+{
+  Frame.stride = (madctl & ST77XX_XY_CHANGE) ? ST7789_HEIGHT : ST7789_WIDTH;
+  Frame.rows = HAL_FRAME_PIXELS / Frame.stride;
+  Frame.valid = 0;
+}
+
+/* Byte of selected panel, returns 0 if not for frame */
+static uint8_t HAL_Frame_Decode (uint8_t data)
+{
+  uint16_t start, end;
+
+  if (!Frame.level) {
+    Frame.command = data;                               // command
+    Frame.count = 0;
+    Frame.half = 0;
+    Frame.capture = (data == ST77XX_CASET) || (data == ST77XX_RASET) || (data == ST77XX_RAMWR) ||
+                    (data == ST77XX_RAMWRC) || (data == ST77XX_RAMRD);
+    if ((data == ST77XX_RAMWR) || (data == ST77XX_RAMRD)) {
+      Frame.x = Frame.xs;                               // pointer to start of window
+      Frame.y = Frame.ys;
+      Frame.read = 0;
+    }
+    return Frame.capture;
+  }
+  if (!Frame.capture) {
+    if (Frame.command == ST77XX_MADCTL) {
+      HAL_Frame_Geometry (data);
+    }
+    return 0;                                           // argument of other command
+  }
+
+  // pixels
+  // --------------------------------------
+  if ((Frame.command == ST77XX_RAMWR) || (Frame.command == ST77XX_RAMWRC)) {
+    if (!Frame.half) {
+      Frame.high = data;
+      Frame.half = 1;
+    } else {
+      Frame.half = 0;
+      HAL_Frame_Pixels (NULL, ((uint16_t) Frame.high << 8) | data, 1);
+    }
+  // window
+  // --------------------------------------
+  } else if ((Frame.command != ST77XX_RAMRD) && (Frame.count < 4)) {
+    Frame.arguments[Frame.count++] = data;
+    if (Frame.count == 4) {
+      start = ((uint16_t) Frame.arguments[0] << 8) | Frame.arguments[1];
+      end = ((uint16_t) Frame.arguments[2] << 8) | Frame.arguments[3];
+      if (Frame.command == ST77XX_CASET) {
+        Frame.xs = start;
+        Frame.xe = end;
+      } else {
+        Frame.ys = start;
+        Frame.ye = end;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Pixel data of memory write follows */
+static inline uint8_t HAL_Frame_Memory (void)
+{
+  return Frame.selected && Frame.level && !Frame.half &&
+         ((Frame.command == ST77XX_RAMWR) || (Frame.command == ST77XX_RAMWRC));
+}
+
+/* Changed columns of row, cleared after, whole drawn part while shadow is not valid */
+static uint8_t HAL_Frame_Span (uint16_t y, uint16_t * xs, uint16_t * xe)
+{
+  const uint16_t * row = &frame[(uint32_t) y * Frame.stride];
+  const uint16_t * sent = &shadow[(uint32_t) y * Frame.stride];
+  uint16_t l = left[y];
+  uint16_t r = right[y];
+
+  left[y] = HAL_FRAME_CLEAN;
+  right[y] = 0;
+  if (l > r) {
+    return 0;                                           // not drawn
+  }
+  if (Frame.valid) {
+    while ((l <= r) && (row[l] == sent[l])) {
+      l++;
+    }
+    if (l > r) {
+      return 0;                                         // drawn, but same as on panel
+    }
+    while (row[r] == sent[r]) {
+      r--;
+    }
+  }
+  *xs = l;
+  *xe = r;
+
+  return 1;
+}
+
+/* Rectangle of frame to panel & shadow */
+static void HAL_Frame_Send (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
+{
+  struct S_HAL_CHUNK chunks[6];
+  uint16_t width = xe - xs + 1;
+  uint32_t start = (uint32_t) ys * Frame.stride + xs;
+  uint16_t y;
+
+  HAL_Wait ();                                          // last rectangle may be still on bus
+  windowBytes[1] = (uint8_t) (xs >> 8);
+  windowBytes[2] = (uint8_t) xs;
+  windowBytes[3] = (uint8_t) (xe >> 8);
+  windowBytes[4] = (uint8_t) xe;
+  windowBytes[6] = (uint8_t) (ys >> 8);
+  windowBytes[7] = (uint8_t) ys;
+  windowBytes[8] = (uint8_t) (ye >> 8);
+  windowBytes[9] = (uint8_t) ye;
+  chunks[0] = (struct S_HAL_CHUNK) { &windowBytes[0], 1, 0, HAL_CHUNK_COMMAND };
+  chunks[1] = (struct S_HAL_CHUNK) { &windowBytes[1], 4, 0, HAL_CHUNK_DATA };
+  chunks[2] = (struct S_HAL_CHUNK) { &windowBytes[5], 1, 0, HAL_CHUNK_COMMAND };
+  chunks[3] = (struct S_HAL_CHUNK) { &windowBytes[6], 4, 0, HAL_CHUNK_DATA };
+  chunks[4] = (struct S_HAL_CHUNK) { &windowBytes[10], 1, 0, HAL_CHUNK_COMMAND };
+  chunks[5] = (struct S_HAL_CHUNK) { &frame[start], width, 0, HAL_CHUNK_PIXELS };
+
+  if (width == Frame.stride) {
+    chunks[5].length *= (uint32_t) (ye - ys + 1);       // whole rows, one chunk
+    HAL_Write_Chunks (lcd->dc, chunks, 6);
+    memcpy (&shadow[start], &frame[start], chunks[5].length << 1);
+    return;
+  }
+  HAL_Write_Chunks (lcd->dc, chunks, 6);                // window & first row
+  for (y = ys; y <= ye; y++) {
+    if (y != ys) {
+      chunks[5].data = &frame[start];
+      HAL_Write_Chunks (lcd->dc, &chunks[5], 1);        // next row
+    }
+    memcpy (&shadow[start], &frame[start], width << 1);
+    start += Frame.stride;
+  }
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Panel of frame, called by ST7789_Init
+ *
+ * @param   struct signal * cs
+ * @param   struct signal * dc
+ *
+ * @return  void
+ */
+void HAL_Frame_Panel (struct signal * cs, struct signal * dc)
+{
+  uint16_t y;
+
+  Frame.cs = cs;
+  Frame.dc = dc;
+  Frame.selected = 0;
+  Frame.level = 1;
+  Frame.capture = 0;
+  HAL_Frame_Geometry (0);
+  for (y = 0; y < ST7789_HEIGHT; y++) {
+    left[y] = HAL_FRAME_CLEAN;
+    right[y] = 0;
+  }
+}
+
+/**
+ * @desc    Send rectangles changed since last flush
+ *
+ *          Changed columns of neighbouring rows are merged while they
+ *          overlap, each rectangle is one window & RAMWR burst
+ *
+ * @param   struct st7789 *
+ *
+ * @return  void
+ */
+void ST7789_Flush (struct st7789 * lcd)
+{
+  uint16_t xs = 0, xe = 0, ys = 0;
+  uint16_t l, r, y;
+  uint8_t changed, open = 0;
+
+  HAL_Pin_Clear (lcd->cs);                              // chip enable - active low
+  for (y = 0; y < Frame.rows; y++) {
+    changed = HAL_Frame_Span (y, &l, &r);
+    if (open && (!changed || (l > xe) || (r < xs))) {
+      HAL_Frame_Send (lcd, xs, xe, ys, y - 1);          // rectangle ends above
+      open = 0;
+    }
+    if (changed && !open) {
+      xs = l;                                           // new rectangle
+      xe = r;
+      ys = y;
+      open = 1;
+    } else if (changed) {
+      xs = (l < xs) ? l : xs;                           // grow rectangle
+      xe = (r > xe) ? r : xe;
+    }
+  }
+  if (open) {
+    HAL_Frame_Send (lcd, xs, xe, ys, Frame.rows - 1);
+  }
+  HAL_Wait ();
+  HAL_Pin_Set (lcd->cs);                                // chip disable - idle high
+  Frame.valid = 1;
+}
+
+/**
+ * @desc    Pin high
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void HAL_Frame_Pin_Set (struct signal * signal)
+{
+  HAL_Pin_Set (signal);
+  if (signal == Frame.cs) {
+    Frame.selected = 0;
+  }
+  if (signal == Frame.dc) {
+    Frame.level = 1;
+  }
+}
+
+/**
+ * @desc    Pin low
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void HAL_Frame_Pin_Clear (struct signal * signal)
+{
+  HAL_Pin_Clear (signal);
+  if (signal == Frame.cs) {
+    Frame.selected = 1;
+  }
+  if (signal == Frame.dc) {
+    Frame.level = 0;
+  }
+}
+
+/**
+ * @desc    Write byte, window & pixels to frame, rest to bus
+ *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void HAL_Frame_Write_Byte (uint8_t data)
+{
+  if (!Frame.selected || !HAL_Frame_Decode (data)) {
+    HAL_Write_Byte (data);
+  }
+}
+
+/**
+ * @desc    Byte in & out, RAMRD answered from frame, RAMWR byte to frame
+ *          while bus is clocked for other device (flash pass-through)
+ *
+ * @param   uint8_t
+ *
+ * @return  uint8_t
+ */
+uint8_t HAL_Frame_Transfer (uint8_t data)
+{
+  uint16_t pixel = 0;
+  uint8_t answer;
+
+  if (Frame.selected && Frame.level && ((Frame.command == ST77XX_RAMWR) || (Frame.command == ST77XX_RAMWRC))) {
+    HAL_Frame_Decode (data);                            // pixel byte to frame
+    HAL_Pin_Set (Frame.cs);                             // panel released on bus
+    answer = HAL_Transfer (data);
+    HAL_Pin_Clear (Frame.cs);
+    return answer;
+  }
+  if (!Frame.selected || !Frame.level || (Frame.command != ST77XX_RAMRD)) {
+    return HAL_Transfer (data);
+  }
+  if (Frame.read == 0) {
+    Frame.read = 1;                                     // dummy byte
+    return 0;
+  }
+  if ((Frame.y < Frame.rows) && (Frame.x < Frame.stride)) {
+    pixel = frame[(uint32_t) Frame.y * Frame.stride + Frame.x];
+  }
+  if (Frame.read == 1) {
+    answer = (pixel >> 8) & 0xF8;                       // red, 6 bits left aligned
+  } else if (Frame.read == 2) {
+    answer = (pixel >> 3) & 0xFC;                       // green
+  } else {
+    answer = (pixel << 3) & 0xF8;                       // blue
+    HAL_Frame_Next (1);
+  }
+  Frame.read = (Frame.read == 3) ? 1 : Frame.read + 1;
+
+  return answer;
+}
+
+/**
+ * @desc    Bytes in & out, RAMRD answered from frame
+ *
+ * @param   uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void HAL_Frame_Read (uint8_t * data, uint16_t length)
+{
+  if (!Frame.selected) {
+    HAL_Read (data, length);
+    return;
+  }
+  while (length--) {
+    *data = HAL_Frame_Transfer (*data);
+    data++;
+  }
+}
+
+/**
+ * @desc    Write bytes
+ *
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void HAL_Frame_Write (const uint8_t * data, uint16_t length)
+{
+  if (!Frame.selected) {
+    HAL_Write (data, length);
+    return;
+  }
+  while (length--) {
+    HAL_Frame_Write_Byte (*data++);
+  }
+}
+
+/**
+ * @desc    Write 16 bit value repeatedly, high byte first
+ *
+ * @param   uint16_t value
+ * @param   uint32_t count
+ *
+ * @return  void
+ */
+void HAL_Frame_Write_Repeat (uint16_t value, uint32_t count)
+{
+  if (HAL_Frame_Memory ()) {
+    HAL_Frame_Pixels (NULL, value, count);
+  } else if (!Frame.selected) {
+    HAL_Write_Repeat (value, count);
+  } else {
+    while (count--) {
+      HAL_Frame_Write_Byte ((uint8_t) (value >> 8));
+      HAL_Frame_Write_Byte ((uint8_t) value);
+    }
+  }
+}
+
+/**
+ * @desc    Write list of chunks
+ *
+ * @param   struct signal * dc
+ * @param   const struct S_HAL_CHUNK * chunks
+ * @param   uint8_t count
+ *
+ * @return  void
+ */
+void HAL_Frame_Write_Chunks (struct signal * dc, const struct S_HAL_CHUNK * chunk, uint8_t count)
+{
+  const uint8_t * data;
+  uint32_t length;
+  uint8_t bus;
+
+  if (!Frame.selected) {
+    HAL_Write_Chunks (dc, chunk, count);
+    return;
+  }
+  while (count--) {
+    Frame.level = (chunk->type != HAL_CHUNK_COMMAND);
+    if ((chunk->type == HAL_CHUNK_PIXELS) && HAL_Frame_Memory ()) {
+      HAL_Frame_Pixels (chunk->data, 0, chunk->length);
+    } else if ((chunk->type == HAL_CHUNK_REPEAT) && HAL_Frame_Memory ()) {
+      HAL_Frame_Pixels (NULL, chunk->value, chunk->length);
+    } else if (chunk->type >= HAL_CHUNK_PIXELS) {
+      HAL_Write_Chunks (dc, chunk, 1);                  // pixels of other command
+    } else {
+      data = chunk->data;
+      length = chunk->length;
+      bus = 0;
+      while (length--) {
+        bus |= !HAL_Frame_Decode (*data++);
+      }
+      if (bus) {
+        HAL_Write_Chunks (dc, chunk, 1);                // arguments of other command
+      }
+    }
+    chunk++;
+  }
+  if (Frame.level) {
+    HAL_Pin_Set (dc);                                   // DC of last chunk
+  } else {
+    HAL_Pin_Clear (dc);
+  }
+}
+
+#endif
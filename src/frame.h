@@ -0,0 +1,95 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Frame Buffer
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        frame.h
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      hal.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Shadow of display RAM, compiled in only with -DST7789_FRAMEBUFFER
+ *              (make host FRAME=1), needs 2 x 150 kB + 1 kB of RAM
+ *
+ *              Driver byte functions of HAL are redirected here. CASET, RASET,
+ *              RAMWR, RAMWRC & RAMRD are decoded into the frame in RAM, other
+ *              commands pass through to the bus, so every primitive draws into
+ *              memory unchanged. Nothing appears on the panel until
+ *
+ *                ST7789_Flush (&lcd);
+ *
+ *              compares changed rows with the last sent frame & sends changed
+ *              rectangles by CASET / RASET / RAMWR. First flush after init or
+ *              rotation sends all drawn rows, clear screen before it.
+ *
+ *              Files implementing HAL define HAL_BACKEND before includes.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __FRAME_H__
+#define __FRAME_H__
+
+  #include <stdint.h>
+  #include "hal.h"
+
+#if defined(ST7789_FRAMEBUFFER)
+
+  struct st7789;
+
+  /**
+   * @desc    Panel of frame, called by ST7789_Init
+   *
+   * @param   struct signal * cs
+   * @param   struct signal * dc
+   *
+   * @return  void
+   */
+  void HAL_Frame_Panel (struct signal *, struct signal *);
+
+  /**
+   * @desc    Send rectangles changed since last flush
+   *
+   * @param   struct st7789 *
+   *
+   * @return  void
+   */
+  void ST7789_Flush (struct st7789 *);
+
+  /* Pin high */
+  void HAL_Frame_Pin_Set (struct signal *);
+  /* Pin low */
+  void HAL_Frame_Pin_Clear (struct signal *);
+  /* Write byte */
+  void HAL_Frame_Write_Byte (uint8_t);
+  /* Byte in & out */
+  uint8_t HAL_Frame_Transfer (uint8_t);
+  /* Bytes in & out */
+  void HAL_Frame_Read (uint8_t *, uint16_t);
+  /* Write bytes */
+  void HAL_Frame_Write (const uint8_t *, uint16_t);
+  /* Write 16 bit value repeatedly */
+  void HAL_Frame_Write_Repeat (uint16_t, uint32_t);
+  /* Write list of chunks */
+  void HAL_Frame_Write_Chunks (struct signal *, const struct S_HAL_CHUNK *, uint8_t);
+
+  // Driver draws into frame
+  // -----------------------------------
+  #if !defined(HAL_BACKEND)
+    #define HAL_Pin_Set         HAL_Frame_Pin_Set
+    #define HAL_Pin_Clear       HAL_Frame_Pin_Clear
+    #define HAL_Write_Byte      HAL_Frame_Write_Byte
+    #define HAL_Transfer        HAL_Frame_Transfer
+    #define HAL_Read            HAL_Frame_Read
+    #define HAL_Write           HAL_Frame_Write
+    #define HAL_Write_Repeat    HAL_Frame_Write_Repeat
+    #define HAL_Write_Chunks    HAL_Frame_Write_Chunks
+  #endif
+
+#endif
+
+#endif
@@ -0,0 +1,165 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Hardware Abstraction
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        hal.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      hal/hal_avr.h, hal/hal_mock.h, hal/hal_spidev.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Everything the driver needs from the target:
+ *
+ *                struct signal           pin of the target
+ *                HAL_Pin_Output / Set / Clear
+ *                HAL_Write_Byte          one byte, panel ignores answer
+ *                HAL_Transfer            one byte in & out (RAMRD, flash)
+ *                HAL_Read                bytes in & out, full duplex (RAMRD)
+ *                HAL_Write               bytes, may complete asynchronously
+ *                HAL_Write_Repeat        one 16 bit value count times, big endian
+ *                HAL_Write_Chunks        list of chunks, DC driven per chunk
+ *                HAL_Wait                wait for asynchronous writes
+ *                HAL_Speed               slower clock for reads
+ *                HAL_Delay_ms
+ *
+ *              The backend is chosen by target: AVR builds get hal/hal_avr.h with
+ *              pins & bytes inlined, anything else gets hal/hal_mock.h, a panel
+ *              model in RAM for host builds (make host), or hal/hal_spidev.h with
+ *              ST7789_HAL_SPIDEV (make host HOST_HAL=spidev). Backend header defines
+ *              struct signal & the inline part, the rest is in hal/hal_*.c.
+ *
+ *              Asynchronous backends return from HAL_Write, HAL_Write_Repeat &
+ *              HAL_Write_Chunks before the last byte is on the bus, the data must
+ *              stay valid until HAL_Wait. Driver calls HAL_Wait before DC or CS
+ *              change, byte functions of backend wait by themselves.
+ *
+ *              Chunk list is scatter-gather of one window: command bytes, window
+ *              bytes, RAMWR and pixels or pixel pattern. Backends with DMA turn
+ *              it into one chained transfer, others loop over it. Descriptors
+ *              are read before HAL_Write_Chunks returns.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __HAL_H__
+#define __HAL_H__
+
+  #include <stdint.h>
+
+  // Speed of bus
+  // -----------------------------------
+  #define HAL_SPEED_WRITE       0x00                    // full speed
+  #define HAL_SPEED_READ        0x01                    // read cycle of panel is slower
+
+  // Type of chunk
+  // -----------------------------------
+  #define HAL_CHUNK_COMMAND     0x00                    // bytes with DC low
+  #define HAL_CHUNK_DATA        0x01                    // bytes with DC high
+  #define HAL_CHUNK_PIXELS      0x02                    // 16 bit words, high byte first
+  #define HAL_CHUNK_REPEAT      0x03                    // value repeated, high byte first
+
+#if defined(__AVR__)
+
+  #include "hal/hal_avr.h"
+
+#else
+
+  // program memory is plain memory on host
+  // -----------------------------------
+  #include <string.h>
+
+  #define PROGMEM
+  #define pgm_read_byte(addr)   (*(const uint8_t *) (addr))
+  #define pgm_read_word(addr)   (*(const uint16_t *) (addr))
+  #define pgm_read_ptr(addr)    (*(const void * const *) (addr))
+  #define memcpy_P              memcpy
+
+  #if defined(ST7789_HAL_SPIDEV)
+    #include "hal/hal_spidev.h"
+  #else
+    #include "hal/hal_mock.h"
+  #endif
+
+#endif
+
+  /** @struct Chunk of transfer */
+  struct S_HAL_CHUNK {
+    const void * data;                                  // bytes or words, unused by repeat
+    uint32_t length;                                    // bytes, words or repeats
+    uint16_t value;                                     // repeated word
+    uint8_t type;                                       // HAL_CHUNK_*
+  };
+
+  /**
+   * @desc    Init bus
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void HAL_Init (void);
+
+  /**
+   * @desc    Write bytes
+   *
+   * @param   const uint8_t * data
+   * @param   uint16_t length
+   *
+   * @return  void
+   */
+  void HAL_Write (const uint8_t *, uint16_t);
+
+  /**
+   * @desc    Bytes in & out, full duplex, each byte sent is replaced by answer
+   *
+   * @param   uint8_t * data
+   * @param   uint16_t length
+   *
+   * @return  void
+   */
+  void HAL_Read (uint8_t *, uint16_t);
+
+  /**
+   * @desc    Write 16 bit value repeatedly, high byte first
+   *
+   * @param   uint16_t value
+   * @param   uint32_t count
+   *
+   * @return  void
+   */
+  void HAL_Write_Repeat (uint16_t, uint32_t);
+
+  /**
+   * @desc    Write list of chunks, DC set by type of chunk & left at last one
+   *
+   * @param   struct signal * dc
+   * @param   const struct S_HAL_CHUNK * chunks
+   * @param   uint8_t count
+   *
+   * @return  void
+   */
+  void HAL_Write_Chunks (struct signal *, const struct S_HAL_CHUNK *, uint8_t);
+
+  /**
+   * @desc    Bus speed
+   *
+   * @param   uint8_t HAL_SPEED_WRITE / HAL_SPEED_READ
+   *
+   * @return  void
+   */
+  void HAL_Speed (uint8_t);
+
+  /**
+   * @desc    Delay
+   *
+   * @param   uint16_t time in milliseconds
+   *
+   * @return  void
+   */
+  void HAL_Delay_ms (uint16_t);
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Hardware Abstraction - AVR
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        hal_avr.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      hal.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#define HAL_BACKEND                                     // implements HAL
+#include "../hal.h"
+
+/**
+ * @desc    Init bus, SPI master mode 0, F_CPU / 2
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HAL_Init (void)
+{
+  SPI_Init (SPI_MASTER | SPI_MODE_0 | SPI_MSB_FIRST | SPI_FOSC_DIV_4);
+}
+
+/**
+ * @desc    Write bytes
+ *
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void HAL_Write (const uint8_t * data, uint16_t length)
+{
+  while (length--) {
+    HAL_Write_Byte (*data++);
+  }
+}
+
+/**
+ * @desc    Bytes in & out, answers replace bytes sent
+ *
+ * @param   uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void HAL_Read (uint8_t * data, uint16_t length)
+{
+  while (length--) {
+    *data = SPI_Transfer (*data);
+    data++;
+  }
+}
+
+/**
+ * @desc    Write 16 bit value repeatedly, high byte first
+ *
+ * @param   uint16_t value
+ * @param   uint32_t count
+ *
+ * @return  void
+ */
+void HAL_Write_Repeat (uint16_t value, uint32_t count)
+{
+  uint8_t high = (uint8_t) (value >> 8);
+  uint8_t low = (uint8_t) value;
+
+  while (count--) {
+    HAL_Write_Byte (high);                              // transfer High Byte
+    HAL_Write_Byte (low);                               // transfer low Byte
+  }
+}
+
+/**
+ * @desc    Write list of chunks, tight loop per chunk
+ *
+ * @param   struct signal * dc
+ * @param   const struct S_HAL_CHUNK * chunks
+ * @param   uint8_t count
+ *
+ * @return  void
+ */
+void HAL_Write_Chunks (struct signal * dc, const struct S_HAL_CHUNK * chunk, uint8_t count)
+{
+  const uint8_t * byte;
+  const uint16_t * word;
+  uint32_t length;
+
+  while (count--) {
+    if (chunk->type == HAL_CHUNK_COMMAND) {
+      HAL_Pin_Clear (dc);                               // command (active low)
+    } else {
+      HAL_Pin_Set (dc);                                 // data (active high)
+    }
+    length = chunk->length;
+    if (chunk->type == HAL_CHUNK_REPEAT) {
+      HAL_Write_Repeat (chunk->value, length);
+    } else if (chunk->type == HAL_CHUNK_PIXELS) {
+      word = chunk->data;
+      while (length--) {
+        HAL_Write_Byte ((uint8_t) (*word >> 8));        // transfer High Byte
+        HAL_Write_Byte ((uint8_t) *word++);             // transfer low Byte
+      }
+    } else {
+      byte = chunk->data;
+      while (length--) {
+        HAL_Write_Byte (*byte++);
+      }
+    }
+    chunk++;
+  }
+}
+
+/**
+ * @desc    Bus speed, double speed off for reads
+ *
+ * @param   uint8_t HAL_SPEED_WRITE / HAL_SPEED_READ
+ *
+ * @return  void
+ */
+void HAL_Speed (uint8_t speed)
+{
+  SPI_Speed (speed == HAL_SPEED_READ ? SPI_SPEED_NORMAL : SPI_SPEED_DOUBLE);
+}
+
+/**
+ * @desc    Delay
+ *
+ * @param   uint16_t time in milliseconds
+ *
+ * @return  void
+ */
+void HAL_Delay_ms (uint16_t time)
+{
+  while (time--) {
+    _delay_ms (1);                                      // 1ms delay
+  }
+}
@@ -0,0 +1,57 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Hardware Abstraction - AVR
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        hal_avr.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      avr/io.h, avr/pgmspace.h, util/delay.h, spi.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Hardware SPI of Atmega, pins & bytes inlined, writes are synchronous
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __HAL_AVR_H__
+#define __HAL_AVR_H__
+
+  #include <avr/io.h>
+  #include <avr/pgmspace.h>
+  #include <util/delay.h>
+  #include "../spi.h"
+  #include "../stats.h"
+
+  /** @struct Signal */
+  struct signal {
+    volatile uint8_t * ddr;                             // ddr
+    volatile uint8_t * port;                            // port
+    uint8_t pin;                                        // pin
+  };
+
+  /* Pin as output */
+  static inline void HAL_Pin_Output (struct signal * signal) { *(signal->ddr) |= (1 << signal->pin); }
+  /* Pin high */
+  static inline void HAL_Pin_Set (struct signal * signal) { *(signal->port) |= (1 << signal->pin); }
+  /* Pin low */
+  static inline void HAL_Pin_Clear (struct signal * signal) { *(signal->port) &= ~(1 << signal->pin); }
+
+  /* Write byte, no call per byte */
+  static inline void HAL_Write_Byte (uint8_t data)
+  {
+    ST7789_STATS_SPI_BEGIN ();
+    SPI_WRITE (data);
+    ST7789_STATS_SPI_END ();
+  }
+
+  /* Byte in & out */
+  static inline uint8_t HAL_Transfer (uint8_t data) { return SPI_Transfer (data); }
+
+  /* Writes are synchronous */
+  static inline void HAL_Wait (void) { }
+
+#endif
@@ -0,0 +1,251 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Hardware Abstraction - Mock
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        hal_mock.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      hal.h, stats.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#define HAL_BACKEND                                     // implements HAL
+#include "../hal.h"
+#include "../stats.h"
+
+/** @var Ports of example wiring */
+volatile uint8_t DDRB, PORTB, DDRC, PORTC, DDRD, PORTD;
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+/* Pin level */
+static inline uint8_t HAL_Mock_Level (struct signal * signal) { return (*(signal->port) >> signal->pin) & 0x01; }
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Init bus
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HAL_Init (void)
+{
+  Mock.bytes = 0;
+  Mock.clocks = 0;
+  Mock.lists = 0;
+  Mock.chunks = 0;
+  Mock.errors = 0;
+}
+
+/**
+ * @desc    Pin as output
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void HAL_Pin_Output (struct signal * signal)
+{
+  *(signal->ddr) |= (1 << signal->pin);
+}
+
+/**
+ * @desc    Pin high
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void HAL_Pin_Set (struct signal * signal)
+{
+  *(signal->port) |= (1 << signal->pin);
+}
+
+/**
+ * @desc    Pin low
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void HAL_Pin_Clear (struct signal * signal)
+{
+  *(signal->port) &= ~(1 << signal->pin);
+}
+
+/**
+ * @desc    Byte in & out, decoded by panel model when selected and
+ *          by other device on bus (Mock.device) if any, MISO of idle
+ *          device is high
+ *
+ * @param   uint8_t
+ *
+ * @return  uint8_t
+ */
+uint8_t HAL_Transfer (uint8_t data)
+{
+  uint8_t in = 0xFF;
+  ST7789_STATS_SPI_BEGIN ();
+
+  Mock.clocks++;
+  if (Mock.device) {
+    in = Mock.device (data);                            // e.g. flash sharing the bus
+  }
+  if ((Mock.cs != NULL) && !HAL_Mock_Level (Mock.cs)) {
+    in &= HAL_Mock_Byte (data, HAL_Mock_Level (Mock.dc));  // panel selected
+  }
+  ST7789_STATS_SPI_END ();
+
+  return in;
+}
+
+/**
+ * @desc    Write byte
+ *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void HAL_Write_Byte (uint8_t data)
+{
+  HAL_Transfer (data);
+}
+
+/**
+ * @desc    Write bytes
+ *
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void HAL_Write (const uint8_t * data, uint16_t length)
+{
+  while (length--) {
+    HAL_Transfer (*data++);
+  }
+}
+
+/**
+ * @desc    Bytes in & out, answers replace bytes sent
+ *
+ * @param   uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void HAL_Read (uint8_t * data, uint16_t length)
+{
+  while (length--) {
+    *data = HAL_Transfer (*data);
+    data++;
+  }
+}
+
+/**
+ * @desc    Write 16 bit value repeatedly, high byte first
+ *
+ * @param   uint16_t value
+ * @param   uint32_t count
+ *
+ * @return  void
+ */
+void HAL_Write_Repeat (uint16_t value, uint32_t count)
+{
+  while (count--) {
+    HAL_Transfer ((uint8_t) (value >> 8));
+    HAL_Transfer ((uint8_t) value);
+  }
+}
+
+/**
+ * @desc    Write list of chunks, boundaries checked
+ *
+ * @param   struct signal * dc
+ * @param   const struct S_HAL_CHUNK * chunks
+ * @param   uint8_t count
+ *
+ * @return  void
+ */
+void HAL_Write_Chunks (struct signal * dc, const struct S_HAL_CHUNK * chunk, uint8_t count)
+{
+  const uint8_t * byte;
+  const uint16_t * word;
+  uint32_t length;
+
+  Mock.lists++;
+  while (count--) {
+    if (chunk->type == HAL_CHUNK_COMMAND) {
+      HAL_Pin_Clear (dc);
+    } else {
+      HAL_Pin_Set (dc);
+    }
+    length = chunk->length;
+    if (chunk->type == HAL_CHUNK_REPEAT) {
+      HAL_Write_Repeat (chunk->value, length);
+    } else if (chunk->type == HAL_CHUNK_PIXELS) {
+      word = chunk->data;
+      while (length--) {
+        HAL_Transfer ((uint8_t) (*word >> 8));
+        HAL_Transfer ((uint8_t) *word++);
+      }
+    } else {
+      byte = chunk->data;
+      while (length--) {
+        HAL_Transfer (*byte++);
+      }
+    }
+    HAL_Mock_Chunk (chunk++);                           // boundary check
+  }
+}
+
+/**
+ * @desc    Writes are synchronous
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HAL_Wait (void)
+{
+}
+
+/**
+ * @desc    Bus speed, no effect
+ *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void HAL_Speed (uint8_t speed)
+{
+  (void) speed;
+}
+
+/**
+ * @desc    Delay, returns at once
+ *
+ * @param   uint16_t
+ *
+ * @return  void
+ */
+void HAL_Delay_ms (uint16_t time)
+{
+  (void) time;
+}
@@ -0,0 +1,51 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Hardware Abstraction - Mock
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        hal_mock.h
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      model.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Host backend without hardware: ports are variables, bytes go to the
+ *              controller model (model.h) while its chip select is low, delays
+ *              return at once
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __HAL_MOCK_H__
+#define __HAL_MOCK_H__
+
+  #include <stdint.h>
+  #include "model.h"
+
+  /** @struct Signal */
+  struct signal {
+    volatile uint8_t * ddr;                             // ddr
+    volatile uint8_t * port;                            // port
+    uint8_t pin;                                        // pin
+  };
+
+  /** @var Ports of example wiring */
+  extern volatile uint8_t DDRB, PORTB, DDRC, PORTC, DDRD, PORTD;
+
+  /* Pin as output */
+  void HAL_Pin_Output (struct signal *);
+  /* Pin high */
+  void HAL_Pin_Set (struct signal *);
+  /* Pin low */
+  void HAL_Pin_Clear (struct signal *);
+  /* Write byte */
+  void HAL_Write_Byte (uint8_t);
+  /* Byte in & out */
+  uint8_t HAL_Transfer (uint8_t);
+  /* Writes are synchronous */
+  void HAL_Wait (void);
+
+#endif
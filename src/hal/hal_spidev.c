@@ -0,0 +1,456 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Hardware Abstraction - Linux spidev
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        hal_spidev.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      hal.h, pixel.h, linux/spi/spidev.h, linux/gpio.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#define HAL_BACKEND                                     // implements HAL
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include <linux/spi/spidev.h>
+#include "../hal.h"
+#include "../st7789.h"
+#include "../pixel.h"
+
+#define HAL_SPIDEV_DEVICE     "/dev/spidev0.0"          // default device
+#define HAL_SPIDEV_HZ         32000000                  // default clock
+
+/** @var Device */
+static int device = -1;                                 // spidev file, -1 = closed
+#if defined(ST7789_SPIDEV_MOCK)
+static uint8_t mock = 0;                                // messages go to controller model
+#else
+  #define mock                0                         // hardware only
+#endif
+static uint32_t frequency = HAL_SPIDEV_HZ;                // write clock
+static uint8_t slow = 0;                                // read clock selected
+static uint32_t messages = 0;                           // ioctls sent
+static uint32_t errors = 0;                             // failed message & line ioctls
+
+/** @var Collected bytes */
+static uint8_t buffer[HAL_SPIDEV_BUFFER] __attribute__ ((aligned (2)));
+static uint16_t count = 0;
+
+/** @var Kernel chip select */
+static uint8_t selected = 0;                            // chip select active
+static uint8_t held = 0;                                // left active after last message
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+/* One message, chip select kept active after it if keep */
+static void HAL_Spidev_Message (const uint8_t * tx, uint8_t * rx, uint16_t length, uint8_t keep)
+{
+  struct spi_ioc_transfer transfer;
+#if defined(ST7789_SPIDEV_MOCK)
+  uint8_t answer;
+  uint16_t i;
+#endif
+
+  messages++;
+#if defined(ST7789_SPIDEV_MOCK)
+  if (mock) {
+    for (i = 0; i < length; i++) {
+      answer = 0xFF;                                    // nobody answers
+      if ((Mock.cs != NULL) && (Mock.cs->value == 0)) {
+        answer = HAL_Mock_Byte (tx[i], (Mock.dc != NULL) ? Mock.dc->value : 1);
+      }
+      if (rx != NULL) {
+        rx[i] = answer;
+      }
+    }
+    return;
+  }
+#endif
+
+  memset (&transfer, 0, sizeof (transfer));
+  transfer.tx_buf = (uintptr_t) tx;
+  transfer.rx_buf = (uintptr_t) rx;
+  transfer.len = length;
+  transfer.speed_hz = slow ? HAL_SPIDEV_READ_HZ : frequency;
+  transfer.bits_per_word = 8;
+  transfer.cs_change = keep;                            // on last transfer: stay selected
+  if (ioctl (device, SPI_IOC_MESSAGE (1), &transfer) < 0) {
+    errors++;                                           // bytes not sent, rx not valid
+  }
+}
+
+/* Send collected bytes, empty message only to release held chip select */
+static void HAL_Spidev_Flush (uint8_t keep)
+{
+  if ((count == 0) && (keep || !held)) {
+    return;                                             // nothing to send
+  }
+  HAL_Spidev_Message (buffer, NULL, count, keep);
+  count = 0;
+  held = keep;
+}
+
+/* Pixels from words or one value repeated, wire order on little endian host */
+static void HAL_Spidev_Pixels (const uint16_t * words, uint16_t value, uint32_t length)
+{
+  uint32_t part;
+
+  value = (uint16_t) ((value >> 8) | (value << 8));     // high byte first
+  while (length) {
+    if (count & 1) {
+      HAL_Spidev_Flush (selected);                      // word stores aligned
+    }
+    part = (HAL_SPIDEV_BUFFER - count) >> 1;
+    if (part > length) {
+      part = length;
+    }
+    if (words != NULL) {
+      ST7789_Pixel_Swap ((uint16_t *) &buffer[count], words, part);
+      words += part;
+    } else {
+      ST7789_Pixel_Fill ((uint16_t *) &buffer[count], value, part);
+    }
+    count += part << 1;
+    length -= part;
+    if (count == HAL_SPIDEV_BUFFER) {
+      HAL_Spidev_Flush (selected);                      // full message
+    }
+  }
+}
+
+/* Level of line, bytes collected so far leave before the edge */
+static void HAL_Spidev_Level (struct signal * signal, uint8_t value)
+{
+  struct gpio_v2_line_values values;
+
+  if (signal->value == value) {
+    return;                                             // no edge, keep collecting
+  }
+  if (signal->line == HAL_SPIDEV_CS) {
+    selected = !value;                                  // active low
+  }
+  HAL_Spidev_Flush (selected);                          // deselect releases held chip select
+  signal->value = value;
+  if (signal->fd > 0) {
+    memset (&values, 0, sizeof (values));
+    values.bits = value;
+    values.mask = 1;
+    if (ioctl (signal->fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) < 0) {
+      errors++;                                         // line kept old level
+    }
+  }
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Open spidev device before ST7789_Init
+ *
+ * @param   const char * device, /dev/spidevB.C or HAL_SPIDEV_MOCK with ST7789_SPIDEV_MOCK
+ * @param   uint32_t clock in Hz
+ *
+ * @return  uint8_t
+ */
+uint8_t HAL_Spidev_Open (const char * path, uint32_t hz)
+{
+  uint8_t mode = SPI_MODE_0;
+  uint8_t bits = 8;
+
+  messages = 0;
+  errors = 0;
+  frequency = hz;
+#if defined(ST7789_SPIDEV_MOCK)
+  if (strcmp (path, HAL_SPIDEV_MOCK) == 0) {
+    mock = 1;                                           // no hardware
+    return ST77XX_SUCCESS;
+  }
+#endif
+  device = open (path, O_RDWR);
+  if (device < 0) {
+    return ST77XX_ERROR;
+  }
+  if ((ioctl (device, SPI_IOC_WR_MODE, &mode) < 0) ||
+      (ioctl (device, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0) ||
+      (ioctl (device, SPI_IOC_WR_MAX_SPEED_HZ, &hz) < 0)) {
+    close (device);
+    device = -1;
+    return ST77XX_ERROR;
+  }
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Number of SPI_IOC_MESSAGE ioctls since open
+ *
+ * @param   void
+ *
+ * @return  uint32_t
+ */
+uint32_t HAL_Spidev_Messages (void)
+{
+  return messages;
+}
+
+/**
+ * @desc    Number of failed SPI_IOC_MESSAGE & line value ioctls since open
+ *
+ * @param   void
+ *
+ * @return  uint32_t
+ */
+uint32_t HAL_Spidev_Errors (void)
+{
+  return errors;
+}
+
+/**
+ * @desc    Init bus, default device if not opened
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HAL_Init (void)
+{
+  if ((device < 0) && !mock) {
+    HAL_Spidev_Open (HAL_SPIDEV_DEVICE, HAL_SPIDEV_HZ);
+  }
+}
+
+/**
+ * @desc    Line as output, requested from GPIO character device
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void HAL_Pin_Output (struct signal * signal)
+{
+  struct gpio_v2_line_request request;
+  int chip;
+
+  if (mock || (signal->chip == NULL) || (signal->line == HAL_SPIDEV_CS) || (signal->fd > 0)) {
+    return;                                             // nothing to request
+  }
+  chip = open (signal->chip, O_RDWR);
+  if (chip < 0) {
+    return;
+  }
+  memset (&request, 0, sizeof (request));
+  request.offsets[0] = signal->line;
+  request.num_lines = 1;
+  strcpy (request.consumer, "st7789");
+  request.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+  request.config.num_attrs = 1;
+  request.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+  request.config.attrs[0].attr.values = signal->value;
+  request.config.attrs[0].mask = 1;
+  if (ioctl (chip, GPIO_V2_GET_LINE_IOCTL, &request) == 0) {
+    signal->fd = request.fd;
+  }
+  close (chip);
+}
+
+/**
+ * @desc    Line high
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void HAL_Pin_Set (struct signal * signal)
+{
+  HAL_Spidev_Level (signal, 1);
+}
+
+/**
+ * @desc    Line low
+ *
+ * @param   struct signal *
+ *
+ * @return  void
+ */
+void HAL_Pin_Clear (struct signal * signal)
+{
+  HAL_Spidev_Level (signal, 0);
+}
+
+/**
+ * @desc    Write byte, collected
+ *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void HAL_Write_Byte (uint8_t data)
+{
+  buffer[count++] = data;
+  if (count == HAL_SPIDEV_BUFFER) {
+    HAL_Spidev_Flush (selected);                        // full message
+  }
+}
+
+/**
+ * @desc    Byte in & out, collected bytes leave first
+ *
+ * @param   uint8_t
+ *
+ * @return  uint8_t
+ */
+uint8_t HAL_Transfer (uint8_t data)
+{
+  uint8_t answer = 0xFF;
+
+  HAL_Spidev_Flush (selected);
+  HAL_Spidev_Message (&data, &answer, 1, selected);
+  held = selected;
+
+  return answer;
+}
+
+/**
+ * @desc    Bytes in & out, collected bytes leave first, one message
+ *          per HAL_SPIDEV_BUFFER bytes, answers replace bytes sent
+ *
+ * @param   uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void HAL_Read (uint8_t * data, uint16_t length)
+{
+  uint16_t part;
+
+  HAL_Spidev_Flush (selected);
+  while (length) {
+    part = (length > HAL_SPIDEV_BUFFER) ? HAL_SPIDEV_BUFFER : length;
+    HAL_Spidev_Message (data, data, part, selected);    // spidev copies tx before rx
+    data += part;
+    length -= part;
+  }
+  held = selected;
+}
+
+/**
+ * @desc    Write bytes
+ *
+ * @param   const uint8_t * data
+ * @param   uint16_t length
+ *
+ * @return  void
+ */
+void HAL_Write (const uint8_t * data, uint16_t length)
+{
+  uint16_t part;
+
+  while (length) {
+    part = HAL_SPIDEV_BUFFER - count;
+    if (part > length) {
+      part = length;
+    }
+    memcpy (&buffer[count], data, part);
+    count += part;
+    data += part;
+    length -= part;
+    if (count == HAL_SPIDEV_BUFFER) {
+      HAL_Spidev_Flush (selected);                      // full message
+    }
+  }
+}
+
+/**
+ * @desc    Write 16 bit value repeatedly, high byte first
+ *
+ * @param   uint16_t value
+ * @param   uint32_t count
+ *
+ * @return  void
+ */
+void HAL_Write_Repeat (uint16_t value, uint32_t repeat)
+{
+  HAL_Spidev_Pixels (NULL, value, repeat);
+}
+
+/**
+ * @desc    Write list of chunks, chunks with same DC share messages
+ *
+ * @param   struct signal * dc
+ * @param   const struct S_HAL_CHUNK * chunks
+ * @param   uint8_t count
+ *
+ * @return  void
+ */
+void HAL_Write_Chunks (struct signal * dc, const struct S_HAL_CHUNK * chunk, uint8_t chunks)
+{
+  while (chunks--) {
+    HAL_Spidev_Level (dc, chunk->type != HAL_CHUNK_COMMAND);
+    if (chunk->type == HAL_CHUNK_REPEAT) {
+      HAL_Spidev_Pixels (NULL, chunk->value, chunk->length);
+    } else if (chunk->type == HAL_CHUNK_PIXELS) {
+      HAL_Spidev_Pixels (chunk->data, 0, chunk->length);
+    } else {
+      HAL_Write (chunk->data, chunk->length);
+    }
+    chunk++;
+  }
+}
+
+/**
+ * @desc    Send collected bytes
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void HAL_Wait (void)
+{
+  HAL_Spidev_Flush (selected);
+}
+
+/**
+ * @desc    Bus speed, read clock of panel is lower
+ *
+ * @param   uint8_t HAL_SPEED_WRITE / HAL_SPEED_READ
+ *
+ * @return  void
+ */
+void HAL_Speed (uint8_t speed)
+{
+  HAL_Spidev_Flush (selected);
+  slow = (speed == HAL_SPEED_READ);
+}
+
+/**
+ * @desc    Delay, collected bytes leave first
+ *
+ * @param   uint16_t time in milliseconds
+ *
+ * @return  void
+ */
+void HAL_Delay_ms (uint16_t time)
+{
+  struct timespec wait = { time / 1000, (long) (time % 1000) * 1000000L };
+
+  HAL_Spidev_Flush (selected);
+  if (!mock) {
+    nanosleep (&wait, NULL);
+  }
+}
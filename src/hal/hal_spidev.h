@@ -0,0 +1,99 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Hardware Abstraction - Linux spidev
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        hal_spidev.h
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      model.h with ST7789_SPIDEV_MOCK
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Embedded Linux backend, make host HOST_HAL=spidev
+ *
+ *              Bytes are collected while DC & CS stay the same and leave as one
+ *              SPI_IOC_MESSAGE of up to HAL_SPIDEV_BUFFER bytes (spidev bufsiz,
+ *              4096 by default), so a fill costs one ioctl per 4 kB, HAL_Read
+ *              one full duplex ioctl per 4 kB. DC, RST & BL are GPIO character
+ *              device lines. Chip select is either a line or HAL_SPIDEV_CS,
+ *              driven by the kernel and held between messages.
+ *
+ *              Failed message & line ioctls are counted, see HAL_Spidev_Errors.
+ *
+ *              With ST7789_SPIDEV_MOCK (make host HOST_HAL=spidev SPIDEV_MOCK=1)
+ *              device HAL_SPIDEV_MOCK ("mock") opens nothing: messages go to
+ *              the controller model (model.h), lines are kept in memory only.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __HAL_SPIDEV_H__
+#define __HAL_SPIDEV_H__
+
+  #include <stdint.h>
+  #if defined(ST7789_SPIDEV_MOCK)
+    #include "model.h"
+  #endif
+
+  #ifndef HAL_SPIDEV_BUFFER
+    #define HAL_SPIDEV_BUFFER   4096                    // bytes per message, <= spidev bufsiz
+  #endif
+  #define HAL_SPIDEV_READ_HZ    6000000                 // read clock of panel
+  #define HAL_SPIDEV_CS         0xFF                    // line = chip select of spidev
+  #if defined(ST7789_SPIDEV_MOCK)
+    #define HAL_SPIDEV_MOCK     "mock"                  // device backed by controller model
+  #endif
+
+  /** @struct Signal / GPIO line, chip NULL = not connected */
+  struct signal {
+    const char * chip;                                  // /dev/gpiochipN
+    uint8_t line;                                       // offset or HAL_SPIDEV_CS
+    uint8_t value;                                      // current level
+    int fd;                                             // line request, 0 = not requested
+  };
+
+  /* Pin as output */
+  void HAL_Pin_Output (struct signal *);
+  /* Pin high */
+  void HAL_Pin_Set (struct signal *);
+  /* Pin low */
+  void HAL_Pin_Clear (struct signal *);
+  /* Write byte */
+  void HAL_Write_Byte (uint8_t);
+  /* Byte in & out */
+  uint8_t HAL_Transfer (uint8_t);
+  /* Send collected bytes */
+  void HAL_Wait (void);
+
+  /**
+   * @desc    Open spidev device before ST7789_Init
+   *
+   * @param   const char * device, /dev/spidevB.C or HAL_SPIDEV_MOCK with ST7789_SPIDEV_MOCK
+   * @param   uint32_t clock in Hz
+   *
+   * @return  uint8_t
+   */
+  uint8_t HAL_Spidev_Open (const char *, uint32_t);
+
+  /**
+   * @desc    Number of SPI_IOC_MESSAGE ioctls since open
+   *
+   * @param   void
+   *
+   * @return  uint32_t
+   */
+  uint32_t HAL_Spidev_Messages (void);
+
+  /**
+   * @desc    Number of failed SPI_IOC_MESSAGE & line value ioctls since open
+   *
+   * @param   void
+   *
+   * @return  uint32_t
+   */
+  uint32_t HAL_Spidev_Errors (void);
+
+#endif
@@ -0,0 +1,242 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Controller Model
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        model.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      hal.h, stdio.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdio.h>
+#include "../hal.h"
+#include "../st7789.h"
+
+/** @var Mock panel */
+struct S_MOCK Mock;
+
+/** @var Controller state */
+static uint8_t command = ST77XX_NOP;                    // last command
+static uint32_t argument;                               // index of data byte after command
+static uint16_t xs, xe, ys, ye;                         // CASET / RASET
+static uint16_t col, row;                               // memory pointer
+static uint8_t high;                                    // first byte of pixel
+static uint16_t color;                                  // pixel being read
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+/* Pixel at memory pointer, MV exchanges column & row, then MX mirrors RAM columns
+   and MY RAM rows as in datasheet, out of RAM ignored */
+static uint16_t * HAL_Mock_Pixel (void)
+{
+  uint16_t x = col, y = row;                            // RAM column & row
+
+  if (Mock.madctl & ST77XX_XY_CHANGE) {
+    x = row;                                            // CASET addresses RAM rows
+    y = col;
+  }
+  if ((x >= HAL_MOCK_WIDTH) || (y >= HAL_MOCK_HEIGHT)) {
+    return NULL;
+  }
+  if (Mock.madctl & ST77XX_X_MIRROR) x = HAL_MOCK_WIDTH - 1 - x;
+  if (Mock.madctl & ST77XX_Y_MIRROR) y = HAL_MOCK_HEIGHT - 1 - y;
+
+  return &Mock.gram[y][x];
+}
+
+/* Next memory pointer */
+static void HAL_Mock_Next (void)
+{
+  if (++col > xe) {
+    col = xs;
+    row++;
+  }
+}
+
+/* Data byte after command */
+static uint8_t HAL_Mock_Data (uint8_t data)
+{
+  uint16_t * pixel;
+  uint32_t index = argument++;
+
+  switch (command) {
+    case ST77XX_CASET:
+      if (index == 0) xs = (uint16_t) data << 8;
+      else if (index == 1) xs |= data;
+      else if (index == 2) xe = (uint16_t) data << 8;
+      else if (index == 3) xe |= data;
+      break;
+    case ST77XX_RASET:
+      if (index == 0) ys = (uint16_t) data << 8;
+      else if (index == 1) ys |= data;
+      else if (index == 2) ye = (uint16_t) data << 8;
+      else if (index == 3) ye |= data;
+      break;
+    case ST77XX_MADCTL:
+      Mock.madctl = data;
+      break;
+    case ST77XX_VSCRDEF:
+      if (index == 0) Mock.tfa = (uint16_t) data << 8;
+      else if (index == 1) Mock.tfa |= data;
+      else if (index == 2) Mock.vsa = (uint16_t) data << 8;
+      else if (index == 3) Mock.vsa |= data;
+      break;                                            // bottom fixed area = rest
+    case ST77XX_VSCSAD:
+      if (index == 0) Mock.vsp = (uint16_t) data << 8;
+      else if (index == 1) Mock.vsp |= data;
+      break;
+    case ST77XX_RAMWR:
+    case ST77XX_RAMWRC:
+      if ((index & 0x01) == 0) {
+        high = data;                                    // pixel high byte
+        break;
+      }
+      if ((pixel = HAL_Mock_Pixel ()) != NULL) {
+        *pixel = ((uint16_t) high << 8) | data;
+      }
+      HAL_Mock_Next ();
+      break;
+    case ST77XX_RAMRD:
+      if (index == 0) {
+        return 0x00;                                    // dummy clock
+      }
+      index = (index - 1) % 3;
+      if (index == 0) {
+        pixel = HAL_Mock_Pixel ();
+        color = (pixel != NULL) ? *pixel : 0x0000;
+        return (color >> 8) & 0xF8;                     // red
+      }
+      if (index == 1) {
+        return (color >> 3) & 0xFC;                     // green
+      }
+      HAL_Mock_Next ();
+      return (color << 3) & 0xF8;                       // blue
+  }
+  return 0xFF;
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Connect model of controller to chip select & data / command
+ *
+ * @param   struct signal * cs
+ * @param   struct signal * dc
+ *
+ * @return  void
+ */
+void HAL_Mock_Panel (struct signal * cs, struct signal * dc)
+{
+  Mock.cs = cs;
+  Mock.dc = dc;
+  Mock.tfa = 0;                                         // no scrolling after reset
+  Mock.vsa = HAL_MOCK_HEIGHT;
+  Mock.vsp = 0;
+}
+
+/**
+ * @desc    Byte on bus of selected controller
+ *
+ * @param   uint8_t data
+ * @param   uint8_t level of data / command
+ *
+ * @return  uint8_t answer of controller
+ */
+uint8_t HAL_Mock_Byte (uint8_t data, uint8_t dc)
+{
+  Mock.bytes++;
+  if (dc == 0) {
+    command = data;                                     // command
+    argument = 0;
+    if ((data == ST77XX_RAMWR) || (data == ST77XX_RAMRD)) {
+      col = xs;                                         // start at window, RAMWRC continues
+      row = ys;
+    }
+    return 0xFF;
+  }
+  return HAL_Mock_Data (data);
+}
+
+/**
+ * @desc    End of chunk, boundary check
+ *
+ * @param   const struct S_HAL_CHUNK * chunk
+ *
+ * @return  void
+ */
+void HAL_Mock_Chunk (const struct S_HAL_CHUNK * chunk)
+{
+  Mock.chunks++;
+  if (chunk->type == HAL_CHUNK_COMMAND) {
+    if (chunk->length != 1) {
+      Mock.errors++;                                    // one command per chunk
+    }
+    return;
+  }
+  if (((command == ST77XX_CASET) || (command == ST77XX_RASET)) && (argument != 4)) {
+    Mock.errors++;                                      // window bytes split
+  }
+  if (((command == ST77XX_RAMWR) || (command == ST77XX_RAMWRC)) && (argument & 0x01)) {
+    Mock.errors++;                                      // pixel split
+  }
+}
+
+/**
+ * @desc    Frame memory line shown on panel line, vertical scrolling applied
+ *
+ * @param   uint16_t panel line
+ *
+ * @return  uint16_t
+ */
+uint16_t HAL_Mock_Line (uint16_t line)
+{
+  if ((line < Mock.tfa) || (line >= Mock.tfa + Mock.vsa) ||
+      (Mock.vsp < Mock.tfa) || (Mock.vsp >= Mock.tfa + Mock.vsa)) {
+    return line;                                        // fixed area or start out of scrolling area
+  }
+  return Mock.tfa + (line - Mock.tfa + Mock.vsp - Mock.tfa) % Mock.vsa;
+}
+
+/**
+ * @desc    Write GRAM as shown on panel as binary PPM
+ *
+ * @param   const char * file
+ *
+ * @return  uint8_t
+ */
+uint8_t HAL_Mock_Dump (const char * file)
+{
+  FILE * out = fopen (file, "wb");
+  uint16_t x, y, pixel;
+
+  if (out == NULL) {
+    return ST77XX_ERROR;
+  }
+  fprintf (out, "P6\n%d %d\n255\n", HAL_MOCK_WIDTH, HAL_MOCK_HEIGHT);
+  for (y = 0; y < HAL_MOCK_HEIGHT; y++) {
+    for (x = 0; x < HAL_MOCK_WIDTH; x++) {
+      pixel = Mock.gram[HAL_Mock_Line (y)][x];
+      fputc ((pixel >> 8) & 0xF8, out);                 // red
+      fputc ((pixel >> 3) & 0xFC, out);                 // green
+      fputc ((pixel << 3) & 0xF8, out);                 // blue
+    }
+  }
+  fclose (out);
+
+  return ST77XX_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Controller Model
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        model.h
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      stdint.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Model of the controller for host backends without a panel: decodes
+ *              CASET, RASET, MADCTL, RAMWR, RAMWRC & RAMRD into Mock.gram, so
+ *              drawing can be checked on a plain Linux host. GRAM is kept in
+ *              panel order (MADCTL = 0x00).
+ *
+ *              Chunk lists are counted & checked: command chunk is one byte,
+ *              CASET / RASET data four bytes and no pixel is split between
+ *              chunks, any violation counts in Mock.errors.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __MODEL_H__
+#define __MODEL_H__
+
+  #include <stdint.h>
+
+  #define HAL_MOCK_WIDTH        240                     // controller RAM columns
+  #define HAL_MOCK_HEIGHT       320                     // controller RAM rows
+
+  struct signal;
+  struct S_HAL_CHUNK;
+
+  /** @struct Mock panel */
+  struct S_MOCK {
+    uint16_t gram[HAL_MOCK_HEIGHT][HAL_MOCK_WIDTH];     // controller RAM, panel order
+    uint32_t bytes;                                     // bytes sent to selected panel
+    uint32_t clocks;                                    // bytes clocked on bus, any device
+    uint32_t lists;                                     // calls of HAL_Write_Chunks
+    uint32_t chunks;                                    // chunks = transfer descriptors
+    uint32_t errors;                                    // chunk boundary violations
+    uint8_t madctl;                                     // last MADCTL
+    uint16_t tfa;                                       // VSCRDEF top fixed area
+    uint16_t vsa;                                       // VSCRDEF vertical scrolling area
+    uint16_t vsp;                                       // VSCSAD first line of scrolling area
+    struct signal * cs;                                 // decoded chip select
+    struct signal * dc;                                 // decoded data / command
+    uint8_t (*device) (uint8_t);                        // other device on bus, 0xFF if idle
+  };
+
+  /** @var Mock panel, model.c */
+  extern struct S_MOCK Mock;
+
+  /**
+   * @desc    Connect model of controller to chip select & data / command
+   *
+   * @param   struct signal * cs
+   * @param   struct signal * dc
+   *
+   * @return  void
+   */
+  void HAL_Mock_Panel (struct signal *, struct signal *);
+
+  /**
+   * @desc    Byte on bus of selected controller
+   *
+   * @param   uint8_t data
+   * @param   uint8_t level of data / command
+   *
+   * @return  uint8_t answer of controller
+   */
+  uint8_t HAL_Mock_Byte (uint8_t, uint8_t);
+
+  /**
+   * @desc    End of chunk, boundary check
+   *
+   * @param   const struct S_HAL_CHUNK * chunk
+   *
+   * @return  void
+   */
+  void HAL_Mock_Chunk (const struct S_HAL_CHUNK *);
+
+  /**
+   * @desc    Frame memory line shown on panel line, vertical scrolling applied
+   *
+   * @param   uint16_t panel line
+   *
+   * @return  uint16_t
+   */
+  uint16_t HAL_Mock_Line (uint16_t);
+
+  /**
+   * @desc    Write GRAM as shown on panel as binary PPM
+   *
+   * @param   const char * file
+   *
+   * @return  uint8_t
+   */
+  uint8_t HAL_Mock_Dump (const char *);
+
+#endif
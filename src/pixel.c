@@ -0,0 +1,349 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Pixel Kernels
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        pixel.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      pixel.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "pixel.h"
+
+#if !defined(ST7789_PIXEL_SCALAR)
+  #if defined(__AVX2__)
+    #include <immintrin.h>
+    #define PIXEL_AVX2
+  #elif defined(__SSE2__)
+    #include <emmintrin.h>
+    #define PIXEL_SSE2
+  #endif
+  #if defined(__SSSE3__)
+    #include <tmmintrin.h>
+    #define PIXEL_SSSE3
+  #endif
+#endif
+
+/** @array Ordered dither, 4x4 Bayer matrix 0 .. 15 */
+const uint8_t BAYER_4X4[4][4] PROGMEM = {
+  {  0,  8,  2, 10 },
+  { 12,  4, 14,  6 },
+  {  3, 11,  1,  9 },
+  { 15,  7, 13,  5 }
+};
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+/* Thresholds of pixel as 0x00RRGGBB, 5 bit channels step 8, 6 bit channel step 4 */
+static inline uint32_t ST7789_Pixel_Threshold (int16_t row, uint32_t column)
+{
+  uint8_t t;
+
+  if (row < 0) {
+    return 0;                                           // no dither
+  }
+  t = ST7789_BAYER (column, row);
+
+  return ((uint32_t) (t >> 1) << 16) | ((uint32_t) (t >> 2) << 8) | (t >> 1);
+}
+
+/* Bayer threshold of column in row, 0 without dither */
+static inline uint8_t ST7789_Pixel_Bayer (int16_t row, uint32_t column)
+{
+  return (row < 0) ? 0 : ST7789_BAYER (column, row);
+}
+
+/* Channel 0 .. 255 plus diffused error to level of bits, error of level returned */
+static inline uint8_t ST7789_Pixel_Level (int16_t value, uint8_t levels, int16_t * error)
+{
+  uint8_t level;
+
+  value = (value < 0) ? 0 : (value > 0xFF) ? 0xFF : value;
+  level = (uint8_t) (((uint16_t) value * levels + 127) / 255);   // nearest level
+  *error = value - (int16_t) (((uint16_t) level * 255 + (levels >> 1)) / levels);
+
+  return level;
+}
+
+/* Channel of destination moved to source by alpha 0 .. 32 */
+static inline uint16_t ST7789_Pixel_Mix (uint16_t source, uint16_t destination, int16_t alpha)
+{
+  int16_t sr = source >> 11, sg = (source >> 5) & 0x3F, sb = source & 0x1F;
+  int16_t dr = destination >> 11, dg = (destination >> 5) & 0x3F, db = destination & 0x1F;
+
+  dr += ((sr - dr) * alpha) >> 5;
+  dg += ((sg - dg) * alpha) >> 5;
+  db += ((sb - db) * alpha) >> 5;
+
+  return ((uint16_t) dr << 11) | ((uint16_t) dg << 5) | (uint16_t) db;
+}
+
+#if defined(PIXEL_AVX2) || defined(PIXEL_SSE2) || defined(PIXEL_SSSE3)
+/* Thresholds of 4 pixels of row as bytes B, G, R, 0 */
+static inline __m128i ST7789_Pixel_Threshold_SSE2 (int16_t row)
+{
+  return _mm_setr_epi32 ((int) ST7789_Pixel_Threshold (row, 0), (int) ST7789_Pixel_Threshold (row, 1),
+                         (int) ST7789_Pixel_Threshold (row, 2), (int) ST7789_Pixel_Threshold (row, 3));
+}
+
+/* 4 pixels 0x..RRGGBB to RGB565, sign extended in 32 bit lanes for signed pack */
+static inline __m128i ST7789_Pixel_565_SSE2 (__m128i pixels)
+{
+  __m128i r = _mm_and_si128 (_mm_srli_epi32 (pixels, 8), _mm_set1_epi32 (0xF800));
+  __m128i g = _mm_and_si128 (_mm_srli_epi32 (pixels, 5), _mm_set1_epi32 (0x07E0));
+  __m128i b = _mm_and_si128 (_mm_srli_epi32 (pixels, 3), _mm_set1_epi32 (0x001F));
+  __m128i v = _mm_or_si128 (_mm_or_si128 (r, g), b);
+
+  return _mm_srai_epi32 (_mm_slli_epi32 (v, 16), 16);
+}
+#endif
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Fill row by color
+ *
+ * @param   uint16_t * destination
+ * @param   uint16_t color
+ * @param   uint32_t count
+ *
+ * @return  void
+ */
+void ST7789_Pixel_Fill (uint16_t * destination, uint16_t color, uint32_t count)
+{
+#if defined(PIXEL_AVX2)
+  __m256i v = _mm256_set1_epi16 ((short) color);
+  for (; count >= 16; count -= 16, destination += 16) {
+    _mm256_storeu_si256 ((__m256i *) destination, v);
+  }
+#elif defined(PIXEL_SSE2)
+  __m128i v = _mm_set1_epi16 ((short) color);
+  for (; count >= 8; count -= 8, destination += 8) {
+    _mm_storeu_si128 ((__m128i *) destination, v);
+  }
+#endif
+  while (count--) {
+    *destination++ = color;
+  }
+}
+
+/**
+ * @desc    Swap bytes of RGB565 row to wire order, in place allowed
+ *
+ * @param   uint16_t * destination
+ * @param   const uint16_t * source
+ * @param   uint32_t count
+ *
+ * @return  void
+ */
+void ST7789_Pixel_Swap (uint16_t * destination, const uint16_t * source, uint32_t count)
+{
+#if defined(PIXEL_AVX2)
+  __m256i v;
+  for (; count >= 16; count -= 16, source += 16, destination += 16) {
+    v = _mm256_loadu_si256 ((const __m256i *) source);
+    v = _mm256_or_si256 (_mm256_slli_epi16 (v, 8), _mm256_srli_epi16 (v, 8));
+    _mm256_storeu_si256 ((__m256i *) destination, v);
+  }
+#elif defined(PIXEL_SSE2)
+  __m128i v;
+  for (; count >= 8; count -= 8, source += 8, destination += 8) {
+    v = _mm_loadu_si128 ((const __m128i *) source);
+    v = _mm_or_si128 (_mm_slli_epi16 (v, 8), _mm_srli_epi16 (v, 8));
+    _mm_storeu_si128 ((__m128i *) destination, v);
+  }
+#endif
+  while (count--) {
+    *destination++ = (uint16_t) ((*source >> 8) | (*source << 8));
+    source++;
+  }
+}
+
+/**
+ * @desc    RGB888 row (bytes R, G, B) to RGB565
+ *
+ * @param   uint16_t * destination
+ * @param   const uint8_t * source
+ * @param   uint32_t count
+ * @param   int16_t row for ordered dither or ST7789_PIXEL_NO_DITHER
+ *
+ * @return  void
+ */
+void ST7789_Pixel_RGB888 (uint16_t * destination, const uint8_t * source, uint32_t count, int16_t row)
+{
+  uint32_t i = 0;
+
+#if defined(PIXEL_SSSE3)
+  const __m128i order = _mm_setr_epi8 (2, 1, 0, -128, 5, 4, 3, -128, 8, 7, 6, -128, 11, 10, 9, -128);
+  const __m128i threshold = ST7789_Pixel_Threshold_SSE2 (row);
+  __m128i a, b;
+  // 16 byte loads, second one reads 4 bytes past its 4 pixels
+  for (; i + 10 <= count; i += 8, source += 24, destination += 8) {
+    a = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *) source), order);
+    b = _mm_shuffle_epi8 (_mm_loadu_si128 ((const __m128i *) (source + 12)), order);
+    a = ST7789_Pixel_565_SSE2 (_mm_adds_epu8 (a, threshold));
+    b = ST7789_Pixel_565_SSE2 (_mm_adds_epu8 (b, threshold));
+    _mm_storeu_si128 ((__m128i *) destination, _mm_packs_epi32 (a, b));
+  }
+#endif
+  for (; i < count; i++, source += 3) {
+    *destination++ = ST7789_Pixel_Dither_565 (source[0], source[1], source[2], ST7789_Pixel_Bayer (row, i));
+  }
+}
+
+/**
+ * @desc    ARGB8888 row (0xAARRGGBB words) to RGB565, alpha ignored
+ *
+ * @param   uint16_t * destination
+ * @param   const uint32_t * source
+ * @param   uint32_t count
+ * @param   int16_t row for ordered dither or ST7789_PIXEL_NO_DITHER
+ *
+ * @return  void
+ */
+void ST7789_Pixel_ARGB8888 (uint16_t * destination, const uint32_t * source, uint32_t count, int16_t row)
+{
+  uint32_t i = 0;
+
+#if defined(PIXEL_AVX2)
+  const __m256i threshold = _mm256_broadcastsi128_si256 (ST7789_Pixel_Threshold_SSE2 (row));
+  const __m256i mr = _mm256_set1_epi32 (0xF800), mg = _mm256_set1_epi32 (0x07E0), mb = _mm256_set1_epi32 (0x001F);
+  __m256i v[2];
+  uint8_t k;
+  for (; i + 16 <= count; i += 16, source += 16, destination += 16) {
+    for (k = 0; k < 2; k++) {
+      v[k] = _mm256_adds_epu8 (_mm256_loadu_si256 ((const __m256i *) (source + 8 * k)), threshold);
+      v[k] = _mm256_or_si256 (_mm256_or_si256 (_mm256_and_si256 (_mm256_srli_epi32 (v[k], 8), mr),
+                                               _mm256_and_si256 (_mm256_srli_epi32 (v[k], 5), mg)),
+                              _mm256_and_si256 (_mm256_srli_epi32 (v[k], 3), mb));
+      v[k] = _mm256_srai_epi32 (_mm256_slli_epi32 (v[k], 16), 16);
+    }
+    // pack works per 128 bit lane, put quarters back in order
+    _mm256_storeu_si256 ((__m256i *) destination, _mm256_permute4x64_epi64 (_mm256_packs_epi32 (v[0], v[1]), 0xD8));
+  }
+#elif defined(PIXEL_SSE2)
+  const __m128i threshold = ST7789_Pixel_Threshold_SSE2 (row);
+  __m128i a, b;
+  for (; i + 8 <= count; i += 8, source += 8, destination += 8) {
+    a = ST7789_Pixel_565_SSE2 (_mm_adds_epu8 (_mm_loadu_si128 ((const __m128i *) source), threshold));
+    b = ST7789_Pixel_565_SSE2 (_mm_adds_epu8 (_mm_loadu_si128 ((const __m128i *) (source + 4)), threshold));
+    _mm_storeu_si128 ((__m128i *) destination, _mm_packs_epi32 (a, b));
+  }
+#endif
+  for (; i < count; i++, source++) {
+    *destination++ = ST7789_Pixel_Dither_565 ((uint8_t) (*source >> 16), (uint8_t) (*source >> 8), (uint8_t) *source,
+                                              ST7789_Pixel_Bayer (row, i));
+  }
+}
+
+/**
+ * @desc    Blend RGB565 row over destination, alpha 0 .. 255 in steps of 1/32
+ *
+ * @param   uint16_t * destination
+ * @param   const uint16_t * source
+ * @param   uint32_t count
+ * @param   uint8_t alpha of source
+ *
+ * @return  void
+ */
+void ST7789_Pixel_Blend (uint16_t * destination, const uint16_t * source, uint32_t count, uint8_t alpha)
+{
+  int16_t a = (alpha + 4) >> 3;                         // 0 .. 32
+
+#if defined(PIXEL_AVX2)
+  const __m256i va = _mm256_set1_epi16 (a);
+  const __m256i m5 = _mm256_set1_epi16 (0x1F), m6 = _mm256_set1_epi16 (0x3F);
+  __m256i s, d, r, g, b;
+  for (; count >= 16; count -= 16, source += 16, destination += 16) {
+    s = _mm256_loadu_si256 ((const __m256i *) source);
+    d = _mm256_loadu_si256 ((const __m256i *) destination);
+    r = _mm256_srli_epi16 (d, 11);
+    g = _mm256_and_si256 (_mm256_srli_epi16 (d, 5), m6);
+    b = _mm256_and_si256 (d, m5);
+    r = _mm256_add_epi16 (r, _mm256_srai_epi16 (_mm256_mullo_epi16 (_mm256_sub_epi16 (_mm256_srli_epi16 (s, 11), r), va), 5));
+    g = _mm256_add_epi16 (g, _mm256_srai_epi16 (_mm256_mullo_epi16 (_mm256_sub_epi16 (_mm256_and_si256 (_mm256_srli_epi16 (s, 5), m6), g), va), 5));
+    b = _mm256_add_epi16 (b, _mm256_srai_epi16 (_mm256_mullo_epi16 (_mm256_sub_epi16 (_mm256_and_si256 (s, m5), b), va), 5));
+    _mm256_storeu_si256 ((__m256i *) destination, _mm256_or_si256 (_mm256_or_si256 (_mm256_slli_epi16 (r, 11), _mm256_slli_epi16 (g, 5)), b));
+  }
+#elif defined(PIXEL_SSE2)
+  const __m128i va = _mm_set1_epi16 (a);
+  const __m128i m5 = _mm_set1_epi16 (0x1F), m6 = _mm_set1_epi16 (0x3F);
+  __m128i s, d, r, g, b;
+  for (; count >= 8; count -= 8, source += 8, destination += 8) {
+    s = _mm_loadu_si128 ((const __m128i *) source);
+    d = _mm_loadu_si128 ((const __m128i *) destination);
+    r = _mm_srli_epi16 (d, 11);
+    g = _mm_and_si128 (_mm_srli_epi16 (d, 5), m6);
+    b = _mm_and_si128 (d, m5);
+    r = _mm_add_epi16 (r, _mm_srai_epi16 (_mm_mullo_epi16 (_mm_sub_epi16 (_mm_srli_epi16 (s, 11), r), va), 5));
+    g = _mm_add_epi16 (g, _mm_srai_epi16 (_mm_mullo_epi16 (_mm_sub_epi16 (_mm_and_si128 (_mm_srli_epi16 (s, 5), m6), g), va), 5));
+    b = _mm_add_epi16 (b, _mm_srai_epi16 (_mm_mullo_epi16 (_mm_sub_epi16 (_mm_and_si128 (s, m5), b), va), 5));
+    _mm_storeu_si128 ((__m128i *) destination, _mm_or_si128 (_mm_or_si128 (_mm_slli_epi16 (r, 11), _mm_slli_epi16 (g, 5)), b));
+  }
+#endif
+  while (count--) {
+    *destination = ST7789_Pixel_Mix (*source++, *destination, a);
+    destination++;
+  }
+}
+
+/**
+ * @desc    RGB888 row (bytes R, G, B) to RGB565 / RGB444 by Floyd-Steinberg error diffusion
+ *
+ *          Errors carry 3 x count int16_t from row to row, zero them before
+ *          first row. Serial by nature, scalar on all targets.
+ *
+ * @param   uint16_t * destination
+ * @param   const uint8_t * source
+ * @param   uint32_t count
+ * @param   int16_t * errors
+ * @param   uint8_t ST7789_PIXEL_565 / ST7789_PIXEL_444
+ *
+ * @return  void
+ */
+void ST7789_Pixel_Diffuse (uint16_t * destination, const uint8_t * source, uint32_t count, int16_t * errors, uint8_t depth)
+{
+  int16_t right[3] = { 0, 0, 0 };                       // 7/16 to next pixel
+  int16_t diagonal[3] = { 0, 0, 0 };                    // 1/16 of last pixel to next row
+  uint8_t levels[3];
+  uint8_t level[3];
+  int16_t error;
+  uint32_t x;
+  uint8_t c;
+
+  levels[0] = levels[2] = (depth == ST7789_PIXEL_444) ? 15 : 31;
+  levels[1] = (depth == ST7789_PIXEL_444) ? 15 : 63;
+  for (x = 0; x < count; x++) {
+    for (c = 0; c < 3; c++) {
+      level[c] = ST7789_Pixel_Level (*source++ + right[c] + errors[c], levels[c], &error);
+      right[c] = error * 7 / 16;
+      if (x > 0) {
+        errors[c - 3] += error * 3 / 16;                // below left
+      }
+      errors[c] = error * 5 / 16 + diagonal[c];         // below
+      diagonal[c] = error / 16;                         // below right
+    }
+    if (depth == ST7789_PIXEL_444) {
+      level[0] = (level[0] << 1) | (level[0] >> 3);     // 4 bits to 5 / 6 bits
+      level[1] = (level[1] << 2) | (level[1] >> 2);
+      level[2] = (level[2] << 1) | (level[2] >> 3);
+    }
+    *destination++ = ((uint16_t) level[0] << 11) | ((uint16_t) level[1] << 5) | level[2];
+    errors += 3;
+  }
+}
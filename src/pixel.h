@@ -0,0 +1,160 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Pixel Kernels
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        pixel.h
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      hal.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Conversion, blending & fill of RGB565 rows in RAM for host builds
+ *
+ *              Implementation is chosen by compiler flags: AVX2 or SSE2 (SSSE3 for
+ *              RGB888), scalar C anywhere else (ARM too) and with -DST7789_PIXEL_SCALAR.
+ *              All implementations give the same bits, make bench compares them.
+ *
+ *              RGB565 is native uint16_t, ST7789_Pixel_Swap turns it into wire
+ *              order (high byte first) for buffers sent as bytes. Ordered dither
+ *              adds 4x4 Bayer threshold before truncation, first pixel of row
+ *              is column 0 of the matrix.
+ *
+ *              ST7789_BAYER with ST7789_Pixel_Dither_565 / _444 dithers single
+ *              pixels generated at runtime, cheap enough for gradients on MCU.
+ *              ST7789_Pixel_Diffuse is Floyd-Steinberg for images on host.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __PIXEL_H__
+#define __PIXEL_H__
+
+  #include <stdint.h>
+  #include "hal.h"
+
+  #define ST7789_PIXEL_NO_DITHER  -1                    // row argument, plain truncation
+  #define ST7789_PIXEL_565      0                       // 5, 6, 5 bit levels
+  #define ST7789_PIXEL_444      1                       // 4 bit levels, RGB565 words
+
+  /** @array Ordered dither thresholds 0 .. 15, pixel.c */
+  extern const uint8_t BAYER_4X4[4][4] PROGMEM;
+
+  // Threshold of screen position
+  #define ST7789_BAYER(x, y)    pgm_read_byte (&BAYER_4X4[(y) & 3][(x) & 3])
+
+  /**
+   * @desc    RGB888 plus Bayer threshold to RGB565, for gradients on MCU
+   *
+   * @param   uint8_t red
+   * @param   uint8_t green
+   * @param   uint8_t blue
+   * @param   uint8_t threshold 0 .. 15, ST7789_BAYER (x, y)
+   *
+   * @return  uint16_t
+   */
+  static inline uint16_t ST7789_Pixel_Dither_565 (uint8_t r, uint8_t g, uint8_t b, uint8_t threshold)
+  {
+    uint8_t t5 = threshold >> 1, t6 = threshold >> 2;   // half a level of 5 / 6 bits at most
+
+    r = (r > 0xFF - t5) ? 0xFF : r + t5;
+    g = (g > 0xFF - t6) ? 0xFF : g + t6;
+    b = (b > 0xFF - t5) ? 0xFF : b + t5;
+
+    return ((uint16_t) (r & 0xF8) << 8) | ((uint16_t) (g & 0xFC) << 3) | (b >> 3);
+  }
+
+  /**
+   * @desc    RGB888 plus Bayer threshold to RGB444 levels in RGB565 word
+   *
+   * @param   uint8_t red
+   * @param   uint8_t green
+   * @param   uint8_t blue
+   * @param   uint8_t threshold 0 .. 15, ST7789_BAYER (x, y)
+   *
+   * @return  uint16_t
+   */
+  static inline uint16_t ST7789_Pixel_Dither_444 (uint8_t r, uint8_t g, uint8_t b, uint8_t threshold)
+  {
+    r = ((r > 0xFF - threshold) ? 0xFF : r + threshold) >> 4;
+    g = ((g > 0xFF - threshold) ? 0xFF : g + threshold) >> 4;
+    b = ((b > 0xFF - threshold) ? 0xFF : b + threshold) >> 4;
+
+    return ((uint16_t) r << 12) | ((uint16_t) (r >> 3) << 11) | ((uint16_t) g << 7) | ((uint16_t) (g >> 2) << 5) | (b << 1) | (b >> 3);
+  }
+
+  /**
+   * @desc    Fill row by color
+   *
+   * @param   uint16_t * destination
+   * @param   uint16_t color
+   * @param   uint32_t count
+   *
+   * @return  void
+   */
+  void ST7789_Pixel_Fill (uint16_t *, uint16_t, uint32_t);
+
+  /**
+   * @desc    Swap bytes of RGB565 row to wire order, in place allowed
+   *
+   * @param   uint16_t * destination
+   * @param   const uint16_t * source
+   * @param   uint32_t count
+   *
+   * @return  void
+   */
+  void ST7789_Pixel_Swap (uint16_t *, const uint16_t *, uint32_t);
+
+  /**
+   * @desc    RGB888 row (bytes R, G, B) to RGB565
+   *
+   * @param   uint16_t * destination
+   * @param   const uint8_t * source
+   * @param   uint32_t count
+   * @param   int16_t row for ordered dither or ST7789_PIXEL_NO_DITHER
+   *
+   * @return  void
+   */
+  void ST7789_Pixel_RGB888 (uint16_t *, const uint8_t *, uint32_t, int16_t);
+
+  /**
+   * @desc    ARGB8888 row (0xAARRGGBB words) to RGB565, alpha ignored
+   *
+   * @param   uint16_t * destination
+   * @param   const uint32_t * source
+   * @param   uint32_t count
+   * @param   int16_t row for ordered dither or ST7789_PIXEL_NO_DITHER
+   *
+   * @return  void
+   */
+  void ST7789_Pixel_ARGB8888 (uint16_t *, const uint32_t *, uint32_t, int16_t);
+
+  /**
+   * @desc    Blend RGB565 row over destination, alpha 0 .. 255 in steps of 1/32
+   *
+   * @param   uint16_t * destination
+   * @param   const uint16_t * source
+   * @param   uint32_t count
+   * @param   uint8_t alpha of source
+   *
+   * @return  void
+   */
+  void ST7789_Pixel_Blend (uint16_t *, const uint16_t *, uint32_t, uint8_t);
+
+  /**
+   * @desc    RGB888 row to RGB565 / RGB444 by Floyd-Steinberg error diffusion
+   *
+   * @param   uint16_t * destination
+   * @param   const uint8_t * source
+   * @param   uint32_t count
+   * @param   int16_t * errors, 3 x count, zero before first row
+   * @param   uint8_t ST7789_PIXEL_565 / ST7789_PIXEL_444
+   *
+   * @return  void
+   */
+  void ST7789_Pixel_Diffuse (uint16_t *, const uint8_t *, uint32_t, int16_t *, uint8_t);
+
+#endif
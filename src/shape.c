@@ -0,0 +1,470 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Filled Shapes
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        shape.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      shape.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "shape.h"
+
+/** @var View definition, st7789.c */
+extern struct S_VIEW View;
+
+/** @struct Polygon edge, crossing stepped exactly per row */
+struct S_EDGE {
+  int16_t x;                                            // column of crossing, floor
+  int16_t error;                                        // fraction of column, error / dy
+  int16_t step;                                         // whole columns per row
+  int16_t rest;                                         // fraction per row, rest / dy
+  int16_t dy;                                           // rows of edge
+  int16_t ys;                                           // first row
+  int16_t ye;                                           // row after last
+};
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/* Edge from upper vertex a to lower vertex b, a->y < b->y */
+static void ST7789_Shape_Edge (struct S_EDGE * edge, const struct S_POINT * a, const struct S_POINT * b)
+{
+  int16_t dx = b->x - a->x;
+
+  edge->dy = b->y - a->y;
+  edge->step = dx / edge->dy;
+  edge->rest = dx % edge->dy;
+  if (edge->rest < 0) {
+    edge->step--;                                       // floor, rest 0 .. dy - 1
+    edge->rest += edge->dy;
+  }
+  edge->x = a->x;
+  edge->error = 0;
+  edge->ys = a->y;
+  edge->ye = b->y;
+}
+
+/* Edge to next row */
+static inline void ST7789_Shape_Step (struct S_EDGE * edge)
+{
+  edge->x += edge->step;
+  edge->error += edge->rest;
+  if (edge->error >= edge->dy) {
+    edge->x++;
+    edge->error -= edge->dy;
+  }
+}
+
+/* First pixel column with center at or right of crossing */
+static inline int16_t ST7789_Shape_Ceil (const struct S_EDGE * edge)
+{
+  return edge->error ? edge->x + 1 : edge->x;
+}
+
+/* Last row of current view, rows below are not traced */
+static inline int16_t ST7789_Shape_Bottom (void)
+{
+  return View.ye - View.originY;
+}
+
+/* Sort spans of one row, merge touching & overlapping ones, send */
+static void ST7789_Shape_Row (struct st7789 * lcd, int16_t * xs, int16_t * xe, uint8_t n, int16_t y, uint16_t color)
+{
+  int16_t tempXs, tempXe;
+  uint8_t i, j;
+
+  for (i = 1; i < n; i++) {
+    tempXs = xs[i];                                     // insertion sort by start
+    tempXe = xe[i];
+    for (j = i; (j > 0) && (xs[j - 1] > tempXs); j--) {
+      xs[j] = xs[j - 1];
+      xe[j] = xe[j - 1];
+    }
+    xs[j] = tempXs;
+    xe[j] = tempXe;
+  }
+  for (i = 0; i < n; i = j) {
+    tempXe = xe[i];
+    for (j = i + 1; (j < n) && (xs[j] <= tempXe + 1); j++) {
+      if (xe[j] > tempXe) tempXe = xe[j];               // merge
+    }
+    ST7789_FillRect (lcd, xs[i], tempXe, y, y, color);
+  }
+}
+
+/* Integer square root, floor */
+static uint16_t ST7789_Shape_Sqrt (uint32_t value)
+{
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+
+  while (bit > value) {
+    bit >>= 2;
+  }
+  while (bit) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint16_t) root;
+}
+
+/* Division rounded to nearest, den > 0 */
+static int16_t ST7789_Shape_Round (int32_t num, int32_t den)
+{
+  return (int16_t) ((num < 0) ? -((-num + den / 2) / den) : (num + den / 2) / den);
+}
+
+/* Division rounded down, den != 0 */
+static int32_t ST7789_Shape_Floor (int32_t num, int32_t den)
+{
+  int32_t q = num / den;
+
+  if ((q * den != num) && ((num < 0) != (den < 0))) {
+    q--;
+  }
+  return q;
+}
+
+/* Narrow columns xs .. xe of row dy to wedge between angles a & b, b - a <= 180 */
+static void ST7789_Shape_Wedge (int16_t a, int16_t b, int16_t dy, int16_t * xs, int16_t * xe)
+{
+  int32_t ca = ST7789_Cos (a), sa = ST7789_Sin (a);
+  int32_t cb = ST7789_Cos (b), sb = ST7789_Sin (b);
+  int32_t limit;
+
+  // clockwise of a: sa * x <= ca * dy
+  // -------------------------------------------------
+  if (sa > 0) {
+    limit = ST7789_Shape_Floor (ca * dy, sa);
+    if (limit < *xe) *xe = (limit < INT16_MIN) ? INT16_MIN : limit;
+  } else if (sa < 0) {
+    limit = -ST7789_Shape_Floor (ca * dy, -sa);
+    if (limit > *xs) *xs = (limit > INT16_MAX) ? INT16_MAX : limit;
+  } else if (ca * dy < 0) {
+    *xe = *xs - 1;                                      // row outside
+  }
+
+  // counterclockwise of b: sb * x >= cb * dy
+  // -------------------------------------------------
+  if (sb > 0) {
+    limit = -ST7789_Shape_Floor (-cb * dy, sb);
+    if (limit > *xs) *xs = (limit > INT16_MAX) ? INT16_MAX : limit;
+  } else if (sb < 0) {
+    limit = ST7789_Shape_Floor (cb * dy, sb);
+    if (limit < *xe) *xe = (limit < INT16_MIN) ? INT16_MIN : limit;
+  } else if (cb * dy > 0) {
+    *xe = *xs - 1;                                      // row outside
+  }
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Fill polygon, even-odd rule
+ *
+ *          Every row collects crossings of active edges, sorts them
+ *          and fills between pairs. Touching spans are merged, so
+ *          a row of concave polygon costs one window per visible run.
+ *
+ * @param   struct st7789 *
+ * @param   const struct S_POINT * vertices
+ * @param   uint8_t number of vertices
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_FillPolygon (struct st7789 * lcd, const struct S_POINT * vertices, uint8_t n, uint16_t color)
+{
+  struct S_EDGE edges[ST7789_POLYGON_EDGES];
+  int16_t cross[ST7789_POLYGON_EDGES];
+  const struct S_POINT * a;
+  const struct S_POINT * b;
+  int16_t ys = INT16_MAX, ye = INT16_MIN;
+  int16_t xs[ST7789_POLYGON_EDGES / 2];
+  int16_t xe[ST7789_POLYGON_EDGES / 2];
+  int16_t y, temp;
+  uint8_t count = 0, crossings, spans, i, j;
+  ST7789_STATS_API (STATS_SHAPE);
+
+  if ((n < 3) || (n > ST7789_POLYGON_EDGES)) {
+    return ST77XX_ERROR;                                // edge table too small
+  }
+
+  // edge table, horizontal edges dropped
+  // -------------------------------------------------
+  for (i = 0; i < n; i++) {
+    a = &vertices[i];
+    b = &vertices[(i + 1 < n) ? i + 1 : 0];
+    if (a->y == b->y) {
+      continue;                                         // no crossing with any row
+    }
+    if (a->y > b->y) {
+      a = b;                                            // a = upper vertex
+      b = &vertices[i];
+    }
+    ST7789_Shape_Edge (&edges[count], a, b);
+    if (a->y < ys) ys = a->y;
+    if (b->y > ye) ye = b->y;
+    count++;
+  }
+  if (ye > ST7789_Shape_Bottom ()) {
+    ye = ST7789_Shape_Bottom () + 1;                    // rows below clip
+  }
+
+  // rows
+  // -------------------------------------------------
+  for (y = ys; y < ye; y++) {
+    crossings = 0;
+    for (i = 0; i < count; i++) {
+      if ((y >= edges[i].ys) && (y < edges[i].ye)) {
+        temp = ST7789_Shape_Ceil (&edges[i]);           // insertion sort
+        for (j = crossings; (j > 0) && (cross[j - 1] > temp); j--) {
+          cross[j] = cross[j - 1];
+        }
+        cross[j] = temp;
+        crossings++;
+        ST7789_Shape_Step (&edges[i]);                  // next row
+      }
+    }
+    spans = 0;
+    for (i = 0; i + 1 < crossings; i += 2) {
+      xs[spans] = cross[i];
+      xe[spans] = cross[i + 1] - 1;
+      if (xs[spans] <= xe[spans]) {
+        spans++;                                        // pixel center inside
+      }
+    }
+    ST7789_Shape_Row (lcd, xs, xe, spans, y, color);
+  }
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Fill triangle
+ *
+ *          Vertices sorted by row, long edge top-bottom on one side,
+ *          two short edges on the other, one span per row.
+ *
+ * @param   struct st7789 *
+ * @param   int16_t x0
+ * @param   int16_t y0
+ * @param   int16_t x1
+ * @param   int16_t y1
+ * @param   int16_t x2
+ * @param   int16_t y2
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void ST7789_FillTriangle (struct st7789 * lcd, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+{
+  struct S_POINT v[3] = { { x0, y0 }, { x1, y1 }, { x2, y2 } };
+  struct S_POINT temp;
+  struct S_EDGE edgeLong, edgeShort;
+  int16_t y, xs, xe, bottom;
+  uint8_t part;
+  ST7789_STATS_API (STATS_SHAPE);
+
+  // sort vertices v[0].y <= v[1].y <= v[2].y
+  // -------------------------------------------------
+  if (v[0].y > v[1].y) { temp = v[0]; v[0] = v[1]; v[1] = temp; }
+  if (v[1].y > v[2].y) { temp = v[1]; v[1] = v[2]; v[2] = temp; }
+  if (v[0].y > v[1].y) { temp = v[0]; v[0] = v[1]; v[1] = temp; }
+
+  if (v[0].y == v[2].y) {
+    return;                                             // no area
+  }
+  bottom = ST7789_Shape_Bottom ();
+  ST7789_Shape_Edge (&edgeLong, &v[0], &v[2]);          // edge 0 -> 2
+
+  // upper part edge 0 -> 1, lower part edge 1 -> 2
+  // -------------------------------------------------
+  for (part = 0; part < 2; part++) {
+    if (v[part].y == v[part + 1].y) {
+      continue;                                         // flat top or bottom
+    }
+    ST7789_Shape_Edge (&edgeShort, &v[part], &v[part + 1]);
+    for (y = v[part].y; (y < v[part + 1].y) && (y <= bottom); y++) {
+      xs = ST7789_Shape_Ceil (&edgeShort);
+      xe = ST7789_Shape_Ceil (&edgeLong);
+      if (xe < xs) {
+        temp.x = xs; xs = xe; xe = temp.x;              // long edge left
+      }
+      if (xs < xe) {
+        ST7789_FillRect (lcd, xs, xe - 1, y, y, color); // pixel centers inside
+      }
+      ST7789_Shape_Step (&edgeLong);
+      ST7789_Shape_Step (&edgeShort);
+    }
+  }
+}
+
+/**
+ * @desc    Draw line of given width
+ *
+ *          Body is quad around the line filled as polygon, round caps
+ *          are discs of diameter width at both end points.
+ *
+ * @param   struct st7789 *
+ * @param   int16_t x0
+ * @param   int16_t y0
+ * @param   int16_t x1
+ * @param   int16_t y1
+ * @param   uint8_t width in pixels
+ * @param   uint8_t LINE_CAP_BUTT / LINE_CAP_ROUND
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void ST7789_DrawThickLine (struct st7789 * lcd, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint8_t cap, uint16_t color)
+{
+  struct S_POINT quad[4];
+  int32_t dx = x1 - x0;
+  int32_t dy = y1 - y0;
+  uint16_t length = ST7789_Shape_Sqrt (dx * dx + dy * dy);
+  int16_t nx, ny, ax, ay;
+  ST7789_STATS_API (STATS_SHAPE);
+
+  if (cap == LINE_CAP_ROUND) {
+    ST7789_FillCircle (lcd, x0, y0, width >> 1, color);
+    ST7789_FillCircle (lcd, x1, y1, width >> 1, color);
+  }
+  if (length == 0) {
+    return;                                             // no direction
+  }
+  nx = ST7789_Shape_Round (-dy * width, length);        // normal of line length width
+  ny = ST7789_Shape_Round (dx * width, length);
+  ax = nx >> 1;                                         // one side, floor
+  ay = ny >> 1;
+
+  quad[0].x = x0 - ax; quad[0].y = y0 - ay;
+  quad[1].x = x1 - ax; quad[1].y = y1 - ay;
+  quad[2].x = x1 + nx - ax; quad[2].y = y1 + ny - ay;
+  quad[3].x = x0 + nx - ax; quad[3].y = y0 + ny - ay;
+
+  ST7789_FillPolygon (lcd, quad, 4, color);
+}
+
+/**
+ * @desc    Fill circle
+ *
+ * @param   struct st7789 *
+ * @param   int16_t center column
+ * @param   int16_t center row
+ * @param   uint8_t radius
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void ST7789_FillCircle (struct st7789 * lcd, int16_t x, int16_t y, uint8_t radius, uint16_t color)
+{
+  ST7789_STATS_API (STATS_SHAPE);
+  ST7789_FillArc (lcd, x, y, 0, radius, 0, 360, color);
+}
+
+/**
+ * @desc    Fill ring segment
+ *
+ *          Row dy of the ring is one or two runs between inner and
+ *          outer circle (integer square root, no float), each run is
+ *          narrowed to the wedge of start .. start + sweep. Sweep over
+ *          180 degrees is split into two wedges. Pixel is inside if
+ *          inner - 1/2 < distance <= outer + 1/2.
+ *
+ * @param   struct st7789 *
+ * @param   int16_t center column
+ * @param   int16_t center row
+ * @param   uint8_t inner radius
+ * @param   uint8_t outer radius
+ * @param   int16_t start angle
+ * @param   int16_t sweep
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void ST7789_FillArc (struct st7789 * lcd, int16_t x, int16_t y, uint8_t inner, uint8_t outer, int16_t start, int16_t sweep, uint16_t color)
+{
+  int16_t xs[ST7789_ROW_SPANS];
+  int16_t xe[ST7789_ROW_SPANS];
+  int16_t runXs[2], runXe[2];
+  int16_t dy, outside, hole, middle;
+  int16_t bottom = ST7789_Shape_Bottom ();
+  int32_t square;
+  uint8_t runs, spans, wedges, i, w;
+  ST7789_STATS_API (STATS_SHAPE);
+
+  if (sweep <= 0) {
+    return;                                             // nothing
+  }
+  wedges = (sweep >= 360) ? 0 : (sweep > 180) ? 2 : 1;
+  middle = start + (sweep >> 1);                        // split of two wedges
+
+  for (dy = -outer; (dy <= outer) && (y + dy <= bottom); dy++) {
+    square = (int32_t) dy * dy;
+    outside = ST7789_Shape_Sqrt ((int32_t) outer * outer + outer - square);
+
+    // runs of ring
+    // -------------------------------------------------
+    runXs[0] = -outside;
+    runXe[0] = outside;
+    runs = 1;
+    if (inner && (square <= (int32_t) inner * inner - inner)) {
+      hole = ST7789_Shape_Sqrt ((int32_t) inner * inner - inner - square);
+      runXe[0] = -hole - 1;                             // left of hole
+      runXs[1] = hole + 1;                              // right of hole
+      runXe[1] = outside;
+      runs = 2;
+    }
+
+    // runs narrowed to wedges
+    // -------------------------------------------------
+    spans = 0;
+    for (i = 0; i < runs; i++) {
+      if (wedges == 0) {
+        xs[spans] = runXs[i];
+        xe[spans++] = runXe[i];
+      }
+      for (w = 0; w < wedges; w++) {
+        xs[spans] = runXs[i];
+        xe[spans] = runXe[i];
+        if (wedges == 1) {
+          ST7789_Shape_Wedge (start, start + sweep, dy, &xs[spans], &xe[spans]);
+        } else if (w == 0) {
+          ST7789_Shape_Wedge (start, middle, dy, &xs[spans], &xe[spans]);
+        } else {
+          ST7789_Shape_Wedge (middle, start + sweep, dy, &xs[spans], &xe[spans]);
+        }
+        if (xs[spans] <= xe[spans]) {
+          spans++;
+        }
+      }
+    }
+    for (i = 0; i < spans; i++) {
+      xs[i] += x;                                       // to view coordinates
+      xe[i] += x;
+    }
+    ST7789_Shape_Row (lcd, xs, xe, spans, y + dy, color);
+  }
+}
@@ -0,0 +1,121 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Filled Shapes
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        shape.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      st7789.h, trig.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Scanline fill of polygons & triangles, edges in 16.16 fixed point,
+ *              thick lines, circles & ring segments, all output as horizontal
+ *              spans (one window per span)
+ *
+ *              Fill rule: pixel is filled if its center lies inside, the last
+ *              row and the last column of the shape are not filled, so shapes
+ *              sharing an edge do not overdraw each other.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __SHAPE_H__
+#define __SHAPE_H__
+
+  #include "st7789.h"
+  #include "trig.h"
+
+  // Edge table size, 12 bytes of stack per edge
+  // -----------------------------------
+  #define ST7789_POLYGON_EDGES  8                       // max vertices of polygon
+  #define ST7789_ROW_SPANS      4                       // max spans of ring segment row
+
+  // Line caps
+  // -----------------------------------
+  #define LINE_CAP_BUTT         0x00                    // ends square at end points
+  #define LINE_CAP_ROUND        0x01                    // half disc around end points
+
+  /** @struct Polygon vertex */
+  struct S_POINT {
+    int16_t x;                                          // column
+    int16_t y;                                          // row
+  };
+
+  /**
+   * @desc    Fill polygon, even-odd rule, may be concave or self-intersecting
+   *
+   * @param   struct st7789 *
+   * @param   const struct S_POINT * vertices
+   * @param   uint8_t number of vertices (3 .. ST7789_POLYGON_EDGES)
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_FillPolygon (struct st7789 *, const struct S_POINT *, uint8_t, uint16_t);
+
+  /**
+   * @desc    Fill triangle, no edge table
+   *
+   * @param   struct st7789 *
+   * @param   int16_t x0
+   * @param   int16_t y0
+   * @param   int16_t x1
+   * @param   int16_t y1
+   * @param   int16_t x2
+   * @param   int16_t y2
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void ST7789_FillTriangle (struct st7789 *, int16_t, int16_t, int16_t, int16_t, int16_t, int16_t, uint16_t);
+
+  /**
+   * @desc    Draw line of given width
+   *
+   * @param   struct st7789 *
+   * @param   int16_t x0
+   * @param   int16_t y0
+   * @param   int16_t x1
+   * @param   int16_t y1
+   * @param   uint8_t width in pixels
+   * @param   uint8_t LINE_CAP_BUTT / LINE_CAP_ROUND
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void ST7789_DrawThickLine (struct st7789 *, int16_t, int16_t, int16_t, int16_t, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Fill circle
+   *
+   * @param   struct st7789 *
+   * @param   int16_t center column
+   * @param   int16_t center row
+   * @param   uint8_t radius
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void ST7789_FillCircle (struct st7789 *, int16_t, int16_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Fill ring segment, angles in degrees clockwise from 3 o'clock
+   *
+   * @param   struct st7789 *
+   * @param   int16_t center column
+   * @param   int16_t center row
+   * @param   uint8_t inner radius (0 = pie sector)
+   * @param   uint8_t outer radius
+   * @param   int16_t start angle
+   * @param   int16_t sweep, 360 = whole ring
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void ST7789_FillArc (struct st7789 *, int16_t, int16_t, uint8_t, uint8_t, int16_t, int16_t, uint16_t);
+
+#endif
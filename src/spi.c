@@ -21,6 +21,7 @@
 
 // INCLUDE libraries
 #include "spi.h"
+#include "stats.h"
 
 /**
  * @desc    SPI Init
@@ -53,8 +54,26 @@ void SPI_Init (uint8_t settings)
  */
 uint8_t SPI_Transfer (uint8_t data)
 {
+  ST7789_STATS_SPI_BEGIN ();
   SPI_SPDR = data;
   while(!(SPI_SPSR & (1<<SPIF))) 
   ;
+  ST7789_STATS_SPI_END ();
   return SPI_SPDR;
 }
+
+/**
+ * @desc    SPI Speed / double speed on or off
+ *
+ * @param   uint8_t
+ *
+ * @return  void
+ */
+void SPI_Speed (uint8_t speed)
+{
+  if (speed == SPI_SPEED_DOUBLE) {
+    SPI_SPSR |= (1 << SPI2X);
+  } else {
+    SPI_SPSR &= ~(1 << SPI2X);
+  }
+}
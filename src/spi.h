@@ -45,6 +45,8 @@
   // macros
   #define CS_ENABLE()         SPI_PORT &= ~(1 << SPI_SS)
   #define CS_DISABLE()        SPI_PORT |= (1 << SPI_SS)
+  // write byte without call, for inner loops of drivers
+  #define SPI_WRITE(data)     do { SPI_SPDR = (data); while (!(SPI_SPSR & (1 << SPIF))); } while (0)
 
   // SPI init definitions
   #define SPI_MASTER          0x10
@@ -59,6 +61,8 @@
   #define SPI_FOSC_DIV_16     0x01
   #define SPI_FOSC_DIV_64     0x02
   #define SPI_FOSC_DIV_128    0x03
+  #define SPI_SPEED_NORMAL    0x00
+  #define SPI_SPEED_DOUBLE    0x01
 
   /**
    * @desc    SPI Init
@@ -77,5 +81,14 @@
    * @return  uint8_t
    */
   uint8_t SPI_Transfer (uint8_t);
-  
+
+  /**
+   * @desc    SPI Speed / double speed on or off
+   *
+   * @param   uint8_t
+   *
+   * @return  void
+   */
+  void SPI_Speed (uint8_t);
+
 #endif
@@ -0,0 +1,270 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Sprites
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        sprite.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      sprite.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "sprite.h"
+
+/** @var View definition, st7789.c */
+extern struct S_VIEW View;
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/* Pixel of sprite at x, y or key color if sprite does not cover it */
+static uint16_t ST7789_Sprite_Pixel (struct S_SPRITE * sprite, int16_t x, int16_t y)
+{
+  x -= sprite->x;
+  y -= sprite->y;
+  if (!sprite->visible || (x < 0) || (y < 0) ||
+      (x >= sprite->width) || (y >= sprite->height)) {
+    return sprite->key;
+  }
+  return pgm_read_word (&sprite->image[(uint16_t) y * sprite->width + x]);
+}
+
+/* Topmost sprite pixel at x, y, 1 if found */
+static uint8_t ST7789_Sprite_Top (struct S_SCENE * scene, int16_t x, int16_t y, uint16_t * color)
+{
+  struct S_SPRITE * sprite;
+  uint8_t i, z = 0, found = 0;
+  uint16_t pixel;
+
+  for (i = 0; i < scene->count; i++) {
+    sprite = &scene->sprites[i];
+    if (found && (sprite->z < z)) {
+      continue;                                         // below pixel already found
+    }
+    pixel = ST7789_Sprite_Pixel (sprite, x, y);
+    if (pixel != sprite->key) {
+      *color = pixel;
+      z = sprite->z;
+      found = 1;
+    }
+  }
+
+  return found;
+}
+
+/* Compose rectangle (view coordinates) from background callback & sprites, one window */
+static void ST7789_Sprite_Compose (struct st7789 * lcd, struct S_SCENE * scene, int16_t xs, int16_t xe, int16_t ys, int16_t ye)
+{
+  int16_t x, y;
+  uint16_t color;
+
+  if (ST7789_Clip_Rect (&xs, &xe, &ys, &ye) == ST77XX_ERROR) {
+    return;                                             // out of clip, nothing sent
+  }
+  ST7789_Write_Begin (lcd, xs, xe, ys, ye);             // one window
+  for (y = ys - View.originY; y <= ye - View.originY; y++) {
+    for (x = xs - View.originX; x <= xe - View.originX; x++) {
+      color = scene->color;
+      if (!ST7789_Sprite_Top (scene, x, y, &color) && scene->background) {
+        color = scene->background (x, y);
+      }
+      ST7789_WRITE_565 (color);
+    }
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+}
+
+/* Sprite over its save-under, one window */
+static void ST7789_Sprite_Over (struct st7789 * lcd, struct S_SPRITE * sprite)
+{
+  int16_t xs = sprite->x, xe = sprite->x + sprite->width - 1;
+  int16_t ys = sprite->y, ye = sprite->y + sprite->height - 1;
+  int16_t x, y;
+  uint16_t index, color;
+
+  if (ST7789_Clip_Rect (&xs, &xe, &ys, &ye) == ST77XX_ERROR) {
+    return;                                             // out of clip, nothing sent
+  }
+  ST7789_Write_Begin (lcd, xs, xe, ys, ye);             // one window
+  for (y = ys - View.originY - sprite->y; y <= ye - View.originY - sprite->y; y++) {
+    index = (uint16_t) y * sprite->width + (xs - View.originX - sprite->x);
+    for (x = xs; x <= xe; x++, index++) {
+      color = pgm_read_word (&sprite->image[index]);
+      ST7789_WRITE_565 (color == sprite->key ? sprite->under[index] : color);
+    }
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+}
+
+/* Save-under move: background of union = display content with old save-under put back */
+static void ST7789_Sprite_Under (struct st7789 * lcd, struct S_SCENE * scene, struct S_SPRITE * sprite,
+                                 int16_t xs, int16_t xe, int16_t ys, int16_t ye, int16_t x, int16_t y)
+{
+  uint16_t width = xe - xs + 1;
+  uint16_t * work = scene->work;
+  uint16_t pixel, color;
+  uint8_t i, j;
+
+  ST7789_ReadRect (lcd, xs, xe, ys, ye, work);          // display content of union
+  if (sprite->visible) {
+    for (j = 0; j < sprite->height; j++) {              // put back old background
+      for (i = 0; i < sprite->width; i++) {
+        work[(uint16_t) (sprite->y - ys + j) * width + (sprite->x - xs + i)] = sprite->under[(uint16_t) j * sprite->width + i];
+      }
+    }
+  }
+  sprite->x = x;                                        // new position
+  sprite->y = y;
+  for (j = 0; j < sprite->height; j++) {                // save new background & draw sprite
+    for (i = 0; i < sprite->width; i++) {
+      pixel = (uint16_t) (y - ys + j) * width + (x - xs + i);
+      sprite->under[(uint16_t) j * sprite->width + i] = work[pixel];
+      if (sprite->visible) {
+        color = pgm_read_word (&sprite->image[(uint16_t) j * sprite->width + i]);
+        if (color != sprite->key) {
+          work[pixel] = color;
+        }
+      }
+    }
+  }
+  ST7789_DrawImage (lcd, xs, xe, ys, ye, work);         // one window
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Draw all visible sprites, save-under is filled from display
+ *
+ * @param   struct st7789 *
+ * @param   struct S_SCENE *
+ *
+ * @return  void
+ */
+void ST7789_Sprite_Draw (struct st7789 * lcd, struct S_SCENE * scene)
+{
+  struct S_SPRITE * sprite;
+  uint8_t i;
+  ST7789_STATS_API (STATS_SPRITE);
+
+  for (i = 0; i < scene->count; i++) {
+    sprite = &scene->sprites[i];
+    if (!sprite->visible) {
+      continue;
+    }
+    if (sprite->under) {
+      ST7789_ReadRect (lcd, sprite->x, sprite->x + sprite->width - 1,
+                            sprite->y, sprite->y + sprite->height - 1, sprite->under);
+      ST7789_Sprite_Over (lcd, sprite);
+      continue;
+    }
+    ST7789_Sprite_Compose (lcd, scene, sprite->x, sprite->x + sprite->width - 1,
+                                       sprite->y, sprite->y + sprite->height - 1);
+  }
+}
+
+/**
+ * @desc    Move sprite, send union of old & new position only,
+ *          save-under sprite needs scene work buffer for that
+ *
+ * @param   struct st7789 *
+ * @param   struct S_SCENE *
+ * @param   struct S_SPRITE *
+ * @param   int16_t x
+ * @param   int16_t y
+ *
+ * @return  void
+ */
+void ST7789_Sprite_Move (struct st7789 * lcd, struct S_SCENE * scene, struct S_SPRITE * sprite, int16_t x, int16_t y)
+{
+  int16_t oldX = sprite->x, oldY = sprite->y;
+  int16_t w = sprite->width, h = sprite->height;
+  ST7789_STATS_API (STATS_SPRITE);
+
+  if ((x == oldX) && (y == oldY)) {
+    return;                                             // no move, nothing sent
+  }
+
+  // overlapping rectangles -> one window of union,
+  // save-under without work buffer moves as disjoint
+  // --------------------------------------
+  if ((x < oldX + w) && (oldX < x + w) && (y < oldY + h) && (oldY < y + h) &&
+      (!sprite->under || scene->work)) {
+    if (sprite->under) {
+      ST7789_Sprite_Under (lcd, scene, sprite,
+                           x < oldX ? x : oldX, (x < oldX ? oldX : x) + w - 1,
+                           y < oldY ? y : oldY, (y < oldY ? oldY : y) + h - 1, x, y);
+      return;
+    }
+    sprite->x = x;
+    sprite->y = y;
+    ST7789_Sprite_Compose (lcd, scene, x < oldX ? x : oldX, (x < oldX ? oldX : x) + w - 1,
+                                       y < oldY ? y : oldY, (y < oldY ? oldY : y) + h - 1);
+    return;
+  }
+
+  // disjoint rectangles -> old & new window,
+  // save-under restored before new one is read
+  // --------------------------------------
+  if (sprite->under) {
+    if (sprite->visible) {
+      ST7789_DrawImage (lcd, oldX, oldX + w - 1, oldY, oldY + h - 1, sprite->under);
+    }
+    sprite->x = x;
+    sprite->y = y;
+    ST7789_ReadRect (lcd, x, x + w - 1, y, y + h - 1, sprite->under);
+    if (sprite->visible) {
+      ST7789_Sprite_Over (lcd, sprite);
+    }
+    return;
+  }
+  sprite->x = x;
+  sprite->y = y;
+  ST7789_Sprite_Compose (lcd, scene, oldX, oldX + w - 1, oldY, oldY + h - 1);
+  ST7789_Sprite_Compose (lcd, scene, x, x + w - 1, y, y + h - 1);
+}
+
+/**
+ * @desc    Show or hide sprite
+ *
+ * @param   struct st7789 *
+ * @param   struct S_SCENE *
+ * @param   struct S_SPRITE *
+ * @param   uint8_t visible
+ *
+ * @return  void
+ */
+void ST7789_Sprite_Show (struct st7789 * lcd, struct S_SCENE * scene, struct S_SPRITE * sprite, uint8_t visible)
+{
+  int16_t xe = sprite->x + sprite->width - 1;
+  int16_t ye = sprite->y + sprite->height - 1;
+  ST7789_STATS_API (STATS_SPRITE);
+
+  if (sprite->visible == visible) {
+    return;                                             // no change
+  }
+  sprite->visible = visible;
+  if (sprite->under) {
+    if (visible) {
+      ST7789_ReadRect (lcd, sprite->x, xe, sprite->y, ye, sprite->under);
+      ST7789_Sprite_Over (lcd, sprite);
+    } else {
+      ST7789_DrawImage (lcd, sprite->x, xe, sprite->y, ye, sprite->under);
+    }
+    return;
+  }
+  ST7789_Sprite_Compose (lcd, scene, sprite->x, xe, sprite->y, ye);
+}
@@ -0,0 +1,85 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Sprites
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        sprite.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      st7789.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Small set of sprites with z-order and transparent key color,
+ *              moving a sprite sends only old and new bounding rectangles,
+ *              background comes from a callback or per sprite save-under
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __SPRITE_H__
+#define __SPRITE_H__
+
+  #include "st7789.h"
+
+  /** @struct Sprite definition */
+  struct S_SPRITE {
+    int16_t x;                                          // left position
+    int16_t y;                                          // top position
+    uint8_t width;                                      // width in pixels
+    uint8_t height;                                     // height in pixels
+    uint8_t z;                                          // z-order, higher is on top
+    uint8_t visible;                                    // 1 = shown
+    uint16_t key;                                       // transparent color
+    const uint16_t * image;                             // PROGMEM RGB565 row by row
+    uint16_t * under;                                   // save-under width * height or NULL
+  };
+
+  /** @struct Scene definition */
+  struct S_SCENE {
+    struct S_SPRITE * sprites;                          // sprites
+    uint8_t count;                                      // number of sprites
+    uint16_t color;                                     // background color without callback
+    uint16_t (*background) (int16_t, int16_t);          // background color at x, y or NULL
+    uint16_t * work;                                    // save-under moves: (w+|dx|) * (h+|dy|) or NULL
+  };
+
+  /**
+   * @desc    Draw all visible sprites, save-under is filled from display
+   *
+   * @param   struct st7789 *
+   * @param   struct S_SCENE *
+   *
+   * @return  void
+   */
+  void ST7789_Sprite_Draw (struct st7789 *, struct S_SCENE *);
+
+  /**
+   * @desc    Move sprite, send union of old & new position only,
+   *          save-under sprite needs scene work buffer for that
+   *
+   * @param   struct st7789 *
+   * @param   struct S_SCENE *
+   * @param   struct S_SPRITE *
+   * @param   int16_t x
+   * @param   int16_t y
+   *
+   * @return  void
+   */
+  void ST7789_Sprite_Move (struct st7789 *, struct S_SCENE *, struct S_SPRITE *, int16_t, int16_t);
+
+  /**
+   * @desc    Show or hide sprite
+   *
+   * @param   struct st7789 *
+   * @param   struct S_SCENE *
+   * @param   struct S_SPRITE *
+   * @param   uint8_t visible
+   *
+   * @return  void
+   */
+  void ST7789_Sprite_Show (struct st7789 *, struct S_SCENE *, struct S_SPRITE *, uint8_t);
+
+#endif
@@ -18,6 +18,7 @@
  * --------------------------------------------------------------------------------------------+
  * @inspir
  */
+#include <string.h>
 #include "st7789.h"
 
 /** @array Init command */
@@ -38,28 +39,196 @@ const uint8_t INIT_ST7789[] PROGMEM = {
 uint16_t cacheIndexRow = 0;                             // @var array cache memory char index row
 uint16_t cacheIndexCol = 0;                             // @var array cache memory char index column
 
+/** @var Panel definition */
+struct S_PANEL Panel = {
+  .ramWidth = ST7789_WIDTH,
+  .ramHeight = ST7789_HEIGHT,
+  .width = ST7789_PANEL_WIDTH,
+  .height = ST7789_PANEL_HEIGHT,
+  .offsetX = ST7789_PANEL_OFFSET_X,
+  .offsetY = ST7789_PANEL_OFFSET_Y
+};
+
 /** @var Screen definition */
 struct S_SCREEN Screen = {
-  .width = ST7789_WIDTH,
-  .height = ST7789_HEIGHT,
+  .width = ST7789_PANEL_WIDTH,
+  .height = ST7789_PANEL_HEIGHT,
   .marginX = ST7789_MARGIN_X,
-  .marginY = ST7789_MARGIN_Y
+  .marginY = ST7789_MARGIN_Y,
+  .offsetX = ST7789_PANEL_OFFSET_X,
+  .offsetY = ST7789_PANEL_OFFSET_Y,
+  .madctl = ST77XX_ROTATE_0
+};
+
+/** @var View definition */
+struct S_VIEW View = {
+  .originX = 0,
+  .originY = 0,
+  .xs = 0,
+  .xe = ST7789_PANEL_WIDTH - 1,
+  .ys = 0,
+  .ye = ST7789_PANEL_HEIGHT - 1
+};
+
+/** @var Window definition, 0xFFFF = unknown */
+static struct S_WINDOW Window = {
+  .xs = 0xFFFF,
+  .xe = 0xFFFF,
+  .ys = 0xFFFF,
+  .ye = 0xFFFF
+};
+
+/** @var Window setup bytes, chunks point here until next window */
+static uint8_t windowBytes[11] = {
+  ST77XX_CASET, 0, 0, 0, 0,
+  ST77XX_RASET, 0, 0, 0, 0,
+  ST77XX_RAMWR
 };
 
+/** @var View stack */
+static struct S_VIEW viewStack[ST7789_VIEW_DEPTH];      // @var saved views
+static uint8_t viewDepth = 0;                           // @var number of saved views
+
 /**
  * +------------------------------------------------------------------------------------+
  * |== STATIC FUNCTIONS ================================================================|
  * +------------------------------------------------------------------------------------+
  */
 /* Chip Select Active */
-static inline void ST7789_CS_Active (struct st7789 * lcd) { CLR_BIT (*(lcd->cs->port), lcd->cs->pin); }
+static inline void ST7789_CS_Active (struct st7789 * lcd) { ST7789_STATS_COUNT (selects); HAL_Pin_Clear (lcd->cs); }
 /* Chip Select Idle */
-static inline void ST7789_CS_Idle (struct st7789 * lcd) { SET_BIT (*(lcd->cs->port), lcd->cs->pin); }
+static inline void ST7789_CS_Idle (struct st7789 * lcd) { HAL_Wait (); HAL_Pin_Set (lcd->cs); }
 
 /* Command Active */
-static inline void ST7789_DC_Command (struct st7789 * lcd) { CLR_BIT (*(lcd->dc->port), lcd->dc->pin); }
+static inline void ST7789_DC_Command (struct st7789 * lcd) { HAL_Wait (); HAL_Pin_Clear (lcd->dc); }
 /* Data Active */
-static inline void ST7789_DC_Data (struct st7789 * lcd) { SET_BIT (*(lcd->dc->port), lcd->dc->pin); }
+static inline void ST7789_DC_Data (struct st7789 * lcd) { HAL_Wait (); HAL_Pin_Set (lcd->dc); }
+
+/* Memory Write, pixel data follows */
+static inline void ST7789_Memory_Write (struct st7789 * lcd)
+{
+  ST7789_DC_Command (lcd);                              // command (active low)
+  ST7789_WRITE (ST77XX_RAMWR);                          // command
+  ST7789_DC_Data (lcd);                                 // data (active high)
+}
+
+/* Next block of stream, display released while source uses the bus */
+static uint8_t ST7789_Stream_Fill (struct st7789 * lcd, struct S_STREAM * stream)
+{
+  ST7789_CS_Idle (lcd);                                 // chip disable - idle high
+  stream->count = stream->read (stream->context, stream->buffer, ST7789_STREAM_BUFFER);
+  stream->index = 0;
+  ST7789_CS_Active (lcd);                               // chip enable - active low
+
+  return stream->count;
+}
+
+/* Next byte of stream, STREAM_END when source is exhausted */
+static uint8_t ST7789_Stream_Byte (struct st7789 * lcd, struct S_STREAM * stream)
+{
+  if ((stream->index == stream->count) && (ST7789_Stream_Fill (lcd, stream) == 0)) {
+    return ST7789_STREAM_END;
+  }
+  return stream->buffer[stream->index++];
+}
+
+/* Window within screen */
+static inline uint8_t ST7789_Window_Valid (uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
+{
+  return (xs <= xe) && (xe < Screen.width) && (ys <= ye) && (ye < Screen.height);
+}
+
+/* CASET / RASET chunks of valid window, skipped if unchanged, returns number of chunks */
+static uint8_t ST7789_Window_Chunks (struct S_HAL_CHUNK * chunk, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
+{
+  struct S_HAL_CHUNK * first = chunk;
+
+  xs += Screen.offsetX;                                 // visible area to RAM columns
+  xe += Screen.offsetX;
+  ys += Screen.offsetY;                                 // visible area to RAM rows
+  ye += Screen.offsetY;
+  ST7789_STATS_COUNT (windows);
+  HAL_Wait ();                                          // last window may be still on bus
+
+  // CASET, skipped if columns did not change
+  // --------------------------------------
+  if ((xs != Window.xs) || (xe != Window.xe)) {
+    windowBytes[1] = (uint8_t) (xs >> 8);               // High Byte
+    windowBytes[2] = (uint8_t) xs;                      // low Byte
+    windowBytes[3] = (uint8_t) (xe >> 8);               // High Byte
+    windowBytes[4] = (uint8_t) xe;                      // low Byte
+    *chunk++ = (struct S_HAL_CHUNK) { &windowBytes[0], 1, 0, HAL_CHUNK_COMMAND };
+    *chunk++ = (struct S_HAL_CHUNK) { &windowBytes[1], 4, 0, HAL_CHUNK_DATA };
+    Window.xs = xs;
+    Window.xe = xe;
+    ST7789_STATS_COUNT (addresses);
+  }
+
+  // RASET, skipped if rows did not change
+  // --------------------------------------
+  if ((ys != Window.ys) || (ye != Window.ye)) {
+    windowBytes[6] = (uint8_t) (ys >> 8);               // High Byte
+    windowBytes[7] = (uint8_t) ys;                      // low Byte
+    windowBytes[8] = (uint8_t) (ye >> 8);               // High Byte
+    windowBytes[9] = (uint8_t) ye;                      // low Byte
+    *chunk++ = (struct S_HAL_CHUNK) { &windowBytes[5], 1, 0, HAL_CHUNK_COMMAND };
+    *chunk++ = (struct S_HAL_CHUNK) { &windowBytes[6], 4, 0, HAL_CHUNK_DATA };
+    Window.ys = ys;
+    Window.ye = ye;
+    ST7789_STATS_COUNT (addresses);
+  }
+
+  return chunk - first;
+}
+
+/* Line run in screen coordinates, any order of ends, chip select held by caller */
+static void ST7789_Line_Run (struct st7789 * lcd, int16_t x1, int16_t x2, int16_t y1, int16_t y2, uint16_t color)
+{
+  int16_t temp;
+
+  if (x1 > x2) { temp = x1; x1 = x2; x2 = temp; }       // order columns
+  if (y1 > y2) { temp = y1; y1 = y2; y2 = temp; }       // order rows
+
+  ST7789_Fill_Window (lcd, x1, x2, y1, y2, color);      // window & pixels, one transfer
+}
+
+/* Clip without area, left by nested clips that do not overlap */
+static inline uint8_t ST7789_Clip_Empty (void)
+{
+  return (View.xs > View.xe) || (View.ys > View.ye);
+}
+
+/* Cohen-Sutherland outcode of point against clip, empty clip rejects every line */
+static uint8_t ST7789_Clip_Code (int16_t x, int16_t y)
+{
+  uint8_t code = CLIP_INSIDE;
+
+  if (ST7789_Clip_Empty ()) {
+    return CLIP_LEFT | CLIP_RIGHT | CLIP_TOP | CLIP_BOTTOM;
+  }
+  if (x < View.xs) code |= CLIP_LEFT;
+  else if (x > View.xe) code |= CLIP_RIGHT;
+  if (y < View.ys) code |= CLIP_TOP;
+  else if (y > View.ye) code |= CLIP_BOTTOM;
+
+  return code;
+}
+
+/* Fill rectangle in screen coordinates intersected with clip, chip select held by caller */
+static void ST7789_Fill_Clipped (struct st7789 * lcd, int16_t xs, int16_t xe, int16_t ys, int16_t ye, uint16_t color)
+{
+  if (ST7789_Clip_Empty () ||
+      (xs > View.xe) || (xe < View.xs) ||
+      (ys > View.ye) || (ye < View.ys)) {
+    return;                                             // nothing visible
+  }
+  if (xs < View.xs) xs = View.xs;                       // intersection with clip
+  if (xe > View.xe) xe = View.xe;
+  if (ys < View.ys) ys = View.ys;
+  if (ye > View.ye) ye = View.ye;
+
+  ST7789_Fill_Window (lcd, xs, xe, ys, ye, color);      // window & pixels, one transfer
+}
 
 /**
  * +------------------------------------------------------------------------------------+
@@ -67,26 +236,202 @@ static inline void ST7789_DC_Data (struct st7789 * lcd) { SET_BIT (*(lcd->dc->po
  * +------------------------------------------------------------------------------------+
  */
 
+/**
+ * @desc    Reset view to the whole screen
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void ST7789_View_Reset (void)
+{
+  viewDepth = 0;                                        // empty stack
+  View.originX = 0;                                     // origin left-up corner
+  View.originY = 0;
+  View.xs = 0;                                          // clip = whole screen
+  View.xe = Screen.width - 1;
+  View.ys = 0;
+  View.ye = Screen.height - 1;
+}
+
+/**
+ * @desc    Push clip rectangle, coordinates relative to current view
+ *
+ *          Clip that does not overlap the current one is pushed as
+ *          empty, nothing is drawn until it is popped.
+ *
+ * @param   int16_t xs - start position
+ * @param   int16_t xe - end position
+ * @param   int16_t ys - start position
+ * @param   int16_t ye - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Clip_Push (int16_t xs, int16_t xe, int16_t ys, int16_t ye)
+{
+  if (viewDepth >= ST7789_VIEW_DEPTH) {
+    return ST77XX_ERROR;                                // stack full
+  }
+  viewStack[viewDepth++] = View;                        // save current view
+
+  xs += View.originX;                                   // view to screen coordinates
+  xe += View.originX;
+  ys += View.originY;
+  ye += View.originY;
+
+  if (xs > View.xs) View.xs = xs;                       // intersection with current clip
+  if (xe < View.xe) View.xe = xe;
+  if (ys > View.ys) View.ys = ys;
+  if (ye < View.ye) View.ye = ye;
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Push viewport, new origin at xs, ys and clip to its area
+ *
+ * @param   int16_t xs - start position
+ * @param   int16_t xe - end position
+ * @param   int16_t ys - start position
+ * @param   int16_t ye - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_View_Push (int16_t xs, int16_t xe, int16_t ys, int16_t ye)
+{
+  if (ST7789_Clip_Push (xs, xe, ys, ye) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // stack full
+  }
+  View.originX += xs;                                   // nested origin
+  View.originY += ys;
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Pop clip rectangle or viewport
+ *
+ * @param   void
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_View_Pop (void)
+{
+  if (viewDepth == 0) {
+    return ST77XX_ERROR;                                // stack empty
+  }
+  View = viewStack[--viewDepth];                        // restore previous view
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Translate rectangle to screen & intersect with clip
+ *
+ * @param   int16_t * xs - start position
+ * @param   int16_t * xe - end position
+ * @param   int16_t * ys - start position
+ * @param   int16_t * ye - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Clip_Rect (int16_t * xs, int16_t * xe, int16_t * ys, int16_t * ye)
+{
+  int16_t temp;
+
+  if (*xs > *xe) { temp = *xs; *xs = *xe; *xe = temp; } // order columns
+  if (*ys > *ye) { temp = *ys; *ys = *ye; *ye = temp; } // order rows
+
+  *xs += View.originX;                                  // view to screen coordinates
+  *xe += View.originX;
+  *ys += View.originY;
+  *ye += View.originY;
+
+  if (ST7789_Clip_Empty () ||
+      (*xs > View.xe) || (*xe < View.xs) ||
+      (*ys > View.ye) || (*ye < View.ys)) {
+    return ST77XX_ERROR;                                // nothing visible
+  }
+
+  if (*xs < View.xs) *xs = View.xs;                     // intersection with clip
+  if (*xe > View.xe) *xe = View.xe;
+  if (*ys < View.ys) *ys = View.ys;
+  if (*ye > View.ye) *ye = View.ye;
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Translate line to screen & clip by Cohen-Sutherland algorithm
+ * @surce   https://en.wikipedia.org/wiki/Cohen%E2%80%93Sutherland_algorithm
+ *
+ * @param   int16_t * x1 - start position
+ * @param   int16_t * x2 - end position
+ * @param   int16_t * y1 - start position
+ * @param   int16_t * y2 - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Clip_Line (int16_t * x1, int16_t * x2, int16_t * y1, int16_t * y2)
+{
+  uint8_t code1, code2, code;
+  int16_t x, y;
+
+  *x1 += View.originX;                                  // view to screen coordinates
+  *x2 += View.originX;
+  *y1 += View.originY;
+  *y2 += View.originY;
+
+  code1 = ST7789_Clip_Code (*x1, *y1);                  // start point outcode
+  code2 = ST7789_Clip_Code (*x2, *y2);                  // end point outcode
+
+  while (code1 | code2) {
+    if (code1 & code2) {
+      return ST77XX_ERROR;                              // both outside on the same side
+    }
+    code = code1 ? code1 : code2;                       // point outside
+    if (code & CLIP_TOP) {
+      y = View.ys;
+      x = *x1 + (int32_t) (*x2 - *x1) * (y - *y1) / (*y2 - *y1);
+    } else if (code & CLIP_BOTTOM) {
+      y = View.ye;
+      x = *x1 + (int32_t) (*x2 - *x1) * (y - *y1) / (*y2 - *y1);
+    } else if (code & CLIP_LEFT) {
+      x = View.xs;
+      y = *y1 + (int32_t) (*y2 - *y1) * (x - *x1) / (*x2 - *x1);
+    } else {
+      x = View.xe;
+      y = *y1 + (int32_t) (*y2 - *y1) * (x - *x1) / (*x2 - *x1);
+    }
+    if (code == code1) {
+      *x1 = x;                                          // move start point
+      *y1 = y;
+      code1 = ST7789_Clip_Code (x, y);
+    } else {
+      *x2 = x;                                          // move end point
+      *y2 = y;
+      code2 = ST7789_Clip_Code (x, y);
+    }
+  }
+
+  return ST77XX_SUCCESS;
+}
+
 /**
  * @desc    Set text position x, y
  *
- * @param   uint8_t x - position
- * @param   uint8_t y - position
+ * @param   uint16_t x - position
+ * @param   uint16_t y - position
  *
  * @return  char
  */
-char ST7789_SetPosition (uint8_t x, uint8_t y)
+char ST7789_SetPosition (uint16_t x, uint16_t y)
 {
-  if ((x > ST7789_WIDTH) && (y > ST7789_HEIGHT)) {
+  if ((x >= Screen.width) || (y >= Screen.height)) {
     return ST77XX_ERROR;                                // check if coordinates is out of range
-  } 
-  else if ((x > ST7789_WIDTH) && (y <= ST7789_HEIGHT)) {
-    cacheIndexRow = y;                                  // set position y
-    cacheIndexCol = 2;                                  // set position x
-  } else {
-    cacheIndexRow = y;                                  // set position y 
-    cacheIndexCol = x;                                  // set position x
   }
+  cacheIndexRow = y;                                    // set position y
+  cacheIndexCol = x;                                    // set position x
 
   return ST77XX_SUCCESS;
 }
@@ -107,6 +452,7 @@ uint8_t ST7789_DrawString (struct st7789 * lcd, char * str, uint16_t color, enum
   uint16_t i = 0;
   uint16_t x;
   uint16_t y;
+  ST7789_STATS_API (STATS_DRAW_STRING);
 
   while (str[i] != '\0') {
 
@@ -139,66 +485,55 @@ uint8_t ST7789_DrawString (struct st7789 * lcd, char * str, uint16_t color, enum
  */
 char ST7789_DrawChar (struct st7789 * lcd, char character, uint16_t color, enum S_SIZE size)
 {
-  uint8_t letter, idxCol, idxRow;                       // variables
-  
-  if ((character < 0x20) &&
-      (character > 0x7f)) { 
+  uint8_t letter, idxCol, idxRow, run;                  // variables
+  uint8_t dotX = size & 0x01;                           // dot width - 1
+  uint8_t dotY = size >> 7;                             // dot height - 1
+  int16_t x = cacheIndexCol + View.originX;             // left-up corner on screen
+  int16_t y = cacheIndexRow + View.originY;
+  int16_t x2 = x + (CHARS_COLS_LEN << dotX) - 1;        // right-down corner on screen
+  int16_t y2 = y + (CHARS_ROWS_LEN << dotY) - 1;
+  int16_t xs, ys;
+  ST7789_STATS_API (STATS_DRAW_CHAR);
+
+  if (((uint8_t) character < 0x20) ||
+      ((uint8_t) character > 0x7f)) { 
     return ST77XX_ERROR;                                // out of range
   }
-  
-  idxCol = CHARS_COLS_LEN;                              // last column of character array - 5 columns 
-  idxRow = CHARS_ROWS_LEN;                              // last row of character array - 8 rows / bits
 
-  ST7789_CS_Active (lcd);                               // chip enable - active low
+  cacheIndexCol += (CHARS_COLS_LEN << dotX) + 1;        // next character position
 
-  // --------------------------------------
-  // SIZE X1 - normal font 1x high, 1x wide
-  // --------------------------------------
-  if (size == X1) { 
-    while (idxCol--) {
-      letter = pgm_read_byte (&FONTS[character - 32][idxCol]);
-      while (idxRow--) {
-        if (letter & (1 << idxRow)) {
-          ST7789_Set_Window (lcd, cacheIndexCol+idxCol, cacheIndexCol+idxCol, cacheIndexRow+idxRow, cacheIndexRow+idxRow);
-          ST7789_Send_Color_565 (lcd, color, 1);
-        }
-      }
-      idxRow = CHARS_ROWS_LEN;
-    }
-    cacheIndexCol += CHARS_COLS_LEN + 1;
-  // --------------------------------------
-  // SIZE X2 - font 2x higher, normal wide
-  // --------------------------------------
-  } else if (size == X2) {
-    while (idxCol--) {
-      letter = pgm_read_byte (&FONTS[character - 32][idxCol]);
-      while (idxRow--) {
-        if (letter & (1 << idxRow)) {
-          ST7789_Set_Window (lcd, cacheIndexCol+idxCol, cacheIndexCol+idxCol, cacheIndexRow+(idxRow<<1), cacheIndexRow+(idxRow<<1)+1);
-          ST7789_Send_Color_565 (lcd, color, 2);
-        }
-      }
-      idxRow = CHARS_ROWS_LEN;
-    }
-    cacheIndexCol += CHARS_COLS_LEN + 1;
+  if (ST7789_Clip_Empty () ||
+      (x > View.xe) || (x2 < View.xs) ||
+      (y > View.ye) || (y2 < View.ys)) {
+    return ST77XX_SUCCESS;                              // character out of clip, nothing sent
+  }
 
+  idxCol = CHARS_COLS_LEN;                              // last column of character array - 5 columns 
+
+  ST7789_CS_Active (lcd);                               // chip enable - active low
   // --------------------------------------
-  // SIZE X3 - font 2x higher, 2x wider
+  // X1 - 1x1 dots, X2 - 1x2 dots, X3 - 2x2 dots
+  // consecutive dots of column sent as one window
   // --------------------------------------
-  } else if (size == X3) {
-    while (idxCol--) {
-      letter = pgm_read_byte (&FONTS[character - 32][idxCol]);
-      while (idxRow--) {
-        if (letter & (1 << idxRow)) {
-          ST7789_Set_Window (lcd, cacheIndexCol+(idxCol<<1), cacheIndexCol+(idxCol<<1)+1, cacheIndexRow+(idxRow<<1), cacheIndexRow+(idxRow<<1)+1);
-          ST7789_Send_Color_565 (lcd, color, 4);
+  while (idxCol--) {
+    letter = pgm_read_byte (&FONTS[character - 32][idxCol]);
+    xs = x + (idxCol << dotX);
+    idxRow = 0;                                         // first row of character array
+    while (letter) {
+      if (letter & 0x01) {
+        run = idxRow;                                   // run start
+        while (letter & 0x01) {
+          letter >>= 1;
+          idxRow++;
         }
+        ys = y + (run << dotY);
+        ST7789_Fill_Clipped (lcd, xs, xs + dotX, ys, y + (idxRow << dotY) - 1, color);
+      } else {
+        letter >>= 1;
+        idxRow++;
       }
-      idxRow = CHARS_ROWS_LEN;
     }
-    cacheIndexCol += CHARS_COLS_LEN + CHARS_COLS_LEN + 1;
   }
-
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 
   return ST77XX_SUCCESS;
@@ -214,12 +549,128 @@ char ST7789_DrawChar (struct st7789 * lcd, char character, uint16_t color, enum
  */
 void ST7789_ClearScreen (struct st7789 * lcd, uint16_t color) 
 {
+  ST7789_STATS_API (STATS_CLEAR_SCREEN);
   ST7789_CS_Active (lcd);                               // chip enable - active low
-  ST7789_Set_Window (lcd, 0, Screen.width, 0, Screen.height);
-  ST7789_Send_Color_565 (lcd, color, WINDOW_PIXELS);
+  ST7789_Fill_Clipped (lcd, View.xs, View.xe, View.ys, View.ye, color);
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 }
 
+/**
+ * @desc    Fill rectangle
+ *
+ * @param   struct st7789 *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void ST7789_FillRect (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint16_t color)
+{
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;
+  ST7789_STATS_API (STATS_FILL_RECT);
+
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return;                                             // nothing visible
+  }
+  ST7789_CS_Active (lcd);                               // chip enable - active low
+  ST7789_Fill_Window (lcd, x1, x2, y1, y2, color);      // window & pixels, one transfer
+  ST7789_CS_Idle (lcd);                                 // chip disable - idle high
+}
+
+/**
+ * @desc    Read rectangle from display RAM (RAMRD)
+ *
+ * @param   struct st7789 *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint16_t * buffer
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_ReadRect (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint16_t * buffer)
+{
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;           // signed positions
+  int16_t left, top, y;
+  uint16_t width;
+  ST7789_STATS_API (STATS_READ_RECT);
+
+  ST7789_Order (&x1, &x2);                              // buffer starts at top left corner
+  ST7789_Order (&y1, &y2);
+  left = x1;
+  top = y1;
+  width = x2 - x1 + 1;                                  // buffer stride
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // nothing visible
+  }
+  buffer += (uint32_t) (y1 - top - View.originY) * width + (x1 - left - View.originX);
+
+  HAL_Speed (HAL_SPEED_READ);                           // read cycle is slower than write
+  for (y = y1; y <= y2; y++) {
+    ST7789_CS_Active (lcd);                             // chip enable - active low
+    ST7789_Set_Window (lcd, x1, x2, y, y);              // one row
+    ST7789_Read_Color_565 (lcd, buffer, x2 - x1 + 1);   // RAMRD
+    ST7789_CS_Idle (lcd);                               // chip disable - ends read
+    buffer += width;                                    // next row
+  }
+  HAL_Speed (HAL_SPEED_WRITE);                          // back to write speed
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Draw image from RAM buffer
+ *
+ * @param   struct st7789 *
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   const uint16_t * buffer
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_DrawImage (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, const uint16_t * buffer)
+{
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;           // signed positions
+  int16_t left, top, y;
+  uint16_t width;
+  struct S_HAL_CHUNK row;                               // pixels of one row
+  ST7789_STATS_API (STATS_DRAW_IMAGE);
+
+  ST7789_Order (&x1, &x2);                              // buffer starts at top left corner
+  ST7789_Order (&y1, &y2);
+  left = x1;
+  top = y1;
+  width = x2 - x1 + 1;                                  // buffer stride
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // nothing visible
+  }
+  buffer += (uint32_t) (y1 - top - View.originY) * width + (x1 - left - View.originX);
+
+  if (ST7789_Write_Begin (lcd, x1, x2, y1, y2) == ST77XX_ERROR) {
+    ST7789_Write_End (lcd);                             // chip disable - idle high
+    return ST77XX_ERROR;                                // window out of screen
+  }
+  row = (struct S_HAL_CHUNK) { buffer, x2 - x1 + 1, 0, HAL_CHUNK_PIXELS };
+  if (row.length == width) {
+    row.length *= (uint32_t) (y2 - y1 + 1);             // no columns clipped, one chunk
+    y2 = y1;
+  }
+  for (y = y1; y <= y2; y++) {
+    HAL_Write_Chunks (lcd->dc, &row, 1);                // pixels of row
+    buffer += width;                                    // next row
+    row.data = buffer;
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+
+  return ST77XX_SUCCESS;
+}
+
 /**
  * @desc    Draw line by Bresenham algoritm
  * @surce   https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
@@ -233,11 +684,18 @@ void ST7789_ClearScreen (struct st7789 * lcd, uint16_t color)
  *
  * @return  void
  */
-char ST7789_DrawLine (struct st7789 * lcd, uint16_t x1, uint16_t x2, uint16_t y1, uint16_t y2, uint16_t color)
+char ST7789_DrawLine (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint16_t color)
 {
   int16_t D;                                            // determinant
   int16_t delta_x, delta_y;                             // deltas
   int16_t trace_x = 1, trace_y = 1;                     // steps
+  int16_t x1 = xs, x2 = xe, y1 = ys, y2 = ye;           // signed positions
+  int16_t run;                                          // start of current run
+  ST7789_STATS_API (STATS_DRAW_LINE);
+
+  if (ST7789_Clip_Line (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return ST77XX_ERROR;                                // line out of clip, nothing sent
+  }
 
   delta_x = x2 - x1;                                    // delta x
   delta_y = y2 - y1;                                    // delta y
@@ -253,38 +711,40 @@ char ST7789_DrawLine (struct st7789 * lcd, uint16_t x1, uint16_t x2, uint16_t y1
   }
 
   // Bresenham condition for m < 1 (dy < dx)
+  // pixels on one row are sent as one horizontal run
   // ---------------------------------------
   ST7789_CS_Active (lcd);                               // chip enable - active low
   if (delta_y < delta_x) {
     D = (delta_y << 1) - delta_x;                       // calculate determinant
-    ST7789_Set_Window (lcd, x1, x1, y1, y1);            // set window
-    ST7789_Send_Color_565 (lcd, color, 1);              // draw pixel by 565 mode
+    run = x1;                                           // run start
     while (x1 != x2) {                                  // check if x1 equal x2
       x1 += trace_x;                                    // update x1
       if (D >= 0) {                                     // check if determinant is positive
+        ST7789_Line_Run (lcd, run, x1 - trace_x, y1, y1, color);
+        run = x1;                                       // new run on next row
         y1 += trace_y;                                  // update y1
         D -= 2*delta_x;                                 // update determinant
       }
       D += 2*delta_y;                                   // update deteminant
-      ST7789_Set_Window (lcd, x1, x1, y1, y1);          // set window
-      ST7789_Send_Color_565 (lcd, color, 1);            // draw pixel by 565 mode
     }
+    ST7789_Line_Run (lcd, run, x1, y1, y1, color);      // last run
   // Bresenham condition for m > 1 (dy > dx)
+  // pixels on one column are sent as one vertical run
   // ---------------------------------------
   } else {
     D = delta_y - (delta_x << 1);                       // calculate determinant
-    ST7789_Set_Window (lcd, x1, x1, y1, y1);            // set window
-    ST7789_Send_Color_565 (lcd, color, 1);              // draw pixel by 565 mode
+    run = y1;                                           // run start
     while (y1 != y2) {                                  // check if y2 equal y1
       y1 += trace_y;                                    // update y1
       if (D <= 0) {                                     // check if determinant is positive
+        ST7789_Line_Run (lcd, x1, x1, run, y1 - trace_y, color);
+        run = y1;                                       // new run on next column
         x1 += trace_x;                                  // update y1
         D += 2*delta_y;                                 // update determinant
       }
       D -= 2*delta_x;                                   // update deteminant
-      ST7789_Set_Window (lcd, x1, x1, y1, y1);          // set window
-      ST7789_Send_Color_565 (lcd, color, 1);            // draw pixel by 565 mode
     }
+    ST7789_Line_Run (lcd, x1, x1, run, y1, color);      // last run
   }
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 
@@ -304,14 +764,16 @@ char ST7789_DrawLine (struct st7789 * lcd, uint16_t x1, uint16_t x2, uint16_t y1
  */
 void ST7789_FastLineHorizontal (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t y, uint16_t color)
 {
-  if (xs > xe) {                                        // check if start is > as end
-    uint8_t temp = xs;                                  // temporary safe
-    xe = xs;                                            // start change for end
-    xs = temp;                                          // end change for start
+  int16_t x1 = xs, x2 = xe, y1 = y, y2 = y;             // signed positions
+  ST7789_STATS_API (STATS_FAST_LINE);
+
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return;                                             // line out of clip, nothing sent
   }
+  xs = x1;                                              // clipped start
+  xe = x2;                                              // clipped end
   ST7789_CS_Active (lcd);                               // chip enable - active low
-  ST7789_Set_Window (lcd, xs, xe, y, y);                // set window
-  ST7789_Send_Color_565 (lcd, color, xe - xs);          // draw pixel by 565 mode
+  ST7789_Fill_Window (lcd, xs, xe, y1, y1, color);      // window & pixels, ends inclusive
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 }
 
@@ -328,14 +790,16 @@ void ST7789_FastLineHorizontal (struct st7789 * lcd, uint16_t xs, uint16_t xe, u
  */
 void ST7789_FastLineVertical (struct st7789 * lcd, uint16_t x, uint16_t ys, uint16_t ye, uint16_t color)
 {
-  if (ys > ye) {                                        // check if start is > as end
-    uint8_t temp = ys;                                  // temporary safe
-    ye = ys;                                            // start change for end
-    ys = temp;                                          // end change for start
+  int16_t x1 = x, x2 = x, y1 = ys, y2 = ye;             // signed positions
+  ST7789_STATS_API (STATS_FAST_LINE);
+
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return;                                             // line out of clip, nothing sent
   }
+  ys = y1;                                              // clipped start
+  ye = y2;                                              // clipped end
   ST7789_CS_Active (lcd);                               // chip enable - active low
-  ST7789_Set_Window (lcd, x, x, ys, ye);                // set window
-  ST7789_Send_Color_565 (lcd, color, ye - ys);          // draw pixel by 565 mode
+  ST7789_Fill_Window (lcd, x1, x1, ys, ye, color);      // window & pixels, ends inclusive
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 }
 
@@ -344,16 +808,21 @@ void ST7789_FastLineVertical (struct st7789 * lcd, uint16_t x, uint16_t ys, uint
  *
  * @param   struct st7789 * lcd
  * @param   uint16_t x position / 0 <= cols <= MAX_X-1
- * @param   uint8_t y position / 0 <= rows <= MAX_Y-1
+ * @param   uint16_t y position / 0 <= rows <= MAX_Y-1
  * @param   uint16_t color
  *
  * @return  void
  */
-void ST7789_DrawPixel (struct st7789 * lcd, uint16_t x, uint8_t y, uint16_t color)
+void ST7789_DrawPixel (struct st7789 * lcd, uint16_t x, uint16_t y, uint16_t color)
 {
+  int16_t x1 = x, x2 = x, y1 = y, y2 = y;               // signed positions
+  ST7789_STATS_API (STATS_DRAW_PIXEL);
+
+  if (ST7789_Clip_Rect (&x1, &x2, &y1, &y2) == ST77XX_ERROR) {
+    return;                                             // pixel out of clip, nothing sent
+  }
   ST7789_CS_Active (lcd);                               // chip enable - active low
-  ST7789_Set_Window (lcd, x, x, y, y);                  // set window
-  ST7789_Send_Color_565 (lcd, color, 1);                // draw pixel by 565 mode
+  ST7789_Fill_Window (lcd, x1, x1, y1, y1, color);      // window & pixel, one transfer
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 }
 
@@ -405,6 +874,42 @@ void ST7789_InvertColorOff (struct st7789 * lcd)
   ST7789_Send_Command (lcd, ST77XX_INVOFF);             // inversion off
 }
 
+/**
+ * @desc    Vertical Scrolling Definition
+ *
+ * @param   struct st7789 * lcd
+ * @param   uint16_t top fixed area
+ * @param   uint16_t vertical scrolling area
+ * @param   uint16_t bottom fixed area
+ *
+ * @return  void
+ */
+void ST7789_Scroll_Define (struct st7789 * lcd, uint16_t tfa, uint16_t vsa, uint16_t bfa)
+{
+  ST7789_Send_Command (lcd, ST77XX_VSCRDEF);            // vertical scrolling definition
+  ST7789_Send_Data_Byte (lcd, (uint8_t) (tfa >> 8));    // top fixed area
+  ST7789_Send_Data_Byte (lcd, (uint8_t) tfa);
+  ST7789_Send_Data_Byte (lcd, (uint8_t) (vsa >> 8));    // vertical scrolling area
+  ST7789_Send_Data_Byte (lcd, (uint8_t) vsa);
+  ST7789_Send_Data_Byte (lcd, (uint8_t) (bfa >> 8));    // bottom fixed area
+  ST7789_Send_Data_Byte (lcd, (uint8_t) bfa);
+}
+
+/**
+ * @desc    Vertical Scroll Start Address
+ *
+ * @param   struct st7789 * lcd
+ * @param   uint16_t start line
+ *
+ * @return  void
+ */
+void ST7789_Scroll_Start (struct st7789 * lcd, uint16_t line)
+{
+  ST7789_Send_Command (lcd, ST77XX_VSCSAD);             // vertical scroll start address
+  ST7789_Send_Data_Byte (lcd, (uint8_t) (line >> 8));   // start line
+  ST7789_Send_Data_Byte (lcd, (uint8_t) line);
+}
+
 /**
  * @desc    Init st7789 driver
  *
@@ -415,25 +920,28 @@ void ST7789_InvertColorOff (struct st7789 * lcd)
  */
 void ST7789_Init (struct st7789 * lcd, uint8_t madctl)
 {
-  // SPI Init (cs, settings)
+  // Bus Init
   // ----------------------------------------------------------------
-  SPI_Init (SPI_MASTER | SPI_MODE_0 | SPI_MSB_FIRST | SPI_FOSC_DIV_4);
+  HAL_Init ();
+#if defined(ST7789_FRAMEBUFFER)
+  HAL_Frame_Panel (lcd->cs, lcd->dc);                   // driver draws into frame
+#endif
 
   // DDR
   // --------------------------------------
-  SET_BIT (*(lcd->rs->ddr), lcd->rs->pin);              // Reset
-  SET_BIT (*(lcd->cs->ddr), lcd->cs->pin);              // Chip Select
-  SET_BIT (*(lcd->bl->ddr), lcd->bl->pin);              // BackLight
-  SET_BIT (*(lcd->dc->ddr), lcd->dc->pin);              // Data/Command
+  HAL_Pin_Output (lcd->rs);                             // Reset
+  HAL_Pin_Output (lcd->cs);                             // Chip Select
+  HAL_Pin_Output (lcd->bl);                             // BackLight
+  HAL_Pin_Output (lcd->dc);                             // Data/Command
   // PORT
   // --------------------------------------
-  SET_BIT (*(lcd->rs->port), lcd->rs->pin);             // Reset hold H
-  SET_BIT (*(lcd->cs->port), lcd->cs->pin);             // Chip Select H
-  SET_BIT (*(lcd->bl->port), lcd->bl->pin);             // BackLigt ON
+  HAL_Pin_Set (lcd->rs);                                // Reset hold H
+  HAL_Pin_Set (lcd->cs);                                // Chip Select H
+  HAL_Pin_Set (lcd->bl);                                // BackLigt ON
 
   // POWER UP
   // --------------------------------------
-  _delay_ms (10);                                       // power up time delay +/- no limit
+  HAL_Delay_ms (10);                                    // power up time delay +/- no limit
 
   // HW RESET
   // --------------------------------------
@@ -442,6 +950,7 @@ void ST7789_Init (struct st7789 * lcd, uint8_t madctl)
   // INIT SEQUENCE
   // --------------------------------------
   ST7789_Init_Sequence (lcd, INIT_ST7789);
+  ST7789_Window_Invalidate ();                          // software reset, window unknown
   
   // SET CONFIGURATION
   // --------------------------------------
@@ -466,18 +975,54 @@ void ST7789_Set_MADCTL (struct st7789 * lcd, uint8_t madctl)
 {
   ST7789_CS_Active (lcd);                               // chip enable - active low
   ST7789_DC_Command (lcd);                              // command (active low)
-  SPI_Transfer (ST77XX_MADCTL);                         // Memory Data Access Control
+  ST7789_WRITE (ST77XX_MADCTL);                         // Memory Data Access Control
   ST7789_DC_Data (lcd);                                 // data (active high)
-  SPI_Transfer (madctl);                                // set configuration like rotation, refresh,...
+  ST7789_WRITE (madctl);                                // set configuration like rotation, refresh,...
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 
-  if (((0xF0 & madctl) == ST77XX_ROTATE_90) ||
-      ((0xF0 & madctl) == ST77XX_ROTATE_270)) {
-    Screen.width = ST7789_HEIGHT;
-    Screen.height = ST7789_WIDTH;
-    Screen.marginX = (Screen.marginX << 1) + 10;
-    Screen.marginY = 20;
+  ST7789_Set_Orientation (madctl);                      // screen size & RAM offsets
+}
+
+/**
+ * @desc    Set Orientation
+ *
+ *          Screen is recomputed from Panel every call, so repeated
+ *          calls with the same madctl give the same result.
+ *          MX mirrors RAM columns, MY mirrors RAM rows, MV exchanges
+ *          which of them is addressed by CASET and RASET.
+ *
+ * @param   uint8_t madctl
+ *
+ * @return  void
+ */
+void ST7789_Set_Orientation (uint8_t madctl)
+{
+  uint16_t col = Panel.offsetX;                         // first visible RAM column
+  uint16_t row = Panel.offsetY;                         // first visible RAM row
+
+  if (madctl & ST77XX_X_MIRROR) {
+    col = Panel.ramWidth - Panel.width - Panel.offsetX;
+                                                        // column address order reversed
+  }
+  if (madctl & ST77XX_Y_MIRROR) {
+    row = Panel.ramHeight - Panel.height - Panel.offsetY;
+                                                        // row address order reversed
+  }
+
+  if (madctl & ST77XX_XY_CHANGE) {
+    Screen.width = Panel.height;                        // rows become columns
+    Screen.height = Panel.width;                        // columns become rows
+    Screen.offsetX = row;                               // CASET addresses RAM rows
+    Screen.offsetY = col;                               // RASET addresses RAM columns
+  } else {
+    Screen.width = Panel.width;                         // columns
+    Screen.height = Panel.height;                       // rows
+    Screen.offsetX = col;                               // CASET addresses RAM columns
+    Screen.offsetY = row;                               // RASET addresses RAM rows
   }
+  Screen.madctl = madctl;                               // current configuration
+
+  ST7789_View_Reset ();                                 // clip to new screen size
 }
 
 /**
@@ -493,32 +1038,16 @@ void ST7789_Set_MADCTL (struct st7789 * lcd, uint8_t madctl)
  */
 uint8_t ST7789_Set_Window (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
 {
-  if ((xs > xe) || (xe > Screen.width) ||
-      (ys > ye) || (ye > Screen.height)) {
+  struct S_HAL_CHUNK chunks[4];
+  uint8_t count;
+
+  if (!ST7789_Window_Valid (xs, xe, ys, ye)) {
     return ST77XX_ERROR;                                // out of range
   }
-
-  // CASET
-  // --------------------------------------
-  ST7789_DC_Command (lcd);                              // command (active low)
-  SPI_Transfer (ST77XX_CASET);                          // command
-  
-  ST7789_DC_Data (lcd);                                 // data (active high)
-  SPI_Transfer ((uint8_t) (xs >> 8));                   // transfer High Byte
-  SPI_Transfer ((uint8_t) xs);                          // transfer low Byte
-  SPI_Transfer ((uint8_t) (xe >> 8));                   // transfer High Byte
-  SPI_Transfer ((uint8_t) xe);                          // transfer low Byte
-  
-  // RASET
-  // --------------------------------------
-  ST7789_DC_Command (lcd);                              // command (active low)
-  SPI_Transfer (ST77XX_RASET);                          // command
-  
-  ST7789_DC_Data (lcd);                                 // data (active high)
-  SPI_Transfer ((uint8_t) (ys >> 8));                   // transfer High Byte
-  SPI_Transfer ((uint8_t) ys);                          // transfer low Byte
-  SPI_Transfer ((uint8_t) (ye >> 8));                   // transfer High Byte
-  SPI_Transfer ((uint8_t) ye);                          // transfer low Byte
+  count = ST7789_Window_Chunks (chunks, xs, xe, ys, ye);
+  if (count) {
+    HAL_Write_Chunks (lcd->dc, chunks, count);          // CASET / RASET
+  }
 
   return ST77XX_SUCCESS;                                // success
 }
@@ -536,14 +1065,173 @@ void ST7789_Send_Color_565 (struct st7789 * lcd, uint16_t color, uint32_t count)
 {
   // RAMWR
   // --------------------------------------
+  ST7789_Memory_Write (lcd);                            // command & data mode
+
+  HAL_Write_Repeat (color, count);                      // pixels
+}
+
+/**
+ * @desc    Begin pixel stream
+ *
+ * @param   struct st7789 * lcd
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Write_Begin (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
+{
+  ST7789_CS_Active (lcd);                               // chip enable - active low
+  return ST7789_Write_Window (lcd, xs, xe, ys, ye);     // window & RAMWR
+}
+
+/**
+ * @desc    End pixel stream
+ *
+ * @param   struct st7789 * lcd
+ *
+ * @return  void
+ */
+void ST7789_Write_End (struct st7789 * lcd)
+{
+  ST7789_CS_Idle (lcd);                                 // chip disable - idle high
+}
+
+/**
+ * @desc    Window & RAMWR, chip select held by caller, nothing sent
+ *          for window out of screen or inverted
+ *
+ * @param   struct st7789 * lcd
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Write_Window (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
+{
+  struct S_HAL_CHUNK chunks[5];
+  uint8_t count;
+
+  if (!ST7789_Window_Valid (xs, xe, ys, ye)) {
+    return ST77XX_ERROR;                                // out of range
+  }
+  count = ST7789_Window_Chunks (chunks, xs, xe, ys, ye);
+  chunks[count++] = (struct S_HAL_CHUNK) { &windowBytes[10], 1, 0, HAL_CHUNK_COMMAND };
+  HAL_Write_Chunks (lcd->dc, chunks, count);            // window & RAMWR
+  ST7789_DC_Data (lcd);                                 // data follows
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Fill window with color, window, RAMWR & pixels as one chunk list,
+ *          chip select held by caller
+ *
+ * @param   struct st7789 * lcd
+ * @param   uint16_t xs - start position
+ * @param   uint16_t xe - end position
+ * @param   uint16_t ys - start position
+ * @param   uint16_t ye - end position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Fill_Window (struct st7789 * lcd, uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye, uint16_t color)
+{
+  struct S_HAL_CHUNK chunks[6];
+  uint8_t count;
+
+  if (!ST7789_Window_Valid (xs, xe, ys, ye)) {
+    return ST77XX_ERROR;                                // out of range
+  }
+  count = ST7789_Window_Chunks (chunks, xs, xe, ys, ye);
+  chunks[count++] = (struct S_HAL_CHUNK) { &windowBytes[10], 1, 0, HAL_CHUNK_COMMAND };
+  chunks[count++] = (struct S_HAL_CHUNK) { NULL, (uint32_t) (xe - xs + 1) * (ye - ys + 1), color, HAL_CHUNK_REPEAT };
+  HAL_Write_Chunks (lcd->dc, chunks, count);            // one transfer
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Begin batch of transfers
+ *
+ * @param   struct st7789 * lcd
+ *
+ * @return  void
+ */
+void ST7789_Batch_Begin (struct st7789 * lcd)
+{
+  ST7789_CS_Active (lcd);                               // chip enable - active low
+}
+
+/**
+ * @desc    End batch of transfers
+ *
+ * @param   struct st7789 * lcd
+ *
+ * @return  void
+ */
+void ST7789_Batch_End (struct st7789 * lcd)
+{
+  ST7789_CS_Idle (lcd);                                 // chip disable - idle high
+}
+
+/**
+ * @desc    Forget last window
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void ST7789_Window_Invalidate (void)
+{
+  Window.xs = 0xFFFF;                                   // no valid RAM address
+  Window.xe = 0xFFFF;
+  Window.ys = 0xFFFF;
+  Window.ye = 0xFFFF;
+}
+
+/**
+ * @desc    Read Color Pixels
+ *
+ *          4-line serial read: RAMRD, one dummy byte,
+ *          then 3 bytes per pixel with 6 bit R, G, B left aligned,
+ *          HAL_Read bursts of ST7789_READ_PIXELS pixels
+ *
+ * @param   struct st7789 * lcd
+ * @param   uint16_t * buffer
+ * @param   uint32_t counter
+ *
+ * @return  void
+ */
+void ST7789_Read_Color_565 (struct st7789 * lcd, uint16_t * buffer, uint32_t count)
+{
+  uint8_t bytes[1 + 3 * ST7789_READ_PIXELS];            // dummy & R, G, B of pixels
+  uint8_t * rgb;
+  uint16_t part, i;
+  uint8_t dummy = 1;                                    // dummy byte leads first read
+
+  // RAMRD
+  // --------------------------------------
   ST7789_DC_Command (lcd);                              // command (active low)
-  SPI_Transfer (ST77XX_RAMWR);                          // command
-  
+  ST7789_WRITE (ST77XX_RAMRD);                          // command
+
   ST7789_DC_Data (lcd);                                 // data (active high)
-  while (count--) {
-    SPI_Transfer ((uint8_t) (color >> 8));              // transfer High Byte
-    SPI_Transfer ((uint8_t) color);                     // transfer low Byte
-  }
+  do {
+    part = (count > ST7789_READ_PIXELS) ? ST7789_READ_PIXELS : count;
+    memset (bytes, ST77XX_NOP, dummy + 3 * part);
+    HAL_Read (bytes, dummy + 3 * part);                 // full duplex, one burst
+    rgb = bytes + dummy;
+    for (i = 0; i < part; i++, rgb += 3) {
+      *buffer++ = RGB666_TO_565 (rgb[0], rgb[1], rgb[2]);
+    }
+    count -= part;
+    dummy = 0;
+  } while (count);
 }
 
 /**
@@ -565,10 +1253,10 @@ void ST7789_Send_Color_565 (struct st7789 * lcd, uint16_t color, uint32_t count)
  */
 void ST7789_Reset_HW (struct signal * reset)
 {
-  CLR_BIT (*(reset->port), reset->pin);                 // Reset Impulse
-  _delay_us (100);                                      // >10us
-  SET_BIT (*(reset->port), reset->pin);                 //
-  _delay_ms (120);                                      // >120 ms
+  HAL_Pin_Clear (reset);                                // Reset Impulse
+  HAL_Delay_ms (1);                                     // >10us
+  HAL_Pin_Set (reset);                                  //
+  HAL_Delay_ms (120);                                   // >120 ms
 }
 
 /**
@@ -600,6 +1288,129 @@ void ST7789_Init_Sequence (struct st7789 * lcd, const uint8_t * list)
   }
 }
 
+/**
+ * @desc    Play command stream
+ *
+ *          Record:
+ *            cmd, n, data[n]                     n = 0 .. 0xFC bytes
+ *            cmd, STREAM_LONG, n[15:8], n[7:0], data[n]
+ *            cmd, STREAM_REPEAT, color[15:8], color[7:0], count[15:8], count[7:0]
+ *            cmd, STREAM_DELAY, ms
+ *          ends with command STREAM_END (NOP). Chip select is held
+ *          for the whole stream, data is sent without decoding.
+ *
+ * @param   struct st7789 *
+ * @param   const uint8_t *
+ *
+ * @return  void
+ */
+void ST7789_Stream_Play (struct st7789 * lcd, const uint8_t * stream)
+{
+  uint8_t command, high, low;
+  uint16_t length;
+  ST7789_STATS_API (STATS_STREAM);
+
+  ST7789_CS_Active (lcd);                               // chip enable - active low
+  while ((command = pgm_read_byte (stream++)) != ST7789_STREAM_END) {
+    ST7789_DC_Command (lcd);                            // command (active low)
+    ST7789_WRITE (command);
+    ST7789_DC_Data (lcd);                               // data (active high)
+
+    length = pgm_read_byte (stream++);
+    if (length == ST7789_STREAM_REPEAT) {
+      high = pgm_read_byte (stream++);                  // color
+      low = pgm_read_byte (stream++);
+      length = pgm_read_byte (stream++) << 8;           // count
+      length |= pgm_read_byte (stream++);
+      HAL_Write_Repeat (((uint16_t) high << 8) | low, length);
+      continue;
+    }
+    if (length == ST7789_STREAM_DELAY) {
+      ST7789_Delay_ms (pgm_read_byte (stream++));
+      continue;
+    }
+    if (length == ST7789_STREAM_LONG) {
+      length = pgm_read_byte (stream++) << 8;           // 16 bit length
+      length |= pgm_read_byte (stream++);
+    }
+    while (length--) {
+      ST7789_WRITE (pgm_read_byte (stream++));          // data burst
+    }
+  }
+  ST7789_CS_Idle (lcd);                                 // chip disable - idle high
+
+  ST7789_Window_Invalidate ();                          // CASET / RASET set by stream
+}
+
+/**
+ * @desc    Run command stream from external source
+ *
+ *          Same records as ST7789_Stream_Play. Source is read by
+ *          blocks of ST7789_STREAM_BUFFER bytes, literal data is sent
+ *          from the block in one burst, chip select is released only
+ *          while the next block is read, so the source may share the
+ *          SPI bus.
+ *
+ * @param   struct st7789 *
+ * @param   struct S_STREAM *
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Stream_Run (struct st7789 * lcd, struct S_STREAM * stream)
+{
+  uint8_t command, high, low, burst;
+  uint16_t length;
+  ST7789_STATS_API (STATS_STREAM);
+
+  stream->index = 0;                                    // empty block
+  stream->count = 0;
+
+  ST7789_CS_Active (lcd);                               // chip enable - active low
+  while ((command = ST7789_Stream_Byte (lcd, stream)) != ST7789_STREAM_END) {
+    ST7789_DC_Command (lcd);                            // command (active low)
+    ST7789_WRITE (command);
+    ST7789_DC_Data (lcd);                               // data (active high)
+
+    length = ST7789_Stream_Byte (lcd, stream);
+    if (length == ST7789_STREAM_REPEAT) {
+      high = ST7789_Stream_Byte (lcd, stream);          // color
+      low = ST7789_Stream_Byte (lcd, stream);
+      length = ST7789_Stream_Byte (lcd, stream) << 8;   // count
+      length |= ST7789_Stream_Byte (lcd, stream);
+      HAL_Write_Repeat (((uint16_t) high << 8) | low, length);
+      continue;
+    }
+    if (length == ST7789_STREAM_DELAY) {
+      ST7789_Delay_ms (ST7789_Stream_Byte (lcd, stream));
+      continue;
+    }
+    if (length == ST7789_STREAM_LONG) {
+      length = ST7789_Stream_Byte (lcd, stream) << 8;   // 16 bit length
+      length |= ST7789_Stream_Byte (lcd, stream);
+    }
+    while (length) {
+      if ((stream->index == stream->count) && (ST7789_Stream_Fill (lcd, stream) == 0)) {
+        break;                                          // source ended inside record
+      }
+      burst = stream->count - stream->index;            // rest of block
+      if (burst > length) {
+        burst = length;
+      }
+      length -= burst;
+      HAL_Write (&stream->buffer[stream->index], burst); // data burst
+      stream->index += burst;
+    }
+  }
+  ST7789_CS_Idle (lcd);                                 // chip disable - idle high
+
+  ST7789_Window_Invalidate ();                          // CASET / RASET set by stream
+
+  if (stream->count == 0) {
+    return ST77XX_ERROR;                                // source ended before STREAM_END
+  }
+  return ST77XX_SUCCESS;
+}
+
 /**
  * @desc    Command send
  *
@@ -612,7 +1423,7 @@ void ST7789_Send_Command (struct st7789 * lcd, uint8_t data)
 {
   ST7789_CS_Active (lcd);                               // chip enable - active low
   ST7789_DC_Command (lcd);                              // command (active low)
-  SPI_Transfer (data);                                  // transfer
+  ST7789_WRITE (data);                                  // transfer
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 }
 
@@ -628,7 +1439,7 @@ void ST7789_Send_Data_Byte (struct st7789 * lcd, uint8_t data)
 {
   ST7789_CS_Active (lcd);                               // chip enable - active low
   ST7789_DC_Data (lcd);                                 // data (active high)
-  SPI_Transfer (data);                                  // transfer
+  ST7789_WRITE (data);                                  // transfer
   ST7789_CS_Idle (lcd);                                 // chip disable - idle high
 }
 
@@ -641,7 +1452,5 @@ void ST7789_Send_Data_Byte (struct st7789 * lcd, uint8_t data)
  */
 void ST7789_Delay_ms (uint8_t time)
 {
-  while (time--) {
-    _delay_ms(1);                                         // 1ms delay
-  }
+  HAL_Delay_ms (time);
 }
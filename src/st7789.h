@@ -11,7 +11,7 @@
  * @version     1.0
  * @tested      AVR Atmega328
  *
- * @depend      font.h
+ * @depend      hal.h, font.h, stats.h, frame.h
  * --------------------------------------------------------------------------------------------+
  * @descr       Version 1.0 -> applicable for 1 display
  * --------------------------------------------------------------------------------------------+
@@ -21,11 +21,10 @@
 #ifndef __ST7789_H__
 #define __ST7789_H__
 
-  #include <avr/io.h>
-  #include <avr/pgmspace.h>
-  #include <util/delay.h>
-  #include "spi.h"
+  #include "hal.h"
   #include "font.h"
+  #include "stats.h"
+  #include "frame.h"
 
   // Success / Error
   // -----------------------------------
@@ -49,8 +48,10 @@
   #define ST77XX_CASET          0x2A  // Column Address Set, XS, XE [15:0] < 239 (00Efh)): MV=”0”, XS, XE [15:0] < 319 (013Fh)): MV=”1”
   #define ST77XX_RASET          0x2B  // Row Address Set, 0 < YS [15:0] < YE [15:0] < 319 (013fh)): MV=”0”, 0 < YS [15:0] < YE [15:0] < 239 (00EFh)): MV=”1”
   #define ST77XX_RAMWR          0x2C  // Memory Write, This command is used to transfer data from MCU to frame memory.
+  #define ST77XX_RAMRD          0x2E  // Memory Read, dummy clock first, then 18 bits per pixel (R, G, B in upper 6 bits)
 
   #define ST77XX_PTLAR          0x30  // Partial Area
+  #define ST77XX_VSCRDEF        0x33  // Vertical Scrolling Definition, TFA, VSA, BFA [15:0], TFA + VSA + BFA = 320
   #define ST77XX_MADCTL         0x36  // Memory Data Access Control
   #define ST77XX_COLMOD         0x3A  // Interface Pixel Format
   #define ST77XX_TEOFF          0x34  // Tearing Effect Line OFF
@@ -58,9 +59,26 @@
   #define ST77XX_VSCSAD         0x37  // Vertical Scroll Start Address of RAM
   #define ST77XX_IDMOFF         0x38  // Idle Mode Off
   #define ST77XX_IDMON          0x39  // Idle Mode On
+  #define ST77XX_RAMWRC         0x3C  // Memory Write Continue, pixel data continues after last written pixel
 
   #define ST77XX_WRCTRLD        0x53  // Write CTRL Display
 
+  // Command stream, record = command + length byte + data
+  // -----------------------------------
+  #define ST7789_STREAM_END     0x00                    // command NOP ends stream
+  #define ST7789_STREAM_DELAY   0xFD                    // length: no data, delay in ms follows
+  #define ST7789_STREAM_LONG    0xFE                    // length: 16 bit length follows, then data
+  #define ST7789_STREAM_REPEAT  0xFF                    // length: color & 16 bit count follow
+  #define ST7789_STREAM_BUFFER  32                      // bytes read from external source at once
+
+  // Display RAM read, R, G, B bytes of pixels per HAL_Read
+  // -----------------------------------
+  #if defined(__AVR__)
+    #define ST7789_READ_PIXELS  8                       // 25 bytes of stack
+  #else
+    #define ST7789_READ_PIXELS  320                     // row of display RAM, one message
+  #endif
+
   // Colors
   // -----------------------------------
   #define BLACK                 0x0000
@@ -72,9 +90,14 @@
   // -----------------------------------
   #define ST7789_WIDTH          240                     // max columns / MV = 0 in MADCTL
   #define ST7789_HEIGHT         320UL                   // max rows / MV = 0 in MADCTL
+  #define ST7789_PANEL_WIDTH    240                     // visible columns / MV = 0 in MADCTL
+  #define ST7789_PANEL_HEIGHT   280                     // visible rows / MV = 0 in MADCTL
+  #define ST7789_PANEL_OFFSET_X 0                       // first visible RAM column / MADCTL = 0x00
+  #define ST7789_PANEL_OFFSET_Y 20                      // first visible RAM row / MADCTL = 0x00
   #define ST7789_MARGIN_X       10
   #define ST7789_MARGIN_Y       45
   #define WINDOW_PIXELS         ST7789_WIDTH * ST7789_HEIGHT
+  #define ST7789_VIEW_DEPTH     4                       // max nested clip rectangles / viewports
   #define CHARS_COLS_LEN        5                       // number of columns for chars
   #define CHARS_ROWS_LEN        8                       // number of rows for chars
 
@@ -82,6 +105,18 @@
   // -----------------------------------
   #define CLR_BIT(port, bit)   (((port) &= ~(1<<(bit))))
   #define SET_BIT(port, bit)   (((port) |=  (1<<(bit))))
+  #define RGB666_TO_565(r, g, b) ((((uint16_t) (r) & 0xF8) << 8) | (((uint16_t) (g) & 0xFC) << 3) | ((b) >> 3))
+
+  // Pixel streaming, after ST7789_Write_Begin
+  // byte write of backend, inlined on AVR
+  // -----------------------------------
+  #define ST7789_WRITE(data)    HAL_Write_Byte (data)
+  #define ST7789_WRITE_565(color) do { ST7789_WRITE ((uint8_t) ((color) >> 8)); ST7789_WRITE ((uint8_t) (color)); } while (0)
+
+  // Save-under / restore of rectangle
+  // -----------------------------------
+  #define ST7789_SaveRect       ST7789_ReadRect
+  #define ST7789_RestoreRect    ST7789_DrawImage
 
   // Memory Data Access Control
   // D7  D6  D5  D4  D3  D2  D1  D0
@@ -126,14 +161,8 @@
   #define ST77XX_X_MIRROR       0x40                    // X-Mirror  = right to left, refresh top-bottom
   #define ST77XX_Y_MIRROR       0x80                    // Y-Mirror  = left to right, refresh bottom-top
   #define ST77XX_XY_CHANGE      0x20                    // X-Y Exchange
-  #define ST77XX_XY_CHANGE_XY   0xD0                    // X-Y Exchange X-Mirror Y-Mirror
-
-  /** @struct Signal */
-  struct signal {
-    volatile uint8_t * ddr;                             // ddr
-    volatile uint8_t * port;                            // port
-    uint8_t pin;                                        // pin
-  };
+  #define ST77XX_XY_CHANGE_XY   0xE0                    // X-Y Exchange X-Mirror Y-Mirror
+  #define ST77XX_ORIENTATION    0xE0                    // MY MX MV bits = one of eight orientations
 
   /** @struct Lcd definition */
   struct st7789 {
@@ -143,12 +172,61 @@
     struct signal * rs;                                 // Reset
   };
 
+  /** @struct Panel definition / glass placed in controller RAM, MADCTL = 0x00 */
+  struct S_PANEL {
+    uint16_t ramWidth;                                  // Controller RAM Columns
+    uint16_t ramHeight;                                 // Controller RAM Rows
+    uint16_t width;                                     // Visible Columns
+    uint16_t height;                                    // Visible Rows
+    uint16_t offsetX;                                   // First Visible RAM Column
+    uint16_t offsetY;                                   // First Visible RAM Row
+  };
+
   /** @struct Screen definition */
   struct S_SCREEN {
     uint16_t width;                                     // Screen Width
     uint16_t height;                                    // Screen Height
     uint16_t marginX;                                   // Screen Horizontal Margin
     uint16_t marginY;                                   // Screen Vertical Margin
+    uint16_t offsetX;                                   // CASET RAM Offset for current orientation
+    uint16_t offsetY;                                   // RASET RAM Offset for current orientation
+    uint8_t madctl;                                     // Current MADCTL value
+  };
+
+  /** @struct View definition / origin & clip rectangle in screen coordinates */
+  struct S_VIEW {
+    int16_t originX;                                    // Horizontal Origin
+    int16_t originY;                                    // Vertical Origin
+    int16_t xs;                                         // Clip Start Column
+    int16_t xe;                                         // Clip End Column
+    int16_t ys;                                         // Clip Start Row
+    int16_t ye;                                         // Clip End Row
+  };
+
+  /** @struct Window definition / last CASET & RASET sent, RAM coordinates */
+  struct S_WINDOW {
+    uint16_t xs;                                        // Start Column
+    uint16_t xe;                                        // End Column
+    uint16_t ys;                                        // Start Row
+    uint16_t ye;                                        // End Row
+  };
+
+  /** @struct Command stream source / external memory read by blocks */
+  struct S_STREAM {
+    uint8_t (*read) (void *, uint8_t *, uint8_t);       // read up to n bytes into buffer, return count, 0 = end
+    void * context;                                     // passed to read, e.g. address in flash
+    uint8_t buffer[ST7789_STREAM_BUFFER];               // current block
+    uint8_t index;                                      // next byte in block
+    uint8_t count;                                      // valid bytes in block
+  };
+
+  /** @enum Cohen-Sutherland outcodes */
+  enum S_CLIP {
+    CLIP_INSIDE = 0x00,                                 // inside clip
+    CLIP_LEFT = 0x01,                                   // left of clip
+    CLIP_RIGHT = 0x02,                                  // right of clip
+    CLIP_TOP = 0x04,                                    // above clip
+    CLIP_BOTTOM = 0x08                                  // below clip
   };
 
   /** @enum Font sizes */
@@ -161,6 +239,90 @@
   /** @const Command List */
   extern const uint8_t INIT_ST7789[];                   // @const Command List ST7789V2
 
+  /**
+   * @desc    Reset view to the whole screen
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void ST7789_View_Reset (void);
+
+  /**
+   * @desc    Push clip rectangle, coordinates relative to current view
+   *
+   * @param   int16_t xs - start position
+   * @param   int16_t xe - end position
+   * @param   int16_t ys - start position
+   * @param   int16_t ye - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Clip_Push (int16_t, int16_t, int16_t, int16_t);
+
+  /**
+   * @desc    Push viewport, new origin at xs, ys and clip to its area
+   *
+   * @param   int16_t xs - start position
+   * @param   int16_t xe - end position
+   * @param   int16_t ys - start position
+   * @param   int16_t ye - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_View_Push (int16_t, int16_t, int16_t, int16_t);
+
+  /**
+   * @desc    Pop clip rectangle or viewport
+   *
+   * @param   void
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_View_Pop (void);
+
+  /**
+   * @desc    Start & end position in order, corners of rectangle in any order
+   *
+   * @param   int16_t * start position
+   * @param   int16_t * end position
+   *
+   * @return  void
+   */
+  static inline void ST7789_Order (int16_t * start, int16_t * end)
+  {
+    int16_t swap = *start;
+
+    if (swap > *end) {
+      *start = *end;
+      *end = swap;
+    }
+  }
+
+  /**
+   * @desc    Translate rectangle to screen & intersect with clip
+   *
+   * @param   int16_t * xs - start position
+   * @param   int16_t * xe - end position
+   * @param   int16_t * ys - start position
+   * @param   int16_t * ye - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Clip_Rect (int16_t *, int16_t *, int16_t *, int16_t *);
+
+  /**
+   * @desc    Translate line to screen & clip by Cohen-Sutherland algorithm
+   *
+   * @param   int16_t * x1 - start position
+   * @param   int16_t * x2 - end position
+   * @param   int16_t * y1 - start position
+   * @param   int16_t * y2 - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Clip_Line (int16_t *, int16_t *, int16_t *, int16_t *);
+
   /**
    * @desc    Draw String
    *
@@ -176,12 +338,12 @@
   /**
    * @desc    Set text position x, y
    *
-   * @param   uint8_t x - position
-   * @param   uint8_t y - position
+   * @param   uint16_t x - position
+   * @param   uint16_t y - position
    *
    * @return  char
    */
-  char ST7789_SetPosition (uint8_t, uint8_t);
+  char ST7789_SetPosition (uint16_t, uint16_t);
 
   /**
    * @desc    Draw character
@@ -204,6 +366,50 @@
    */
   void ST7789_ClearScreen (struct st7789 *, uint16_t);
 
+  /**
+   * @desc    Fill rectangle
+   *
+   * @param   struct st7789 *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void ST7789_FillRect (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Read rectangle from display RAM (RAMRD), needs MISO wired to SDO
+   *          buffer holds (xe-xs+1)*(ye-ys+1) pixels row by row from top left
+   *          corner, corners in any order, pixels out of clip are left untouched
+   *
+   * @param   struct st7789 *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint16_t * buffer
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_ReadRect (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t *);
+
+  /**
+   * @desc    Draw image from RAM buffer, layout as in ST7789_ReadRect
+   *
+   * @param   struct st7789 *
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   const uint16_t * buffer
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_DrawImage (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t, const uint16_t *);
+
   /**
    * @desc    Draw line by Bresenham algoritm
    * @surce   https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
@@ -250,12 +456,12 @@
    *
    * @param   struct st7789 * lcd
    * @param   uint16_t x position / 0 <= cols <= MAX_X-1
-   * @param   uint8_t y position / 0 <= rows <= MAX_Y-1
+   * @param   uint16_t y position / 0 <= rows <= MAX_Y-1
    * @param   uint16_t color
    *
    * @return  void
    */
-  void ST7789_DrawPixel (struct st7789 *, uint16_t, uint8_t, uint16_t);
+  void ST7789_DrawPixel (struct st7789 *, uint16_t, uint16_t, uint16_t);
 
   /**
    * @desc    Init LCD
@@ -303,6 +509,28 @@
    */
   void ST7789_InvertColorOff (struct st7789 *);
 
+  /**
+   * @desc    Vertical Scrolling Definition, frame memory lines
+   *
+   * @param   struct st7789 * lcd
+   * @param   uint16_t top fixed area
+   * @param   uint16_t vertical scrolling area
+   * @param   uint16_t bottom fixed area
+   *
+   * @return  void
+   */
+  void ST7789_Scroll_Define (struct st7789 *, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Vertical Scroll Start Address, frame memory line shown first in scrolling area
+   *
+   * @param   struct st7789 * lcd
+   * @param   uint16_t start line
+   *
+   * @return  void
+   */
+  void ST7789_Scroll_Start (struct st7789 *, uint16_t);
+
   /**
    * --------------------------------------------------------------------------------------------+
    * PRIVATE FUNCTIONS
@@ -319,6 +547,15 @@
    */
   void ST7789_Set_MADCTL (struct st7789 *, uint8_t);
 
+  /**
+   * @desc    Set Orientation / recompute screen size and RAM offsets from Panel
+   *
+   * @param   uint8_t madctl
+   *
+   * @return  void
+   */
+  void ST7789_Set_Orientation (uint8_t);
+
   /**
    * @desc    Set Window
    *
@@ -343,6 +580,97 @@
    */
   void ST7789_Send_Color_565 (struct st7789 *, uint16_t, uint32_t);
 
+  /**
+   * @desc    Begin pixel stream / chip select, window & RAMWR
+   *          screen coordinates, already clipped
+   *
+   * @param   struct st7789 * lcd
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Write_Begin (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    End pixel stream / chip select idle
+   *
+   * @param   struct st7789 * lcd
+   *
+   * @return  void
+   */
+  void ST7789_Write_End (struct st7789 *);
+
+  /**
+   * @desc    Window & RAMWR, chip select held by caller
+   *          screen coordinates, already clipped, nothing sent
+   *          for window out of screen or inverted
+   *
+   * @param   struct st7789 * lcd
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Write_Window (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Fill window with color as one chunk list, chip select held by caller
+   *
+   * @param   struct st7789 * lcd
+   * @param   uint16_t xs - start position
+   * @param   uint16_t xe - end position
+   * @param   uint16_t ys - start position
+   * @param   uint16_t ye - end position
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Fill_Window (struct st7789 *, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Begin batch of transfers / chip select active
+   *
+   * @param   struct st7789 * lcd
+   *
+   * @return  void
+   */
+  void ST7789_Batch_Begin (struct st7789 *);
+
+  /**
+   * @desc    End batch of transfers / chip select idle
+   *
+   * @param   struct st7789 * lcd
+   *
+   * @return  void
+   */
+  void ST7789_Batch_End (struct st7789 *);
+
+  /**
+   * @desc    Forget last window, next Set_Window sends CASET & RASET
+   *          (after reset or CASET / RASET sent by Send_Command)
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void ST7789_Window_Invalidate (void);
+
+  /**
+   * @desc    Read Color Pixels
+   *
+   * @param   struct st7789 * lcd
+   * @param   uint16_t * buffer
+   * @param   uint32_t counter
+   *
+   * @return  void
+   */
+  void ST7789_Read_Color_565 (struct st7789 *, uint16_t *, uint32_t);
+
   /**
    * --------------------------------------------------------------------------------------------+
    * PRIMITIVE / PRIVATE FUNCTIONS
@@ -368,6 +696,26 @@
    */
   void ST7789_Init_Sequence (struct st7789 *, const uint8_t *);
 
+  /**
+   * @desc    Play command stream from PROGMEM, window addresses already in RAM coordinates
+   *
+   * @param   struct st7789 *
+   * @param   const uint8_t *
+   *
+   * @return  void
+   */
+  void ST7789_Stream_Play (struct st7789 *, const uint8_t *);
+
+  /**
+   * @desc    Run command stream from external source (SPI flash, SD card, ...)
+   *
+   * @param   struct st7789 *
+   * @param   struct S_STREAM *
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Stream_Run (struct st7789 *, struct S_STREAM *);
+
   /**
    * @desc    Command send
    *
@@ -0,0 +1,128 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Instrumentation Counters
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        stats.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      stats.h, hal.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "stats.h"
+
+#if defined(ST7789_STATS)
+
+#include "hal.h"
+#if !defined(__AVR__)
+  #include <time.h>
+#endif
+
+/** @var Counters */
+volatile struct S_STATS Stats;
+
+/** @array Names of tagged functions, order of enum S_STATS_API */
+static const char NAMES[STATS_USER][14] PROGMEM = {
+  "other", "DrawString", "DrawChar", "ClearScreen", "FillRect", "ReadRect",
+  "DrawImage", "DrawLine", "FastLine", "DrawPixel", "Text", "Stream",
+  "Shape", "Sprite", "Tile", "Widget", "List", "Asset", "Fill"
+};
+
+/**
+ * @desc    Clear counters & start Timer1
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void ST7789_Stats_Reset (void)
+{
+  uint8_t i;
+
+  for (i = 0; i < STATS_APIS; i++) {
+    Stats.calls[i] = 0;
+    Stats.bytes[i] = 0;
+    Stats.wait[i] = 0;
+  }
+  Stats.windows = 0;
+  Stats.addresses = 0;
+  Stats.selects = 0;
+  Stats.api = STATS_OTHER;
+
+#if defined(__AVR__)
+  TCCR1B = (1 << CS10);                                 // Timer1 normal mode, no prescaler
+#endif
+}
+
+/**
+ * @desc    Enter tagged function
+ *
+ * @param   uint8_t id
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Stats_Enter (uint8_t api)
+{
+  uint8_t caller = Stats.api;
+
+  Stats.calls[api]++;
+  if (caller == STATS_OTHER) {
+    Stats.api = api;                                    // outermost tagged function
+  }
+  return caller;
+}
+
+/**
+ * @desc    Leave tagged function
+ *
+ * @param   uint8_t * id to restore
+ *
+ * @return  void
+ */
+void ST7789_Stats_Leave (uint8_t * caller)
+{
+  Stats.api = *caller;
+}
+
+/**
+ * @desc    Name of tagged function
+ *
+ * @param   uint8_t id
+ *
+ * @return  const char * in PROGMEM, NULL for application ids
+ */
+const char * ST7789_Stats_Name (uint8_t api)
+{
+  if (api >= STATS_USER) {
+    return NULL;                                        // named by application
+  }
+  return NAMES[api];
+}
+
+#if !defined(__AVR__)
+
+/**
+ * @desc    Ticks on host
+ *
+ * @param   void
+ *
+ * @return  uint16_t
+ */
+uint16_t ST7789_Stats_Ticks (void)
+{
+  struct timespec now;
+
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return (uint16_t) now.tv_nsec;
+}
+
+#endif
+
+#endif
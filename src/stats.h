@@ -0,0 +1,156 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Instrumentation Counters
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        stats.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      stdint.h, avr/io.h, time.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Counters of driver work, compiled in only with -DST7789_STATS
+ *              (make STATS=1), otherwise all macros are empty
+ *
+ *              Bytes & busy wait belong to the outermost tagged function, so
+ *              a FillRect called by ClearScreen is counted as ClearScreen.
+ *              Application code can tag its own blocks by STATS_USER ids:
+ *
+ *                { ST7789_STATS_API (STATS_USER + 0); ST7789_Gauge_Set (...); }
+ *
+ *              Busy wait is measured by Timer1 running at F_CPU, started by
+ *              ST7789_Stats_Reset, on host in nanoseconds of CLOCK_MONOTONIC.
+ *              Stats is a plain global, read it by debugger or send its bytes
+ *              over UART, ST7789_Stats_Name gives name of id.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __STATS_H__
+#define __STATS_H__
+
+  #include <stdint.h>
+
+  #define ST7789_STATS_USER     4                       // ids free for application
+
+  /** @enum Tagged functions */
+  enum S_STATS_API {
+    STATS_OTHER,                                        // untagged
+    STATS_DRAW_STRING,
+    STATS_DRAW_CHAR,
+    STATS_CLEAR_SCREEN,
+    STATS_FILL_RECT,
+    STATS_READ_RECT,
+    STATS_DRAW_IMAGE,
+    STATS_DRAW_LINE,
+    STATS_FAST_LINE,
+    STATS_DRAW_PIXEL,
+    STATS_TEXT,
+    STATS_STREAM,
+    STATS_SHAPE,
+    STATS_SPRITE,
+    STATS_TILE,
+    STATS_WIDGET,
+    STATS_LIST,
+    STATS_ASSET,
+    STATS_FILL,
+    STATS_USER,                                         // first application id
+    STATS_APIS = STATS_USER + ST7789_STATS_USER
+  };
+
+#if defined(ST7789_STATS)
+
+  // Timer1 on AVR, low 16 bits of nanoseconds on host
+  #if defined(__AVR__)
+    #include <avr/io.h>
+    #define ST7789_STATS_TICKS()  TCNT1
+  #else
+    #define ST7789_STATS_TICKS()  ST7789_Stats_Ticks ()
+  #endif
+
+  /** @struct Counters */
+  struct S_STATS {
+    uint16_t calls[STATS_APIS];                         // calls of tagged function
+    uint32_t bytes[STATS_APIS];                         // SPI bytes of outermost tagged function
+    uint32_t wait[STATS_APIS];                          // ticks waiting for SPI shifter
+    uint16_t windows;                                   // window setups
+    uint16_t addresses;                                 // CASET / RASET sent, rest skipped by cache
+    uint16_t selects;                                   // chip select activations
+    uint8_t api;                                        // outermost tagged function now
+  };
+
+  /** @var Counters, stats.c */
+  extern volatile struct S_STATS Stats;
+
+  /**
+   * @desc    Clear counters & start Timer1
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void ST7789_Stats_Reset (void);
+
+  /**
+   * @desc    Enter tagged function, return id to restore
+   *
+   * @param   uint8_t id
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Stats_Enter (uint8_t);
+
+  /**
+   * @desc    Leave tagged function, called by cleanup attribute
+   *
+   * @param   uint8_t * id to restore
+   *
+   * @return  void
+   */
+  void ST7789_Stats_Leave (uint8_t *);
+
+  /**
+   * @desc    Name of tagged function
+   *
+   * @param   uint8_t id
+   *
+   * @return  const char * in PROGMEM, NULL for application ids
+   */
+  const char * ST7789_Stats_Name (uint8_t);
+
+#if !defined(__AVR__)
+  /**
+   * @desc    Ticks on host, nanoseconds of CLOCK_MONOTONIC, wrap at 16 bits
+   *          like Timer1, so one busy wait is measured up to 65 us
+   *
+   * @param   void
+   *
+   * @return  uint16_t
+   */
+  uint16_t ST7789_Stats_Ticks (void);
+#endif
+
+  // Tag, counters restored at any exit of enclosing block
+  #define ST7789_STATS_API(id)  uint8_t statsApi __attribute__ ((cleanup (ST7789_Stats_Leave))) = ST7789_Stats_Enter (id)
+  // Count event
+  #define ST7789_STATS_COUNT(field) (Stats.field++)
+  // SPI byte, around shifter busy wait
+  #define ST7789_STATS_SPI_BEGIN() uint16_t statsStart = ST7789_STATS_TICKS ()
+  #define ST7789_STATS_SPI_END() do { \
+    Stats.bytes[Stats.api]++; \
+    Stats.wait[Stats.api] += (uint16_t) (ST7789_STATS_TICKS () - statsStart); \
+  } while (0)
+
+#else
+
+  #define ST7789_STATS_API(id)
+  #define ST7789_STATS_COUNT(field)
+  #define ST7789_STATS_SPI_BEGIN()
+  #define ST7789_STATS_SPI_END()
+
+#endif
+
+#endif
@@ -0,0 +1,316 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Proportional Text
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        text.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      text.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "text.h"
+
+/** @var Text position, st7789.c */
+extern uint16_t cacheIndexRow;
+extern uint16_t cacheIndexCol;
+
+/** @var Screen & View definition, st7789.c */
+extern struct S_SCREEN Screen;
+extern struct S_VIEW View;
+
+/** @var Alpha table for bpp */
+static uint8_t alpha[16];                               // @var coverage level to alpha 0..32
+static uint8_t alphaBpp = 0;                            // @var bits per pixel of current table
+
+/** @var Color ramp for fg / bg pair */
+static uint16_t ramp[16];                               // @var blended colors per coverage level
+static uint16_t rampFg, rampBg;                         // @var colors of current ramp
+static uint8_t rampBpp = 0;                             // @var bits per pixel of current ramp
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/* Blend two RGB565 colors, alpha 0 (bg) .. 32 (fg) */
+static uint16_t ST7789_Text_Blend (uint16_t fg, uint16_t bg, uint8_t a)
+{
+  int16_t r = (bg >> 11), g = (bg >> 5) & 0x3F, b = bg & 0x1F;
+
+  r += (((int16_t) (fg >> 11) - r) * a) >> 5;
+  g += (((int16_t) ((fg >> 5) & 0x3F) - g) * a) >> 5;
+  b += (((int16_t) (fg & 0x1F) - b) * a) >> 5;
+
+  return (r << 11) | (g << 5) | b;
+}
+
+/* Alpha of 2, 4 or 16 coverage levels, rebuilt only when bpp changes */
+static void ST7789_Text_Alpha (uint8_t bpp)
+{
+  uint8_t levels = (1 << bpp) - 1;
+  uint8_t i;
+
+  if (bpp == alphaBpp) {
+    return;                                             // table ready
+  }
+  for (i = 0; i <= levels; i++) {
+    alpha[i] = ((i << 5) + (levels >> 1)) / levels;     // 0..32
+  }
+  alphaBpp = bpp;
+}
+
+/* Ramp of 2, 4 or 16 colors from bg to fg, rebuilt only when fg, bg or bpp change */
+static void ST7789_Text_Ramp (uint16_t fg, uint16_t bg, uint8_t bpp)
+{
+  uint8_t levels = (1 << bpp) - 1;
+  uint8_t i;
+
+  if ((bpp == rampBpp) && (fg == rampFg) && (bg == rampBg)) {
+    return;                                             // ramp ready
+  }
+  ST7789_Text_Alpha (bpp);
+  for (i = 0; i <= levels; i++) {
+    ramp[i] = ST7789_Text_Blend (fg, bg, alpha[i]);
+  }
+  rampFg = fg;
+  rampBg = bg;
+  rampBpp = bpp;
+}
+
+/* Glyph of character, width 0 if out of range */
+static uint8_t ST7789_Text_Glyph (struct S_FONT * f, const struct S_FONT * font, char character, const uint8_t ** glyph)
+{
+  memcpy_P (f, font, sizeof (struct S_FONT));           // font header copy from PROGMEM
+
+  if (((uint8_t) character < f->first) ||
+      ((uint8_t) character > f->last)) {
+    return 0;                                           // out of range
+  }
+  character -= f->first;                                // glyph index
+  *glyph = f->bitmap + pgm_read_word (&f->offsets[(uint8_t) character]);
+
+  return pgm_read_byte (&f->widths[(uint8_t) character]);
+}
+
+/* Character of string, out of range one replaced by space */
+static inline char ST7789_Text_Char (char character, uint8_t first, uint8_t last)
+{
+  if (((uint8_t) character < first) ||
+      ((uint8_t) character > last)) {
+    return ' ';                                         // space, none if out of font too
+  }
+  return character;
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Draw character by proportional font at text position
+ *          coverage fonts (bpp 2 / 4) are blended against bg by ramp lookup
+ *
+ * @param   struct st7789 *
+ * @param   const struct S_FONT * (PROGMEM)
+ * @param   char character
+ * @param   uint16_t foreground color
+ * @param   uint16_t background color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Text_DrawChar (struct st7789 * lcd, const struct S_FONT * font, char character, uint16_t fg, uint16_t bg)
+{
+  struct S_FONT f;                                      // font header
+  const uint8_t * glyph;                                // glyph bitmap
+  const uint8_t * data;                                 // current bitmap byte
+  uint16_t bit;                                         // bit index of row start
+  uint8_t width, levels, col, bits;
+  int8_t shift;
+  int16_t left, top;                                    // glyph corner on screen
+  int16_t x, y, xs, xe, ys, ye;
+  ST7789_STATS_API (STATS_TEXT);
+
+  width = ST7789_Text_Glyph (&f, font, character, &glyph);
+  if (width == 0) {
+    return ST77XX_ERROR;                                // out of range
+  }
+
+  xs = cacheIndexCol;                                   // glyph window incl. spacing
+  xe = cacheIndexCol + width + f.spacing - 1;
+  ys = cacheIndexRow;
+  ye = cacheIndexRow + f.height - 1;
+  cacheIndexCol += width + f.spacing;                   // proportional advance
+
+  if (ST7789_Clip_Rect (&xs, &xe, &ys, &ye) == ST77XX_ERROR) {
+    return ST77XX_SUCCESS;                              // glyph out of clip, nothing sent
+  }
+  left = cacheIndexCol - width - f.spacing + View.originX;
+  top = cacheIndexRow + View.originY;
+  levels = (1 << f.bpp) - 1;
+  ST7789_Text_Ramp (fg, bg, f.bpp);
+
+  ST7789_Write_Begin (lcd, xs, xe, ys, ye);             // one opaque window
+  for (y = ys; y <= ye; y++) {
+    bit = (uint16_t) (y - top) * width * f.bpp;         // first bit of row
+    data = glyph + (bit >> 3);
+    bits = pgm_read_byte (data);
+    shift = 8 - f.bpp - (bit & 0x07);
+    x = left;
+    for (col = 0; col < width; col++, x++) {
+      if (x >= xs && x <= xe) {
+        ST7789_WRITE_565 (ramp[(bits >> shift) & levels]);
+      }
+      shift -= f.bpp;
+      if ((shift < 0) && (col + 1 < width)) {
+        shift = 8 - f.bpp;                              // next bitmap byte
+        bits = pgm_read_byte (++data);
+      }
+    }
+    for (; x <= xe; x++) {
+      if (x >= xs) {
+        ST7789_WRITE_565 (bg);                          // spacing
+      }
+    }
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Draw character blended over display content (RAMRD)
+ *          buffer holds (glyph width + spacing) x font height pixels
+ *
+ * @param   struct st7789 *
+ * @param   const struct S_FONT * (PROGMEM)
+ * @param   char character
+ * @param   uint16_t foreground color
+ * @param   uint16_t * buffer
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Text_DrawCharOver (struct st7789 * lcd, const struct S_FONT * font, char character, uint16_t fg, uint16_t * buffer)
+{
+  struct S_FONT f;                                      // font header
+  const uint8_t * glyph;                                // glyph bitmap
+  uint16_t * pixel = buffer;
+  uint16_t bit = 0;                                     // bit index
+  uint8_t width, levels, col, row, bits, level;
+  uint16_t xs, xe, ys, ye;
+  ST7789_STATS_API (STATS_TEXT);
+
+  width = ST7789_Text_Glyph (&f, font, character, &glyph);
+  if (width == 0) {
+    return ST77XX_ERROR;                                // out of range
+  }
+
+  xs = cacheIndexCol;                                   // glyph window incl. spacing
+  xe = cacheIndexCol + width + f.spacing - 1;
+  ys = cacheIndexRow;
+  ye = cacheIndexRow + f.height - 1;
+  cacheIndexCol += width + f.spacing;                   // proportional advance
+
+  if (ST7789_ReadRect (lcd, xs, xe, ys, ye, buffer) == ST77XX_ERROR) {
+    return ST77XX_SUCCESS;                              // glyph out of clip, nothing sent
+  }
+  levels = (1 << f.bpp) - 1;
+  ST7789_Text_Alpha (f.bpp);                            // background differs per pixel, no ramp
+
+  for (row = 0; row < f.height; row++) {
+    for (col = 0; col < width; col++) {
+      bits = pgm_read_byte (glyph + (bit >> 3));
+      level = (bits >> (8 - f.bpp - (bit & 0x07))) & levels;
+      bit += f.bpp;
+      if (level == levels) {
+        *pixel = fg;                                    // full coverage
+      } else if (level) {
+        *pixel = ST7789_Text_Blend (fg, *pixel, alpha[level]);
+      }
+      pixel++;
+    }
+    pixel += f.spacing;                                 // spacing keeps background
+  }
+
+  return ST7789_DrawImage (lcd, xs, xe, ys, ye, buffer);
+}
+
+/**
+ * @desc    Draw string by proportional font at text position,
+ *          characters out of font are drawn as space
+ *
+ * @param   struct st7789 *
+ * @param   const struct S_FONT * (PROGMEM)
+ * @param   char * string
+ * @param   uint16_t foreground color
+ * @param   uint16_t background color
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Text_DrawString (struct st7789 * lcd, const struct S_FONT * font, char * str, uint16_t fg, uint16_t bg)
+{
+  uint8_t height = pgm_read_byte (&font->height);
+  uint8_t spacing = pgm_read_byte (&font->spacing);
+  uint8_t first = pgm_read_byte (&font->first);
+  uint8_t last = pgm_read_byte (&font->last);
+  const uint8_t * widths = pgm_read_ptr (&font->widths);
+  uint8_t width;
+  char character;
+  ST7789_STATS_API (STATS_TEXT);
+
+  while (*str != '\0') {
+    character = ST7789_Text_Char (*str++, first, last);
+    width = 0;
+    if (((uint8_t) character >= first) && ((uint8_t) character <= last)) {
+      width = pgm_read_byte (&widths[(uint8_t) (character - first)]);
+    }
+    if (cacheIndexCol + width + spacing + Screen.marginX > Screen.width) {
+      if (cacheIndexRow + (height << 1) + Screen.marginY > Screen.height) {
+        return ST77XX_ERROR;                            // no space for next line
+      }
+      cacheIndexRow += height;                          // new line
+      cacheIndexCol = Screen.marginX;
+    }
+    ST7789_Text_DrawChar (lcd, font, character, fg, bg);
+  }
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    String width in pixels incl. spacing,
+ *          characters out of font count as space
+ *
+ * @param   const struct S_FONT * (PROGMEM)
+ * @param   char * string
+ *
+ * @return  uint16_t
+ */
+uint16_t ST7789_Text_Width (const struct S_FONT * font, char * str)
+{
+  uint8_t spacing = pgm_read_byte (&font->spacing);
+  uint8_t first = pgm_read_byte (&font->first);
+  uint8_t last = pgm_read_byte (&font->last);
+  const uint8_t * widths = pgm_read_ptr (&font->widths);
+  uint16_t width = 0;
+  char character;
+
+  while (*str != '\0') {
+    character = ST7789_Text_Char (*str++, first, last);
+    if (((uint8_t) character >= first) && ((uint8_t) character <= last)) {
+      width += pgm_read_byte (&widths[(uint8_t) (character - first)]) + spacing;
+    }
+  }
+
+  return width;
+}
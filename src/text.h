@@ -0,0 +1,80 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Proportional Text
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        text.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      st7789.h, font.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Variable width fonts (struct S_FONT), every glyph is sent
+ *              as one opaque window: glyph columns + spacing x font height,
+ *              2 / 4 bpp coverage fonts are anti-aliased by color ramp
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __TEXT_H__
+#define __TEXT_H__
+
+  #include "st7789.h"
+
+  /**
+   * @desc    Draw character by proportional font at text position
+   *          coverage fonts (bpp 2 / 4) are blended against bg by ramp lookup
+   *
+   * @param   struct st7789 *
+   * @param   const struct S_FONT * (PROGMEM)
+   * @param   char character
+   * @param   uint16_t foreground color
+   * @param   uint16_t background color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Text_DrawChar (struct st7789 *, const struct S_FONT *, char, uint16_t, uint16_t);
+
+  /**
+   * @desc    Draw character blended over display content (RAMRD)
+   *          buffer holds (glyph width + spacing) x font height pixels
+   *
+   * @param   struct st7789 *
+   * @param   const struct S_FONT * (PROGMEM)
+   * @param   char character
+   * @param   uint16_t foreground color
+   * @param   uint16_t * buffer
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Text_DrawCharOver (struct st7789 *, const struct S_FONT *, char, uint16_t, uint16_t *);
+
+  /**
+   * @desc    Draw string by proportional font at text position,
+   *          characters out of font are drawn as space
+   *
+   * @param   struct st7789 *
+   * @param   const struct S_FONT * (PROGMEM)
+   * @param   char * string
+   * @param   uint16_t foreground color
+   * @param   uint16_t background color
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Text_DrawString (struct st7789 *, const struct S_FONT *, char *, uint16_t, uint16_t);
+
+  /**
+   * @desc    String width in pixels incl. spacing,
+   *          characters out of font count as space
+   *
+   * @param   const struct S_FONT * (PROGMEM)
+   * @param   char * string
+   *
+   * @return  uint16_t
+   */
+  uint16_t ST7789_Text_Width (const struct S_FONT *, char *);
+
+#endif
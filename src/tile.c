@@ -0,0 +1,206 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Tile Map
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        tile.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      tile.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <string.h>
+#include "tile.h"
+
+/** @var View definition, st7789.c */
+extern struct S_VIEW View;
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/* Send one cell as one opaque window */
+static void ST7789_Tile_Cell (struct st7789 * lcd, struct S_TILEMAP * map, uint16_t index)
+{
+  uint8_t tile = map->tiles[index];
+  uint8_t attr = map->attrs[index];
+  uint16_t fg = map->palette[attr >> 4];
+  uint16_t bg = map->palette[attr & 0x0F];
+  int16_t left = map->x + (index % map->cols) * map->cellW;
+  int16_t top = map->y + (index / map->cols) * map->cellH;
+  int16_t xs = left, xe = left + map->cellW - 1;
+  int16_t ys = top, ye = top + map->cellH - 1;
+  int16_t x, y;
+  uint8_t glyph[CHARS_COLS_LEN + 1];                    // font columns + spacing
+  uint8_t sx, sy, col, sub, mask;
+  uint32_t bit = 0, pos;                                // bit of sheet, tiles above 8 kB
+
+  if (ST7789_Clip_Rect (&xs, &xe, &ys, &ye) == ST77XX_ERROR) {
+    return;                                             // cell out of clip, nothing sent
+  }
+  left += View.originX;                                 // cell corner on screen
+  top += View.originY;
+
+  if (map->sheet) {
+    bit = (uint32_t) tile * ((((uint16_t) map->cellW * map->cellH + 7) >> 3) << 3);
+  } else {
+    for (col = 0; col < CHARS_COLS_LEN; col++) {        // glyph columns once per cell
+      glyph[col] = ((tile < 0x20) || (tile > 0x7f)) ? 0 : pgm_read_byte (&FONTS[tile - 0x20][col]);
+    }
+    glyph[CHARS_COLS_LEN] = 0;                          // spacing
+  }
+  sx = map->cellW / (CHARS_COLS_LEN + 1);               // FONTS horizontal scale
+  sy = map->cellH / CHARS_ROWS_LEN;                     // FONTS vertical scale
+  if (sx == 0) sx = 1;
+  if (sy == 0) sy = 1;
+
+  ST7789_Write_Begin (lcd, xs, xe, ys, ye);             // one opaque window
+  if (map->sheet) {
+    for (y = ys; y <= ye; y++) {
+      pos = bit + (uint32_t) (y - top) * map->cellW + (xs - left);
+      for (x = xs; x <= xe; x++, pos++) {
+        ST7789_WRITE_565 ((pgm_read_byte (&map->sheet[pos >> 3]) & (0x80 >> (pos & 0x07))) ? fg : bg);
+      }
+    }
+  } else {
+    for (y = ys; y <= ye; y++) {
+      mask = ((y - top) / sy < CHARS_ROWS_LEN) ? (1 << ((y - top) / sy)) : 0;
+      col = (xs - left) / sx;                           // glyph column of first pixel
+      sub = (xs - left) % sx;
+      for (x = xs; x <= xe; x++) {
+        ST7789_WRITE_565 (((col <= CHARS_COLS_LEN) && (glyph[col] & mask)) ? fg : bg);
+        if (++sub == sx) {
+          sub = 0;                                      // next glyph column
+          col++;
+        }
+      }
+    }
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Clear tile map & mark all cells changed
+ *
+ * @param   struct S_TILEMAP *
+ * @param   uint8_t tile
+ * @param   uint8_t attribute
+ *
+ * @return  void
+ */
+void ST7789_Tile_Clear (struct S_TILEMAP * map, uint8_t tile, uint8_t attr)
+{
+  uint16_t cells = (uint16_t) map->cols * map->rows;
+
+  memset (map->tiles, tile, cells);
+  memset (map->attrs, attr, cells);
+  ST7789_Tile_Invalidate (map);
+}
+
+/**
+ * @desc    Put tile into cell, marked changed only if different
+ *
+ * @param   struct S_TILEMAP *
+ * @param   uint8_t col
+ * @param   uint8_t row
+ * @param   uint8_t tile
+ * @param   uint8_t attribute
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Tile_Put (struct S_TILEMAP * map, uint8_t col, uint8_t row, uint8_t tile, uint8_t attr)
+{
+  uint16_t index;
+
+  if ((col >= map->cols) || (row >= map->rows)) {
+    return ST77XX_ERROR;                                // out of map
+  }
+  index = (uint16_t) row * map->cols + col;
+  if ((map->tiles[index] != tile) || (map->attrs[index] != attr)) {
+    map->tiles[index] = tile;
+    map->attrs[index] = attr;
+    map->dirty[index >> 3] |= (1 << (index & 0x07));    // changed
+  }
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Print string into cells from col, row
+ *
+ * @param   struct S_TILEMAP *
+ * @param   uint8_t col
+ * @param   uint8_t row
+ * @param   char * string
+ * @param   uint8_t attribute
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Tile_Print (struct S_TILEMAP * map, uint8_t col, uint8_t row, char * str, uint8_t attr)
+{
+  while (*str != '\0') {
+    if (ST7789_Tile_Put (map, col++, row, (uint8_t) *str++, attr) == ST77XX_ERROR) {
+      return ST77XX_ERROR;                              // string longer than row
+    }
+  }
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Mark all cells changed
+ *
+ * @param   struct S_TILEMAP *
+ *
+ * @return  void
+ */
+void ST7789_Tile_Invalidate (struct S_TILEMAP * map)
+{
+  memset (map->dirty, 0xFF, (((uint16_t) map->cols * map->rows) + 7) >> 3);
+}
+
+/**
+ * @desc    Send changed cells to display
+ *
+ * @param   struct st7789 *
+ * @param   struct S_TILEMAP *
+ *
+ * @return  uint16_t number of cells sent
+ */
+uint16_t ST7789_Tile_Update (struct st7789 * lcd, struct S_TILEMAP * map)
+{
+  uint16_t cells = (uint16_t) map->cols * map->rows;
+  uint16_t index, sent = 0;
+  uint8_t * flags;
+  ST7789_STATS_API (STATS_TILE);
+
+  for (index = 0; index < cells; index++) {
+    flags = &map->dirty[index >> 3];
+    if (*flags == 0) {
+      index |= 0x07;                                    // skip 8 unchanged cells
+      continue;
+    }
+    if (*flags & (1 << (index & 0x07))) {
+      *flags &= ~(1 << (index & 0x07));                 // sent
+      ST7789_Tile_Cell (lcd, map, index);
+      sent++;
+    }
+  }
+
+  return sent;
+}
@@ -0,0 +1,101 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Tile Map
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        tile.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      st7789.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Character cell screen: grid of tile index + fg/bg attribute,
+ *              only changed cells are sent, every cell as one opaque window
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __TILE_H__
+#define __TILE_H__
+
+  #include "st7789.h"
+
+  // Attribute = foreground << 4 | background, palette indexes
+  // -----------------------------------
+  #define TILE_ATTR(fg, bg)     ((uint8_t) (((fg) << 4) | ((bg) & 0x0F)))
+
+  /** @struct Tile map definition */
+  struct S_TILEMAP {
+    uint16_t x;                                         // left position
+    uint16_t y;                                         // top position
+    uint8_t cols;                                       // number of cells in row
+    uint8_t rows;                                       // number of cells in column
+    uint8_t cellW;                                      // cell width in pixels
+    uint8_t cellH;                                      // cell height in pixels
+    uint8_t * tiles;                                    // cols * rows tile indexes
+    uint8_t * attrs;                                    // cols * rows attributes
+    uint8_t * dirty;                                    // (cols * rows + 7) / 8 changed flags
+    const uint16_t * palette;                           // 16 colors RGB565
+    const uint8_t * sheet;                              // PROGMEM 1 bpp tiles row by row, NULL = FONTS
+  };
+
+  /**
+   * @desc    Clear tile map & mark all cells changed
+   *
+   * @param   struct S_TILEMAP *
+   * @param   uint8_t tile
+   * @param   uint8_t attribute
+   *
+   * @return  void
+   */
+  void ST7789_Tile_Clear (struct S_TILEMAP *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Put tile into cell, marked changed only if different
+   *
+   * @param   struct S_TILEMAP *
+   * @param   uint8_t col
+   * @param   uint8_t row
+   * @param   uint8_t tile
+   * @param   uint8_t attribute
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Tile_Put (struct S_TILEMAP *, uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Print string into cells from col, row
+   *
+   * @param   struct S_TILEMAP *
+   * @param   uint8_t col
+   * @param   uint8_t row
+   * @param   char * string
+   * @param   uint8_t attribute
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Tile_Print (struct S_TILEMAP *, uint8_t, uint8_t, char *, uint8_t);
+
+  /**
+   * @desc    Mark all cells changed
+   *
+   * @param   struct S_TILEMAP *
+   *
+   * @return  void
+   */
+  void ST7789_Tile_Invalidate (struct S_TILEMAP *);
+
+  /**
+   * @desc    Send changed cells to display
+   *
+   * @param   struct st7789 *
+   * @param   struct S_TILEMAP *
+   *
+   * @return  uint16_t number of cells sent
+   */
+  uint16_t ST7789_Tile_Update (struct st7789 *, struct S_TILEMAP *);
+
+#endif
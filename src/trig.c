@@ -0,0 +1,68 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Integer Trigonometry
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        trig.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      trig.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "trig.h"
+
+/** @array Quarter wave sine 0..90 degrees, Q14 */
+static const uint16_t SINE[] PROGMEM = {
+      0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+   2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+   5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+   8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384
+};
+
+/**
+ * @desc    Sine
+ *
+ * @param   int16_t angle in degrees
+ *
+ * @return  int16_t Q14
+ */
+int16_t ST7789_Sin (int16_t angle)
+{
+  angle %= 360;
+  if (angle < 0) {
+    angle += 360;                                       // 0..359
+  }
+  if (angle < 90) {
+    return pgm_read_word (&SINE[angle]);
+  } else if (angle < 180) {
+    return pgm_read_word (&SINE[180 - angle]);
+  } else if (angle < 270) {
+    return -pgm_read_word (&SINE[angle - 180]);
+  }
+  return -pgm_read_word (&SINE[360 - angle]);
+}
+
+/**
+ * @desc    Cosine
+ *
+ * @param   int16_t angle in degrees
+ *
+ * @return  int16_t Q14
+ */
+int16_t ST7789_Cos (int16_t angle)
+{
+  return ST7789_Sin (angle + 90);
+}
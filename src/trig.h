@@ -0,0 +1,45 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Integer Trigonometry
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        trig.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      hal.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Sine & cosine of whole degrees in Q14 (16384 = 1.0), no float
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __TRIG_H__
+#define __TRIG_H__
+
+  #include "hal.h"
+
+  #define TRIG_ONE              16384                   // 1.0 in Q14
+
+  /**
+   * @desc    Sine
+   *
+   * @param   int16_t angle in degrees
+   *
+   * @return  int16_t Q14
+   */
+  int16_t ST7789_Sin (int16_t);
+
+  /**
+   * @desc    Cosine
+   *
+   * @param   int16_t angle in degrees
+   *
+   * @return  int16_t Q14
+   */
+  int16_t ST7789_Cos (int16_t);
+
+#endif
@@ -0,0 +1,293 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Instrument Widgets
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        widget.c
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      widget.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "widget.h"
+
+/** @var Panel & Screen definition, st7789.c */
+extern struct S_PANEL Panel;
+extern struct S_SCREEN Screen;
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== STATIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/* Fill band of bar between from and to pixels (from < to) */
+static void ST7789_Bar_Band (struct st7789 * lcd, struct S_BAR * bar, uint16_t from, uint16_t to, uint16_t color)
+{
+  if (bar->direction == BAR_VERTICAL) {
+    ST7789_FillRect (lcd, bar->x, bar->x + bar->width - 1,
+                          bar->y + bar->height - to, bar->y + bar->height - 1 - from, color);
+  } else {
+    ST7789_FillRect (lcd, bar->x + from, bar->x + to - 1,
+                          bar->y, bar->y + bar->height - 1, color);
+  }
+}
+
+/* Needle line at angle */
+static void ST7789_Gauge_Needle (struct st7789 * lcd, struct S_GAUGE * gauge, int16_t angle, uint16_t color)
+{
+  int16_t cos = ST7789_Cos (angle);
+  int16_t sin = ST7789_Sin (angle);
+
+  ST7789_DrawLine (lcd, gauge->x + (((int32_t) cos * gauge->inner) >> 14),
+                        gauge->x + (((int32_t) cos * gauge->radius) >> 14),
+                        gauge->y + (((int32_t) sin * gauge->inner) >> 14),
+                        gauge->y + (((int32_t) sin * gauge->radius) >> 14), color);
+}
+
+/* Frame memory line of chart column x, MY mirrors lines */
+static uint16_t ST7789_Chart_Line (uint16_t x)
+{
+  if (Screen.madctl & ST77XX_Y_MIRROR) {
+    return Panel.ramHeight - 1 - (Screen.offsetX + x);
+  }
+  return Screen.offsetX + x;
+}
+
+/* Screen column of frame memory line */
+static uint16_t ST7789_Chart_Column (uint16_t line)
+{
+  if (Screen.madctl & ST77XX_Y_MIRROR) {
+    return Panel.ramHeight - 1 - line - Screen.offsetX;
+  }
+  return line - Screen.offsetX;
+}
+
+/**
+ * +------------------------------------------------------------------------------------+
+ * |== PUBLIC FUNCTIONS ================================================================|
+ * +------------------------------------------------------------------------------------+
+ */
+
+/**
+ * @desc    Draw whole bar with current fill
+ *
+ * @param   struct st7789 *
+ * @param   struct S_BAR *
+ *
+ * @return  void
+ */
+void ST7789_Bar_Draw (struct st7789 * lcd, struct S_BAR * bar)
+{
+  uint16_t length = (bar->direction == BAR_VERTICAL) ? bar->height : bar->width;
+  ST7789_STATS_API (STATS_WIDGET);
+
+  if (bar->fill) {
+    ST7789_Bar_Band (lcd, bar, 0, bar->fill, bar->fg);  // filled part
+  }
+  if (bar->fill < length) {
+    ST7789_Bar_Band (lcd, bar, bar->fill, length, bar->bg);
+  }
+}
+
+/**
+ * @desc    Set bar value, only band between old and new fill is sent
+ *
+ * @param   struct st7789 *
+ * @param   struct S_BAR *
+ * @param   uint16_t value
+ *
+ * @return  void
+ */
+void ST7789_Bar_Set (struct st7789 * lcd, struct S_BAR * bar, uint16_t value)
+{
+  uint16_t length = (bar->direction == BAR_VERTICAL) ? bar->height : bar->width;
+  uint16_t fill;
+  ST7789_STATS_API (STATS_WIDGET);
+
+  if (value > bar->max) {
+    value = bar->max;                                   // saturate
+  }
+  fill = 0;                                             // max 0 = empty bar
+  if (bar->max) {
+    fill = ((uint32_t) value * length) / bar->max;      // filled pixels
+  }
+
+  if (fill > bar->fill) {
+    ST7789_Bar_Band (lcd, bar, bar->fill, fill, bar->fg);
+  } else if (fill < bar->fill) {
+    ST7789_Bar_Band (lcd, bar, fill, bar->fill, bar->bg);
+  }
+  bar->fill = fill;
+}
+
+/**
+ * @desc    Draw needle at current angle
+ *
+ * @param   struct st7789 *
+ * @param   struct S_GAUGE *
+ *
+ * @return  void
+ */
+void ST7789_Gauge_Draw (struct st7789 * lcd, struct S_GAUGE * gauge)
+{
+  ST7789_STATS_API (STATS_WIDGET);
+  ST7789_Gauge_Needle (lcd, gauge, gauge->angle, gauge->fg);
+}
+
+/**
+ * @desc    Set gauge value, old needle is erased and new drawn
+ *
+ * @param   struct st7789 *
+ * @param   struct S_GAUGE *
+ * @param   uint16_t value
+ *
+ * @return  void
+ */
+void ST7789_Gauge_Set (struct st7789 * lcd, struct S_GAUGE * gauge, uint16_t value)
+{
+  int16_t angle;
+  ST7789_STATS_API (STATS_WIDGET);
+
+  if (value > gauge->max) {
+    value = gauge->max;                                 // saturate
+  }
+  angle = gauge->start;                                 // max 0 = needle at start
+  if (gauge->max) {
+    angle += ((int32_t) gauge->sweep * value) / gauge->max;
+  }
+
+  if (angle == gauge->angle) {
+    return;                                             // needle on the same pixels
+  }
+  ST7789_Gauge_Needle (lcd, gauge, gauge->angle, gauge->bg);
+  gauge->angle = angle;
+  ST7789_Gauge_Needle (lcd, gauge, angle, gauge->fg);
+}
+
+/**
+ * @desc    Start strip chart
+ *
+ *          Scrolling moves frame memory lines, with MV set they are
+ *          screen columns, so the band x .. x+width-1 is the scrolling
+ *          area and columns left and right of it are fixed areas.
+ *          Columns are written in screen coordinates, so the band must
+ *          be wholly inside the clip rectangle of a view at origin 0, 0.
+ *
+ * @param   struct st7789 *
+ * @param   struct S_CHART *
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7789_Chart_Init (struct st7789 * lcd, struct S_CHART * chart)
+{
+  uint16_t first = ST7789_Chart_Line (chart->x);
+  uint16_t last = ST7789_Chart_Line (chart->x + chart->width - 1);
+  int16_t xs = chart->x, xe = chart->x + chart->width - 1;
+  int16_t ys = chart->y, ye = chart->y + chart->height - 1;
+  ST7789_STATS_API (STATS_WIDGET);
+
+  if (!(Screen.madctl & ST77XX_XY_CHANGE)) {
+    return ST77XX_ERROR;                                // scrolling would be vertical
+  }
+  if ((chart->width == 0) || (chart->height == 0) ||
+      ((uint32_t) chart->x + chart->width > Screen.width) ||
+      ((uint32_t) chart->y + chart->height > Screen.height)) {
+    return ST77XX_ERROR;                                // band out of screen
+  }
+  if ((ST7789_Clip_Rect (&xs, &xe, &ys, &ye) == ST77XX_ERROR) ||
+      (xs != (int16_t) chart->x) || (xe != (int16_t) (chart->x + chart->width - 1)) ||
+      (ys != (int16_t) chart->y) || (ye != (int16_t) (chart->y + chart->height - 1))) {
+    return ST77XX_ERROR;                                // band moved or cut by view
+  }
+  chart->tfa = (first < last) ? first : last;           // lowest line of band
+  chart->head = (Screen.madctl & ST77XX_Y_MIRROR) ? 0 : chart->width - 1;
+  chart->last = chart->y + chart->height - 1;           // value 0
+
+  ST7789_FillRect (lcd, chart->x, chart->x + chart->width - 1,
+                        chart->y, chart->y + chart->height - 1, chart->bg);
+  ST7789_Scroll_Define (lcd, chart->tfa, chart->width, Panel.ramHeight - chart->tfa - chart->width);
+  ST7789_Scroll_Start (lcd, chart->tfa);
+
+  return ST77XX_SUCCESS;
+}
+
+/**
+ * @desc    Append sample as one column & scroll history by one
+ *
+ *          Newest column is written to the oldest frame memory line
+ *          and the scroll start moves so it shows at the right edge.
+ *          Column = background + segment from last sample + point,
+ *          sent as one vertical window.
+ *
+ * @param   struct st7789 *
+ * @param   struct S_CHART *
+ * @param   uint16_t value
+ *
+ * @return  void
+ */
+void ST7789_Chart_Push (struct st7789 * lcd, struct S_CHART * chart, uint16_t value)
+{
+  uint16_t top = chart->y;
+  uint16_t bottom = chart->y + chart->height - 1;
+  uint16_t row, from, to, x;
+  ST7789_STATS_API (STATS_WIDGET);
+
+  if (value > chart->max) {
+    value = chart->max;                                 // saturate
+  }
+  row = bottom;                                         // max 0 = every sample 0
+  if (chart->max) {
+    row -= ((uint32_t) value * (chart->height - 1)) / chart->max;
+  }
+  from = (row < chart->last) ? row : chart->last;       // connecting segment
+  to = (row < chart->last) ? chart->last : row;
+  chart->last = row;
+
+  if (Screen.madctl & ST77XX_Y_MIRROR) {
+    chart->head = chart->head ? chart->head - 1 : chart->width - 1;
+  } else {
+    chart->head = (chart->head + 1 < chart->width) ? chart->head + 1 : 0;
+  }
+  x = ST7789_Chart_Column (chart->tfa + chart->head);   // oldest column on screen
+
+  ST7789_Write_Begin (lcd, x, x, top, bottom);          // one column window
+  for (; top <= bottom; top++) {
+    if (top == row) {
+      ST7789_WRITE_565 (chart->point);                  // sample
+    } else if ((top >= from) && (top <= to)) {
+      ST7789_WRITE_565 (chart->fg);                     // segment
+    } else {
+      ST7789_WRITE_565 (chart->bg);                     // background
+    }
+  }
+  ST7789_Write_End (lcd);                               // chip disable - idle high
+
+  if (Screen.madctl & ST77XX_Y_MIRROR) {
+    ST7789_Scroll_Start (lcd, chart->tfa + chart->head);
+  } else {
+    ST7789_Scroll_Start (lcd, chart->tfa + ((chart->head + 1 < chart->width) ? chart->head + 1 : 0));
+  }
+}
+
+/**
+ * @desc    Stop strip chart, scrolling off
+ *
+ * @param   struct st7789 *
+ *
+ * @return  void
+ */
+void ST7789_Chart_Stop (struct st7789 * lcd)
+{
+  ST7789_STATS_API (STATS_WIDGET);
+  ST7789_Scroll_Start (lcd, 0);                         // no offset
+  ST7789_Scroll_Define (lcd, 0, Panel.ramHeight, 0);    // whole memory
+  ST7789_Send_Command (lcd, ST77XX_NORON);              // normal display mode
+}
@@ -0,0 +1,148 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7789 Instrument Widgets
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        widget.h
+ * @version     1.0
+ * @tested      AVR Atmega328
+ *
+ * @depend      st7789.h, trig.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Bar graph & needle gauge, both remember the last value and
+ *              send only the difference on update, strip chart appends one
+ *              column per sample and shifts history by hardware scroll
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __WIDGET_H__
+#define __WIDGET_H__
+
+  #include "st7789.h"
+  #include "trig.h"
+
+  // Bar direction
+  // -----------------------------------
+  #define BAR_HORIZONTAL        0x00                    // fills left to right
+  #define BAR_VERTICAL          0x01                    // fills bottom to top
+
+  /** @struct Bar graph definition */
+  struct S_BAR {
+    uint16_t x;                                         // left position
+    uint16_t y;                                         // top position
+    uint16_t width;                                     // width in pixels
+    uint16_t height;                                    // height in pixels
+    uint8_t direction;                                  // BAR_HORIZONTAL / BAR_VERTICAL
+    uint16_t max;                                       // value of full bar, 0 = empty
+    uint16_t fg;                                        // bar color
+    uint16_t bg;                                        // background color
+    uint16_t fill;                                      // filled pixels, state
+  };
+
+  /** @struct Needle gauge definition */
+  struct S_GAUGE {
+    uint16_t x;                                         // center column
+    uint16_t y;                                         // center row
+    uint8_t inner;                                      // needle start radius
+    uint8_t radius;                                     // needle end radius
+    int16_t start;                                      // angle of value 0, degrees clockwise from 3 o'clock
+    int16_t sweep;                                      // angle between 0 and max
+    uint16_t max;                                       // value of full sweep, 0 = at start
+    uint16_t fg;                                        // needle color
+    uint16_t bg;                                        // background color
+    int16_t angle;                                      // needle angle, state
+  };
+
+  /** @struct Strip chart definition, needs MADCTL with MV so scrolling is horizontal */
+  struct S_CHART {
+    uint16_t x;                                         // left position of scrolling band
+    uint16_t width;                                     // width of scrolling band
+    uint16_t y;                                         // top position
+    uint16_t height;                                    // height in pixels
+    uint16_t max;                                       // value of top row, 0 = bottom row
+    uint16_t fg;                                        // line color
+    uint16_t point;                                     // sample point color
+    uint16_t bg;                                        // background color
+    uint16_t tfa;                                       // top fixed area, state
+    uint16_t head;                                      // newest line in scrolling area, state
+    uint16_t last;                                      // row of last sample, state
+  };
+
+  /**
+   * @desc    Draw whole bar with current fill
+   *
+   * @param   struct st7789 *
+   * @param   struct S_BAR *
+   *
+   * @return  void
+   */
+  void ST7789_Bar_Draw (struct st7789 *, struct S_BAR *);
+
+  /**
+   * @desc    Set bar value, only band between old and new fill is sent
+   *
+   * @param   struct st7789 *
+   * @param   struct S_BAR *
+   * @param   uint16_t value
+   *
+   * @return  void
+   */
+  void ST7789_Bar_Set (struct st7789 *, struct S_BAR *, uint16_t);
+
+  /**
+   * @desc    Draw needle at current angle
+   *
+   * @param   struct st7789 *
+   * @param   struct S_GAUGE *
+   *
+   * @return  void
+   */
+  void ST7789_Gauge_Draw (struct st7789 *, struct S_GAUGE *);
+
+  /**
+   * @desc    Set gauge value, old needle is erased and new drawn
+   *
+   * @param   struct st7789 *
+   * @param   struct S_GAUGE *
+   * @param   uint16_t value
+   *
+   * @return  void
+   */
+  void ST7789_Gauge_Set (struct st7789 *, struct S_GAUGE *, uint16_t);
+
+  /**
+   * @desc    Start strip chart, whole band x .. x+width-1 scrolls over full screen height,
+   *          band in screen coordinates, error if out of screen or not wholly in view
+   *
+   * @param   struct st7789 *
+   * @param   struct S_CHART *
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7789_Chart_Init (struct st7789 *, struct S_CHART *);
+
+  /**
+   * @desc    Append sample as one column & scroll history by one
+   *
+   * @param   struct st7789 *
+   * @param   struct S_CHART *
+   * @param   uint16_t value
+   *
+   * @return  void
+   */
+  void ST7789_Chart_Push (struct st7789 *, struct S_CHART *, uint16_t);
+
+  /**
+   * @desc    Stop strip chart, scrolling off
+   *
+   * @param   struct st7789 *
+   *
+   * @return  void
+   */
+  void ST7789_Chart_Stop (struct st7789 *);
+
+#endif
@@ -0,0 +1,127 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       DITHER_DIFFUSION_444 command stream
+ * ---------------------------------------------------------------+ 
+ * @source      tests/screens/dither.scr
+ *
+ * @notes       generated by tools/scr2stream.py, do not edit
+ *              screen 240x280, RAM offset 0, 20
+ *              flash 1719 bytes, wire 1713 bytes (plain calls 1713 bytes)
+ * ---------------------------------------------------------------+
+ */
+#include "src/st7789.h"
+
+/** @array Command stream, ST7789_Stream_Play */
+const uint8_t DITHER_DIFFUSION_444[] PROGMEM = {
+  0x2a, 0x04, 0x00, 0x00, 0x00, 0x24,  // CASET 0..36
+  0x2b, 0x04, 0x00, 0x14, 0x00, 0x2a,  // RASET 0..22
+  // RAMWR 851 pixels
+  0x2c, 0xfe, 0x06, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x02, 0x20, 0x02, 0x20, 0x02,
+  0x20, 0x02, 0x30, 0x02, 0x30, 0x02, 0x40, 0x04, 0x40, 0x04, 0x50, 0x04, 0x50, 0x04, 0x50, 0x04,
+  0x60, 0x06, 0x60, 0x04, 0x70, 0x06, 0x70, 0x06, 0x70, 0x06, 0x88, 0x06, 0x88, 0x08, 0x98, 0x08,
+  0x98, 0x08, 0xa8, 0x08, 0xa8, 0x08, 0xa8, 0x08, 0xb8, 0x0a, 0xb8, 0x0a, 0xc8, 0x0a, 0xc8, 0x0a,
+  0xc8, 0x0a, 0xd8, 0x0c, 0xd8, 0x0a, 0xe8, 0x0c, 0xe8, 0x0c, 0xf8, 0x0c, 0xff, 0xff, 0x00, 0x00,
+  0x10, 0x9b, 0x10, 0x9d, 0x10, 0x1d, 0x20, 0x9d, 0x20, 0x9d, 0x30, 0x1d, 0x30, 0x9f, 0x30, 0x9f,
+  0x40, 0x1f, 0x40, 0x9f, 0x40, 0x80, 0x50, 0x00, 0x60, 0x82, 0x60, 0x80, 0x60, 0x02, 0x70, 0x82,
+  0x70, 0x82, 0x88, 0x02, 0x88, 0x84, 0x88, 0x84, 0x98, 0x04, 0x98, 0x84, 0x98, 0x84, 0xa8, 0x06,
+  0xb8, 0x86, 0xb8, 0x86, 0xb8, 0x06, 0xc8, 0x86, 0xc8, 0x86, 0xd8, 0x08, 0xd8, 0x86, 0xd8, 0x88,
+  0xe8, 0x08, 0xe8, 0x88, 0xe8, 0x88, 0xff, 0xff, 0x00, 0x00, 0x00, 0x99, 0x10, 0x99, 0x11, 0x19,
+  0x20, 0x99, 0x20, 0x99, 0x21, 0x1b, 0x30, 0x99, 0x30, 0x9b, 0x41, 0x1b, 0x40, 0x9b, 0x50, 0x9b,
+  0x51, 0x1d, 0x50, 0x9d, 0x60, 0x9d, 0x61, 0x1d, 0x70, 0x9d, 0x70, 0x9f, 0x71, 0x1f, 0x88, 0x9f,
+  0x88, 0x9f, 0x99, 0x00, 0x98, 0x80, 0xa8, 0x80, 0xa9, 0x02, 0xa8, 0x80, 0xb8, 0x82, 0xb9, 0x02,
+  0xc8, 0x82, 0xc8, 0x84, 0xc9, 0x02, 0xd8, 0x84, 0xd8, 0x84, 0xe9, 0x04, 0xe8, 0x84, 0xf8, 0x86,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x15, 0x11, 0x15, 0x11, 0x15, 0x21, 0x15, 0x21, 0x17, 0x31, 0x15,
+  0x31, 0x17, 0x31, 0x17, 0x41, 0x17, 0x41, 0x17, 0x41, 0x19, 0x51, 0x19, 0x61, 0x19, 0x61, 0x19,
+  0x61, 0x19, 0x71, 0x19, 0x71, 0x1b, 0x89, 0x19, 0x89, 0x1b, 0x89, 0x1b, 0x99, 0x1b, 0x99, 0x1d,
+  0x99, 0x1d, 0xa9, 0x1d, 0xb9, 0x1d, 0xb9, 0x1d, 0xb9, 0x1d, 0xc9, 0x1f, 0xc9, 0x1f, 0xd9, 0x1f,
+  0xd9, 0x00, 0xd9, 0x00, 0xe9, 0x00, 0xe9, 0x02, 0xe9, 0x02, 0xff, 0xff, 0x00, 0x00, 0x11, 0x91,
+  0x11, 0x91, 0x11, 0x91, 0x21, 0x93, 0x21, 0x91, 0x21, 0x93, 0x31, 0x93, 0x31, 0x93, 0x41, 0x93,
+  0x41, 0x95, 0x51, 0x95, 0x51, 0x95, 0x51, 0x95, 0x61, 0x95, 0x61, 0x97, 0x71, 0x95, 0x71, 0x97,
+  0x71, 0x97, 0x89, 0x97, 0x89, 0x97, 0x99, 0x99, 0x99, 0x97, 0xa9, 0x99, 0xa9, 0x99, 0xa9, 0x99,
+  0xb9, 0x99, 0xb9, 0x9b, 0xc9, 0x9b, 0xc9, 0x9b, 0xc9, 0x9b, 0xd9, 0x9b, 0xd9, 0x9d, 0xe9, 0x9d,
+  0xe9, 0x9d, 0xf9, 0x9d, 0xff, 0xff, 0x00, 0x00, 0x01, 0x8c, 0x11, 0x8c, 0x11, 0x8e, 0x21, 0x8c,
+  0x21, 0x8e, 0x31, 0x8e, 0x31, 0x8e, 0x31, 0x8e, 0x41, 0x91, 0x41, 0x91, 0x41, 0x91, 0x51, 0x91,
+  0x51, 0x91, 0x61, 0x91, 0x61, 0x93, 0x71, 0x93, 0x71, 0x93, 0x89, 0x93, 0x89, 0x93, 0x89, 0x95,
+  0x99, 0x93, 0x99, 0x95, 0x99, 0x95, 0xa9, 0x95, 0xa9, 0x95, 0xb9, 0x97, 0xb9, 0x97, 0xc9, 0x97,
+  0xc9, 0x97, 0xd9, 0x97, 0xd9, 0x97, 0xd9, 0x99, 0xe9, 0x97, 0xe9, 0x99, 0xe9, 0x99, 0xff, 0xff,
+  0x00, 0x00, 0x02, 0x28, 0x12, 0x2a, 0x12, 0x28, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0x2a, 0x32, 0x2a,
+  0x32, 0x2c, 0x42, 0x2c, 0x42, 0x2c, 0x52, 0x2c, 0x52, 0x2c, 0x62, 0x2c, 0x62, 0x2e, 0x62, 0x2e,
+  0x72, 0x2e, 0x72, 0x2e, 0x72, 0x2e, 0x8a, 0x31, 0x8a, 0x2e, 0x9a, 0x31, 0x9a, 0x31, 0xaa, 0x31,
+  0xaa, 0x31, 0xba, 0x33, 0xba, 0x33, 0xba, 0x33, 0xca, 0x33, 0xca, 0x33, 0xca, 0x33, 0xda, 0x35,
+  0xda, 0x35, 0xea, 0x35, 0xea, 0x35, 0xfa, 0x35, 0xff, 0xff, 0x00, 0x00, 0x12, 0xa4, 0x12, 0xa6,
+  0x12, 0xa6, 0x22, 0xa6, 0x22, 0xa6, 0x32, 0xa6, 0x32, 0xa8, 0x32, 0xa8, 0x42, 0xa8, 0x42, 0xa8,
+  0x42, 0xa8, 0x52, 0xa8, 0x52, 0xaa, 0x62, 0xaa, 0x62, 0xaa, 0x72, 0xaa, 0x72, 0xaa, 0x8a, 0xac,
+  0x8a, 0xaa, 0x8a, 0xac, 0x9a, 0xac, 0x9a, 0xac, 0x9a, 0xac, 0xaa, 0xae, 0xaa, 0xae, 0xba, 0xae,
+  0xba, 0xae, 0xca, 0xae, 0xca, 0xae, 0xda, 0xb1, 0xda, 0xb1, 0xda, 0xb1, 0xea, 0xb1, 0xea, 0xb1,
+  0xea, 0xb3, 0xff, 0xff, 0x00, 0x00, 0x02, 0xa2, 0x12, 0xa2, 0x12, 0xa2, 0x22, 0xa2, 0x22, 0xa2,
+  0x22, 0xa4, 0x32, 0xa4, 0x32, 0xa4, 0x42, 0xa4, 0x42, 0xa4, 0x52, 0xa4, 0x52, 0xa6, 0x52, 0xa6,
+  0x62, 0xa6, 0x62, 0xa6, 0x72, 0xa6, 0x72, 0xa8, 0x72, 0xa6, 0x8a, 0xa8, 0x8a, 0xa8, 0x9a, 0xa8,
+  0x9a, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xba, 0xaa, 0xba, 0xaa, 0xca, 0xaa, 0xca, 0xac,
+  0xca, 0xac, 0xda, 0xac, 0xda, 0xac, 0xea, 0xac, 0xea, 0xae, 0xfb, 0x2c, 0xff, 0xff, 0x00, 0x00,
+  0x03, 0x3d, 0x13, 0x3d, 0x13, 0x3d, 0x23, 0x3f, 0x23, 0x3f, 0x33, 0x3f, 0x33, 0x3f, 0x33, 0x20,
+  0x43, 0x20, 0x43, 0x22, 0x43, 0x22, 0x53, 0x22, 0x63, 0x22, 0x63, 0x22, 0x63, 0x22, 0x73, 0x24,
+  0x73, 0x22, 0x8b, 0x24, 0x8b, 0x24, 0x8b, 0x24, 0x9b, 0x24, 0x9b, 0x26, 0x9b, 0x26, 0xab, 0x26,
+  0xbb, 0x26, 0xbb, 0x26, 0xbb, 0x26, 0xcb, 0x28, 0xcb, 0x28, 0xdb, 0x28, 0xdb, 0x28, 0xdb, 0x28,
+  0xeb, 0x2a, 0xeb, 0x28, 0xeb, 0x2a, 0xff, 0xff, 0x00, 0x00, 0x13, 0xb9, 0x13, 0xb9, 0x13, 0xb9,
+  0x23, 0xbb, 0x23, 0xb9, 0x23, 0xbb, 0x33, 0xbb, 0x33, 0xbb, 0x43, 0xbd, 0x43, 0xbb, 0x53, 0xbd,
+  0x53, 0xbd, 0x53, 0xbd, 0x63, 0xbd, 0x63, 0xbf, 0x73, 0xbf, 0x73, 0xbf, 0x73, 0xa0, 0x8b, 0xa0,
+  0x8b, 0xa0, 0x9b, 0xa2, 0x9b, 0xa2, 0xab, 0xa2, 0xab, 0xa2, 0xab, 0xa2, 0xbb, 0xa2, 0xbb, 0xa4,
+  0xcb, 0xa4, 0xcb, 0xa4, 0xcb, 0xa4, 0xdb, 0xa4, 0xdb, 0xa6, 0xeb, 0xa4, 0xeb, 0xa6, 0xfb, 0xa6,
+  0xff, 0xff, 0x00, 0x00, 0x03, 0xb5, 0x14, 0x57, 0x13, 0xb5, 0x24, 0x57, 0x23, 0xb7, 0x34, 0x57,
+  0x33, 0xb7, 0x34, 0x59, 0x43, 0xb7, 0x44, 0x59, 0x43, 0xb9, 0x54, 0x59, 0x63, 0xb9, 0x64, 0x5b,
+  0x63, 0xb9, 0x74, 0x5b, 0x73, 0xbb, 0x8c, 0x5b, 0x8b, 0xbd, 0x8c, 0x5d, 0x9b, 0xbd, 0x9c, 0x5d,
+  0x9b, 0xbd, 0xac, 0x5d, 0xbb, 0xbf, 0xbc, 0x5f, 0xbb, 0xbf, 0xcc, 0x5f, 0xcb, 0xa0, 0xdc, 0x40,
+  0xdb, 0xa2, 0xdc, 0x40, 0xeb, 0xa2, 0xec, 0x42, 0xeb, 0xa2, 0xff, 0xff, 0x00, 0x00, 0x04, 0x51,
+  0x14, 0x53, 0x14, 0x53, 0x24, 0x53, 0x24, 0x53, 0x24, 0x53, 0x34, 0x55, 0x34, 0x53, 0x44, 0x55,
+  0x44, 0x55, 0x54, 0x55, 0x54, 0x55, 0x54, 0x57, 0x64, 0x57, 0x64, 0x57, 0x74, 0x57, 0x74, 0x57,
+  0x74, 0x57, 0x8c, 0x59, 0x8c, 0x57, 0x9c, 0x59, 0x9c, 0x59, 0xac, 0x59, 0xac, 0x5b, 0xac, 0x59,
+  0xbc, 0x5b, 0xbc, 0x5b, 0xcc, 0x5b, 0xcc, 0x5b, 0xcc, 0x5d, 0xdc, 0x5d, 0xdc, 0x5d, 0xec, 0x5d,
+  0xec, 0x5d, 0xfc, 0x5d, 0xff, 0xff, 0x00, 0x00, 0x14, 0xce, 0x14, 0xce, 0x14, 0xce, 0x24, 0xce,
+  0x24, 0xce, 0x34, 0xd1, 0x34, 0xce, 0x34, 0xd1, 0x44, 0xd1, 0x44, 0xd1, 0x44, 0xd1, 0x54, 0xd3,
+  0x54, 0xd3, 0x64, 0xd3, 0x64, 0xd3, 0x74, 0xd3, 0x74, 0xd5, 0x8c, 0xd3, 0x8c, 0xd5, 0x8c, 0xd5,
+  0x9c, 0xd5, 0x9c, 0xd5, 0x9c, 0xd7, 0xac, 0xd5, 0xac, 0xd7, 0xbc, 0xd7, 0xbc, 0xd7, 0xcc, 0xd7,
+  0xcc, 0xd9, 0xdc, 0xd9, 0xdc, 0xd9, 0xdc, 0xd9, 0xec, 0xd9, 0xec, 0xdb, 0xec, 0xdb, 0xff, 0xff,
+  0x00, 0x00, 0x05, 0x4a, 0x14, 0xca, 0x15, 0x4a, 0x24, 0xca, 0x25, 0x4c, 0x24, 0xca, 0x35, 0x4c,
+  0x34, 0xcc, 0x45, 0x4c, 0x44, 0xcc, 0x55, 0x4e, 0x54, 0xce, 0x65, 0x4e, 0x64, 0xce, 0x65, 0x4e,
+  0x74, 0xce, 0x75, 0x51, 0x74, 0xd1, 0x8d, 0x51, 0x8c, 0xd1, 0x9d, 0x51, 0x9c, 0xd3, 0xad, 0x51,
+  0xac, 0xd3, 0xbd, 0x53, 0xbc, 0xd3, 0xbd, 0x53, 0xcc, 0xd5, 0xcd, 0x55, 0xcc, 0xd5, 0xdd, 0x55,
+  0xdc, 0xd5, 0xed, 0x55, 0xec, 0xd7, 0xfd, 0x55, 0xff, 0xff, 0x00, 0x00, 0x05, 0x46, 0x15, 0x46,
+  0x15, 0x46, 0x25, 0x48, 0x25, 0x46, 0x35, 0x48, 0x35, 0x48, 0x35, 0x48, 0x45, 0x48, 0x45, 0x4a,
+  0x45, 0x4a, 0x55, 0x4a, 0x55, 0x4a, 0x65, 0x4a, 0x65, 0x4c, 0x75, 0x4c, 0x75, 0x4c, 0x8d, 0x4c,
+  0x8d, 0x4c, 0x8d, 0x4c, 0x9d, 0x4e, 0x9d, 0x4c, 0x9d, 0x4e, 0xad, 0x4e, 0xad, 0x4e, 0xbd, 0x4e,
+  0xbd, 0x51, 0xcd, 0x51, 0xcd, 0x51, 0xdd, 0x51, 0xdd, 0x51, 0xdd, 0x51, 0xed, 0x53, 0xed, 0x53,
+  0xed, 0x53, 0xff, 0xff, 0x00, 0x00, 0x15, 0xc2, 0x15, 0xc2, 0x15, 0xc4, 0x25, 0xc2, 0x25, 0xc4,
+  0x25, 0xc4, 0x35, 0xc4, 0x35, 0xc4, 0x45, 0xc6, 0x45, 0xc6, 0x55, 0xc6, 0x55, 0xc6, 0x55, 0xc6,
+  0x65, 0xc6, 0x65, 0xc8, 0x75, 0xc6, 0x75, 0xc8, 0x75, 0xc8, 0x8d, 0xc8, 0x8d, 0xca, 0x9d, 0xc8,
+  0x9d, 0xca, 0xad, 0xca, 0xad, 0xca, 0xad, 0xca, 0xbd, 0xcc, 0xbd, 0xcc, 0xcd, 0xcc, 0xcd, 0xcc,
+  0xcd, 0xcc, 0xdd, 0xcc, 0xdd, 0xce, 0xed, 0xce, 0xed, 0xce, 0xfd, 0xce, 0xff, 0xff, 0x00, 0x00,
+  0x06, 0x7d, 0x15, 0xdf, 0x16, 0x7f, 0x26, 0x7f, 0x25, 0xc0, 0x36, 0x60, 0x36, 0x60, 0x35, 0xc2,
+  0x46, 0x62, 0x46, 0x62, 0x45, 0xc2, 0x56, 0x62, 0x66, 0x62, 0x65, 0xc4, 0x66, 0x64, 0x76, 0x64,
+  0x75, 0xc4, 0x8e, 0x64, 0x8e, 0x66, 0x8d, 0xc4, 0x9e, 0x66, 0x9e, 0x66, 0x9d, 0xc6, 0xae, 0x66,
+  0xbe, 0x68, 0xbd, 0xc8, 0xbe, 0x68, 0xce, 0x68, 0xcd, 0xc8, 0xde, 0x68, 0xde, 0x6a, 0xdd, 0xca,
+  0xee, 0x6a, 0xee, 0x6a, 0xed, 0xca, 0xff, 0xff, 0x00, 0x00, 0x06, 0x7b, 0x16, 0x79, 0x16, 0x7b,
+  0x26, 0x7b, 0x26, 0x7b, 0x26, 0x7d, 0x36, 0x7d, 0x36, 0x7d, 0x46, 0x7d, 0x46, 0x7d, 0x56, 0x7d,
+  0x56, 0x7f, 0x56, 0x7f, 0x66, 0x7f, 0x66, 0x7f, 0x76, 0x60, 0x76, 0x60, 0x76, 0x62, 0x8e, 0x60,
+  0x8e, 0x62, 0x9e, 0x62, 0x9e, 0x62, 0xae, 0x62, 0xae, 0x64, 0xae, 0x64, 0xbe, 0x64, 0xbe, 0x64,
+  0xce, 0x64, 0xce, 0x64, 0xce, 0x66, 0xde, 0x66, 0xde, 0x66, 0xee, 0x66, 0xee, 0x66, 0xfe, 0x68,
+  0xff, 0xff, 0x00, 0x00, 0x16, 0xf7, 0x16, 0xf7, 0x16, 0xf7, 0x26, 0xf7, 0x26, 0xf7, 0x36, 0xf9,
+  0x36, 0xf7, 0x36, 0xf9, 0x46, 0xf9, 0x46, 0xf9, 0x46, 0xfb, 0x56, 0xf9, 0x66, 0xfb, 0x66, 0xfb,
+  0x66, 0xfb, 0x76, 0xfb, 0x76, 0xfd, 0x8e, 0xfd, 0x8e, 0xfd, 0x8e, 0xfd, 0x9e, 0xfd, 0x9e, 0xff,
+  0x9e, 0xff, 0xae, 0xff, 0xbe, 0xff, 0xbe, 0xe0, 0xbe, 0xe0, 0xce, 0xe2, 0xce, 0xe2, 0xde, 0xe2,
+  0xde, 0xe2, 0xde, 0xe2, 0xee, 0xe2, 0xee, 0xe4, 0xee, 0xe2, 0xff, 0xff, 0x00, 0x00, 0x07, 0x73,
+  0x16, 0xf3, 0x17, 0x73, 0x27, 0x75, 0x26, 0xf3, 0x27, 0x75, 0x37, 0x75, 0x36, 0xf5, 0x47, 0x75,
+  0x47, 0x77, 0x56, 0xf5, 0x57, 0x77, 0x57, 0x77, 0x66, 0xf7, 0x67, 0x77, 0x77, 0x79, 0x76, 0xf7,
+  0x77, 0x79, 0x8f, 0x79, 0x8e, 0xf9, 0x9f, 0x79, 0x9f, 0x7b, 0xae, 0xf9, 0xaf, 0x7b, 0xaf, 0x7b,
+  0xbe, 0xfb, 0xbf, 0x7d, 0xcf, 0x7b, 0xce, 0xfd, 0xcf, 0x7d, 0xdf, 0x7d, 0xde, 0xfd, 0xef, 0x7f,
+  0xef, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x6e, 0x17, 0x6e, 0x17, 0x6e, 0x27, 0x71,
+  0x27, 0xf1, 0x37, 0x71, 0x37, 0x71, 0x37, 0x71, 0x47, 0x73, 0x47, 0x71, 0x47, 0xf3, 0x57, 0x73,
+  0x57, 0x73, 0x67, 0x73, 0x67, 0x75, 0x77, 0x75, 0x77, 0xf5, 0x8f, 0x75, 0x8f, 0x75, 0x8f, 0x77,
+  0x9f, 0x75, 0x9f, 0x77, 0x9f, 0xf7, 0xaf, 0x77, 0xaf, 0x77, 0xbf, 0x79, 0xbf, 0x77, 0xcf, 0x79,
+  0xcf, 0xf9, 0xdf, 0x79, 0xdf, 0x79, 0xdf, 0x7b, 0xef, 0x79, 0xef, 0x7b, 0xef, 0xfb, 0xff, 0xff,
+  0x00, 0x00, 0x17, 0xea, 0x17, 0xec, 0x17, 0xec, 0x27, 0xec, 0x27, 0xec, 0x27, 0xec, 0x37, 0xec,
+  0x37, 0xee, 0x47, 0xec, 0x47, 0xee, 0x57, 0xee, 0x57, 0xee, 0x67, 0xee, 0x67, 0xf1, 0x67, 0xf1,
+  0x77, 0xf1, 0x77, 0xf1, 0x77, 0xf1, 0x8f, 0xf1, 0x8f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf3, 0xaf, 0xf3,
+  0xaf, 0xf3, 0xbf, 0xf5, 0xbf, 0xf3, 0xbf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xcf, 0xf5, 0xdf, 0xf7,
+  0xdf, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xff, 0xf7, 0xff, 0xff,
+  0x00                                  // end
+};
@@ -0,0 +1,127 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       DITHER_DIFFUSION_565 command stream
+ * ---------------------------------------------------------------+ 
+ * @source      tests/screens/dither.scr
+ *
+ * @notes       generated by tools/scr2stream.py, do not edit
+ *              screen 240x280, RAM offset 0, 20
+ *              flash 1719 bytes, wire 1713 bytes (plain calls 1713 bytes)
+ * ---------------------------------------------------------------+
+ */
+#include "src/st7789.h"
+
+/** @array Command stream, ST7789_Stream_Play */
+const uint8_t DITHER_DIFFUSION_565[] PROGMEM = {
+  0x2a, 0x04, 0x00, 0x00, 0x00, 0x24,  // CASET 0..36
+  0x2b, 0x04, 0x00, 0x14, 0x00, 0x2a,  // RASET 0..22
+  // RAMWR 851 pixels
+  0x2c, 0xfe, 0x06, 0xa6, 0x00, 0x00, 0x08, 0x00, 0x10, 0x01, 0x18, 0x01, 0x18, 0x01, 0x20, 0x02,
+  0x28, 0x02, 0x30, 0x03, 0x38, 0x03, 0x40, 0x03, 0x40, 0x04, 0x48, 0x04, 0x50, 0x04, 0x58, 0x05,
+  0x60, 0x05, 0x68, 0x05, 0x70, 0x06, 0x78, 0x06, 0x78, 0x07, 0x80, 0x07, 0x88, 0x07, 0x90, 0x08,
+  0x98, 0x08, 0xa0, 0x08, 0xa8, 0x09, 0xa8, 0x09, 0xb0, 0x09, 0xb8, 0x0a, 0xc0, 0x0a, 0xc8, 0x0b,
+  0xd0, 0x0b, 0xd8, 0x0b, 0xd8, 0x0c, 0xe0, 0x0c, 0xe8, 0x0c, 0xf0, 0x0d, 0xff, 0xff, 0x00, 0x00,
+  0x08, 0x7c, 0x10, 0x7c, 0x10, 0x7c, 0x20, 0x7d, 0x20, 0x7d, 0x28, 0x7e, 0x30, 0x7e, 0x38, 0x7e,
+  0x40, 0x7f, 0x40, 0x7f, 0x50, 0x60, 0x50, 0x61, 0x58, 0x61, 0x60, 0x61, 0x68, 0x62, 0x70, 0x62,
+  0x78, 0x62, 0x78, 0x63, 0x80, 0x63, 0x88, 0x64, 0x90, 0x64, 0x98, 0x64, 0xa0, 0x65, 0xa0, 0x65,
+  0xb0, 0x65, 0xb0, 0x66, 0xb8, 0x66, 0xc0, 0x66, 0xc8, 0x67, 0xd0, 0x67, 0xd8, 0x68, 0xd8, 0x68,
+  0xe8, 0x68, 0xe8, 0x69, 0xf0, 0x69, 0xff, 0xff, 0x00, 0x00, 0x08, 0xd8, 0x10, 0xd8, 0x18, 0xd9,
+  0x18, 0xd9, 0x20, 0xd9, 0x28, 0xda, 0x30, 0xda, 0x38, 0xdb, 0x40, 0xdb, 0x40, 0xdb, 0x48, 0xdc,
+  0x50, 0xdc, 0x58, 0xdc, 0x60, 0xdd, 0x68, 0xdd, 0x70, 0xdd, 0x78, 0xde, 0x78, 0xde, 0x80, 0xdf,
+  0x88, 0xdf, 0x90, 0xc0, 0x98, 0xc0, 0xa0, 0xc1, 0xa8, 0xc1, 0xa8, 0xc2, 0xb0, 0xc2, 0xb8, 0xc2,
+  0xc0, 0xc3, 0xc8, 0xc3, 0xd0, 0xc3, 0xd8, 0xc4, 0xd8, 0xc4, 0xe0, 0xc4, 0xe8, 0xc5, 0xf0, 0xc5,
+  0xff, 0xff, 0x00, 0x00, 0x09, 0x14, 0x11, 0x15, 0x19, 0x15, 0x19, 0x15, 0x21, 0x16, 0x29, 0x16,
+  0x31, 0x16, 0x39, 0x17, 0x41, 0x17, 0x41, 0x17, 0x51, 0x18, 0x51, 0x18, 0x59, 0x19, 0x61, 0x19,
+  0x69, 0x19, 0x71, 0x1a, 0x79, 0x1a, 0x79, 0x1a, 0x81, 0x1b, 0x89, 0x1b, 0x91, 0x1b, 0x99, 0x1c,
+  0xa1, 0x1c, 0xa1, 0x1d, 0xb1, 0x1d, 0xb1, 0x1d, 0xb9, 0x1e, 0xc1, 0x1e, 0xc9, 0x1e, 0xd1, 0x1f,
+  0xd9, 0x00, 0xd9, 0x00, 0xe1, 0x01, 0xe9, 0x01, 0xf1, 0x01, 0xff, 0xff, 0x00, 0x00, 0x09, 0x70,
+  0x11, 0x71, 0x11, 0x71, 0x21, 0x72, 0x21, 0x72, 0x29, 0x72, 0x31, 0x73, 0x39, 0x73, 0x41, 0x73,
+  0x41, 0x74, 0x49, 0x74, 0x51, 0x74, 0x59, 0x75, 0x61, 0x75, 0x69, 0x76, 0x71, 0x76, 0x79, 0x76,
+  0x79, 0x77, 0x81, 0x77, 0x89, 0x77, 0x91, 0x78, 0x99, 0x78, 0xa1, 0x78, 0xa9, 0x79, 0xa9, 0x79,
+  0xb1, 0x7a, 0xb9, 0x7a, 0xc1, 0x7a, 0xc9, 0x7b, 0xd1, 0x7b, 0xd9, 0x7b, 0xd9, 0x7c, 0xe9, 0x7c,
+  0xe9, 0x7c, 0xf1, 0x7d, 0xff, 0xff, 0x00, 0x00, 0x09, 0xcd, 0x11, 0xcd, 0x19, 0xcd, 0x19, 0xce,
+  0x21, 0xce, 0x29, 0xce, 0x31, 0xcf, 0x39, 0xcf, 0x41, 0xd0, 0x41, 0xd0, 0x51, 0xd0, 0x51, 0xd1,
+  0x59, 0xd1, 0x61, 0xd1, 0x69, 0xd2, 0x71, 0xd2, 0x79, 0xd2, 0x79, 0xd3, 0x81, 0xd3, 0x89, 0xd4,
+  0x91, 0xd4, 0x99, 0xd4, 0xa1, 0xd5, 0xa1, 0xd5, 0xb1, 0xd5, 0xb1, 0xd6, 0xb9, 0xd6, 0xc1, 0xd6,
+  0xc9, 0xd7, 0xd1, 0xd7, 0xd9, 0xd8, 0xd9, 0xd8, 0xe1, 0xd8, 0xe9, 0xd9, 0xf1, 0xd9, 0xff, 0xff,
+  0x00, 0x00, 0x0a, 0x29, 0x12, 0x29, 0x1a, 0x2a, 0x1a, 0x2a, 0x22, 0x2a, 0x2a, 0x2b, 0x32, 0x2b,
+  0x3a, 0x2b, 0x42, 0x2c, 0x42, 0x2c, 0x4a, 0x2d, 0x52, 0x2d, 0x5a, 0x2d, 0x62, 0x2e, 0x6a, 0x2e,
+  0x72, 0x2e, 0x7a, 0x2f, 0x7a, 0x2f, 0x82, 0x2f, 0x8a, 0x30, 0x92, 0x30, 0x9a, 0x31, 0xa2, 0x31,
+  0xaa, 0x31, 0xaa, 0x32, 0xb2, 0x32, 0xba, 0x32, 0xc2, 0x33, 0xca, 0x33, 0xd2, 0x33, 0xda, 0x34,
+  0xda, 0x34, 0xe2, 0x35, 0xea, 0x35, 0xf2, 0x35, 0xff, 0xff, 0x00, 0x00, 0x0a, 0x85, 0x12, 0x85,
+  0x12, 0x86, 0x22, 0x86, 0x22, 0x87, 0x2a, 0x87, 0x32, 0x87, 0x3a, 0x88, 0x42, 0x88, 0x42, 0x88,
+  0x52, 0x89, 0x52, 0x89, 0x5a, 0x89, 0x62, 0x8a, 0x6a, 0x8a, 0x72, 0x8b, 0x7a, 0x8b, 0x7a, 0x8b,
+  0x82, 0x8c, 0x8a, 0x8c, 0x92, 0x8c, 0x9a, 0x8d, 0xa2, 0x8d, 0xa2, 0x8d, 0xb2, 0x8e, 0xb2, 0x8e,
+  0xba, 0x8f, 0xc2, 0x8f, 0xca, 0x8f, 0xd2, 0x90, 0xda, 0x90, 0xda, 0x90, 0xea, 0x91, 0xea, 0x91,
+  0xf2, 0x92, 0xff, 0xff, 0x00, 0x00, 0x0a, 0xe1, 0x12, 0xe2, 0x1a, 0xe2, 0x1a, 0xe2, 0x22, 0xe3,
+  0x2a, 0xe3, 0x32, 0xe4, 0x3a, 0xe4, 0x42, 0xe4, 0x42, 0xe5, 0x4a, 0xe5, 0x52, 0xe5, 0x5a, 0xe6,
+  0x62, 0xe6, 0x6a, 0xe6, 0x72, 0xe7, 0x7a, 0xe7, 0x7a, 0xe8, 0x82, 0xe8, 0x8a, 0xe8, 0x92, 0xe9,
+  0x9a, 0xe9, 0xa2, 0xe9, 0xaa, 0xea, 0xaa, 0xea, 0xb2, 0xea, 0xba, 0xeb, 0xc2, 0xeb, 0xca, 0xec,
+  0xd2, 0xec, 0xda, 0xec, 0xda, 0xed, 0xe2, 0xed, 0xea, 0xed, 0xf2, 0xee, 0xff, 0xff, 0x00, 0x00,
+  0x0b, 0x5d, 0x13, 0x5d, 0x1b, 0x5d, 0x1b, 0x5e, 0x23, 0x5e, 0x2b, 0x5f, 0x33, 0x5f, 0x3b, 0x40,
+  0x43, 0x40, 0x43, 0x41, 0x53, 0x41, 0x53, 0x42, 0x5b, 0x42, 0x63, 0x42, 0x6b, 0x43, 0x73, 0x43,
+  0x7b, 0x43, 0x7b, 0x44, 0x83, 0x44, 0x8b, 0x44, 0x93, 0x45, 0x9b, 0x45, 0xa3, 0x46, 0xa3, 0x46,
+  0xb3, 0x46, 0xb3, 0x47, 0xbb, 0x47, 0xc3, 0x47, 0xcb, 0x48, 0xd3, 0x48, 0xdb, 0x49, 0xdb, 0x49,
+  0xe3, 0x49, 0xeb, 0x4a, 0xf3, 0x4a, 0xff, 0xff, 0x00, 0x00, 0x0b, 0x99, 0x13, 0x99, 0x13, 0x9a,
+  0x23, 0x9a, 0x23, 0x9a, 0x2b, 0x9b, 0x33, 0x9b, 0x3b, 0x9b, 0x43, 0x9c, 0x43, 0x9c, 0x4b, 0x9d,
+  0x53, 0x9d, 0x5b, 0x9d, 0x63, 0x9e, 0x6b, 0x9e, 0x73, 0x9e, 0x7b, 0x9f, 0x7b, 0x80, 0x83, 0x80,
+  0x8b, 0x81, 0x93, 0x81, 0x9b, 0x81, 0xa3, 0x82, 0xab, 0x82, 0xab, 0x83, 0xb3, 0x83, 0xbb, 0x83,
+  0xc3, 0x84, 0xcb, 0x84, 0xd3, 0x84, 0xdb, 0x85, 0xdb, 0x85, 0xeb, 0x85, 0xeb, 0x86, 0xf3, 0x86,
+  0xff, 0xff, 0x00, 0x00, 0x0b, 0xf5, 0x13, 0xf6, 0x1b, 0xf6, 0x1b, 0xf6, 0x23, 0xf7, 0x2b, 0xf7,
+  0x33, 0xf7, 0x3b, 0xf8, 0x43, 0xf8, 0x43, 0xf8, 0x53, 0xf9, 0x53, 0xf9, 0x5b, 0xfa, 0x63, 0xfa,
+  0x6b, 0xfa, 0x73, 0xfb, 0x7b, 0xfb, 0x7b, 0xfb, 0x83, 0xfc, 0x8b, 0xfc, 0x93, 0xfc, 0x9b, 0xfd,
+  0xa3, 0xfd, 0xa3, 0xfe, 0xb3, 0xfe, 0xb3, 0xfe, 0xbb, 0xff, 0xc3, 0xff, 0xcb, 0xe0, 0xd3, 0xe1,
+  0xdb, 0xe1, 0xdb, 0xe1, 0xe3, 0xe2, 0xeb, 0xe2, 0xf3, 0xe2, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x51,
+  0x14, 0x52, 0x1c, 0x52, 0x1c, 0x52, 0x24, 0x53, 0x2c, 0x53, 0x34, 0x54, 0x3c, 0x54, 0x44, 0x54,
+  0x44, 0x55, 0x4c, 0x55, 0x54, 0x55, 0x5c, 0x56, 0x64, 0x56, 0x6c, 0x56, 0x74, 0x57, 0x7c, 0x57,
+  0x7c, 0x58, 0x84, 0x58, 0x8c, 0x58, 0x94, 0x59, 0x9c, 0x59, 0xa4, 0x59, 0xac, 0x5a, 0xac, 0x5a,
+  0xb4, 0x5b, 0xbc, 0x5b, 0xc4, 0x5b, 0xcc, 0x5c, 0xd4, 0x5c, 0xdc, 0x5c, 0xdc, 0x5d, 0xe4, 0x5d,
+  0xec, 0x5d, 0xf4, 0x5e, 0xff, 0xff, 0x00, 0x00, 0x0c, 0xae, 0x14, 0xae, 0x14, 0xae, 0x24, 0xaf,
+  0x24, 0xaf, 0x2c, 0xaf, 0x34, 0xb0, 0x3c, 0xb0, 0x44, 0xb1, 0x44, 0xb1, 0x54, 0xb1, 0x54, 0xb2,
+  0x5c, 0xb2, 0x64, 0xb2, 0x6c, 0xb3, 0x74, 0xb3, 0x7c, 0xb3, 0x7c, 0xb4, 0x84, 0xb4, 0x8c, 0xb5,
+  0x94, 0xb5, 0x9c, 0xb5, 0xa4, 0xb6, 0xa4, 0xb6, 0xb4, 0xb6, 0xb4, 0xb7, 0xbc, 0xb7, 0xc4, 0xb7,
+  0xcc, 0xb8, 0xd4, 0xb8, 0xdc, 0xb9, 0xdc, 0xb9, 0xec, 0xb9, 0xec, 0xba, 0xf4, 0xba, 0xff, 0xff,
+  0x00, 0x00, 0x0d, 0x0a, 0x15, 0x0a, 0x1d, 0x0b, 0x1d, 0x0b, 0x25, 0x0b, 0x2d, 0x0c, 0x35, 0x0c,
+  0x3d, 0x0c, 0x45, 0x0d, 0x45, 0x0d, 0x4d, 0x0d, 0x55, 0x0e, 0x5d, 0x0e, 0x65, 0x0f, 0x6d, 0x0f,
+  0x75, 0x0f, 0x7d, 0x10, 0x7d, 0x10, 0x85, 0x10, 0x8d, 0x11, 0x95, 0x11, 0x9d, 0x12, 0xa5, 0x12,
+  0xad, 0x12, 0xad, 0x13, 0xb5, 0x13, 0xbd, 0x13, 0xc5, 0x14, 0xcd, 0x14, 0xd5, 0x14, 0xdd, 0x15,
+  0xdd, 0x15, 0xe5, 0x16, 0xed, 0x16, 0xf5, 0x16, 0xff, 0xff, 0x00, 0x00, 0x0d, 0x66, 0x15, 0x66,
+  0x1d, 0x67, 0x1d, 0x67, 0x25, 0x68, 0x2d, 0x68, 0x35, 0x68, 0x3d, 0x69, 0x45, 0x69, 0x45, 0x69,
+  0x55, 0x6a, 0x55, 0x6a, 0x5d, 0x6a, 0x65, 0x6b, 0x6d, 0x6b, 0x75, 0x6c, 0x7d, 0x6c, 0x7d, 0x6c,
+  0x85, 0x6d, 0x8d, 0x6d, 0x95, 0x6d, 0x9d, 0x6e, 0xa5, 0x6e, 0xa5, 0x6e, 0xb5, 0x6f, 0xb5, 0x6f,
+  0xbd, 0x70, 0xc5, 0x70, 0xcd, 0x70, 0xd5, 0x71, 0xdd, 0x71, 0xdd, 0x71, 0xe5, 0x72, 0xed, 0x72,
+  0xf5, 0x72, 0xff, 0xff, 0x00, 0x00, 0x0d, 0xc2, 0x15, 0xc3, 0x15, 0xc3, 0x25, 0xc3, 0x25, 0xc4,
+  0x2d, 0xc4, 0x35, 0xc4, 0x3d, 0xc5, 0x45, 0xc5, 0x45, 0xc6, 0x4d, 0xc6, 0x55, 0xc6, 0x5d, 0xc7,
+  0x65, 0xc7, 0x6d, 0xc7, 0x75, 0xc8, 0x7d, 0xc8, 0x7d, 0xc9, 0x85, 0xc9, 0x8d, 0xc9, 0x95, 0xca,
+  0x9d, 0xca, 0xa5, 0xca, 0xad, 0xcb, 0xad, 0xcb, 0xb5, 0xcb, 0xbd, 0xcc, 0xc5, 0xcc, 0xcd, 0xcd,
+  0xd5, 0xcd, 0xdd, 0xcd, 0xdd, 0xce, 0xed, 0xce, 0xed, 0xce, 0xf5, 0xcf, 0xff, 0xff, 0x00, 0x00,
+  0x0e, 0x3e, 0x16, 0x3e, 0x1e, 0x3e, 0x1e, 0x3f, 0x26, 0x20, 0x2e, 0x20, 0x36, 0x21, 0x3e, 0x21,
+  0x46, 0x21, 0x46, 0x22, 0x56, 0x22, 0x56, 0x23, 0x5e, 0x23, 0x66, 0x23, 0x6e, 0x24, 0x76, 0x24,
+  0x7e, 0x24, 0x7e, 0x25, 0x86, 0x25, 0x8e, 0x25, 0x96, 0x26, 0x9e, 0x26, 0xa6, 0x27, 0xa6, 0x27,
+  0xb6, 0x27, 0xb6, 0x28, 0xbe, 0x28, 0xc6, 0x28, 0xce, 0x29, 0xd6, 0x29, 0xde, 0x29, 0xde, 0x2a,
+  0xe6, 0x2a, 0xee, 0x2b, 0xf6, 0x2b, 0xff, 0xff, 0x00, 0x00, 0x0e, 0x7a, 0x16, 0x7a, 0x1e, 0x7b,
+  0x1e, 0x7b, 0x26, 0x7b, 0x2e, 0x7c, 0x36, 0x7c, 0x3e, 0x7c, 0x46, 0x7d, 0x46, 0x7d, 0x4e, 0x7e,
+  0x56, 0x7e, 0x5e, 0x7e, 0x66, 0x7f, 0x6e, 0x7f, 0x76, 0x60, 0x7e, 0x61, 0x7e, 0x61, 0x86, 0x61,
+  0x8e, 0x62, 0x96, 0x62, 0x9e, 0x62, 0xa6, 0x63, 0xae, 0x63, 0xae, 0x64, 0xb6, 0x64, 0xbe, 0x64,
+  0xc6, 0x65, 0xce, 0x65, 0xd6, 0x65, 0xde, 0x66, 0xde, 0x66, 0xe6, 0x66, 0xee, 0x67, 0xf6, 0x67,
+  0xff, 0xff, 0x00, 0x00, 0x0e, 0xd6, 0x16, 0xd6, 0x16, 0xd7, 0x26, 0xd7, 0x26, 0xd8, 0x2e, 0xd8,
+  0x36, 0xd8, 0x3e, 0xd9, 0x46, 0xd9, 0x46, 0xd9, 0x56, 0xda, 0x56, 0xda, 0x5e, 0xdb, 0x66, 0xdb,
+  0x6e, 0xdb, 0x76, 0xdc, 0x7e, 0xdc, 0x7e, 0xdc, 0x86, 0xdd, 0x8e, 0xdd, 0x96, 0xdd, 0x9e, 0xde,
+  0xa6, 0xde, 0xa6, 0xdf, 0xb6, 0xdf, 0xb6, 0xc0, 0xbe, 0xc0, 0xc6, 0xc1, 0xce, 0xc1, 0xd6, 0xc2,
+  0xde, 0xc2, 0xde, 0xc2, 0xee, 0xc3, 0xee, 0xc3, 0xf6, 0xc3, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x32,
+  0x17, 0x33, 0x1f, 0x33, 0x1f, 0x33, 0x27, 0x34, 0x2f, 0x34, 0x37, 0x35, 0x3f, 0x35, 0x47, 0x35,
+  0x47, 0x36, 0x4f, 0x36, 0x57, 0x36, 0x5f, 0x37, 0x67, 0x37, 0x6f, 0x37, 0x77, 0x38, 0x7f, 0x38,
+  0x7f, 0x39, 0x87, 0x39, 0x8f, 0x39, 0x97, 0x3a, 0x9f, 0x3a, 0xa7, 0x3a, 0xaf, 0x3b, 0xaf, 0x3b,
+  0xb7, 0x3b, 0xbf, 0x3c, 0xc7, 0x3c, 0xcf, 0x3d, 0xd7, 0x3d, 0xdf, 0x3d, 0xdf, 0x3e, 0xe7, 0x3e,
+  0xef, 0x3e, 0xf7, 0x3f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x8f, 0x17, 0x8f, 0x1f, 0x8f, 0x1f, 0x90,
+  0x27, 0x90, 0x2f, 0x90, 0x37, 0x91, 0x3f, 0x91, 0x47, 0x92, 0x47, 0x92, 0x57, 0x92, 0x57, 0x93,
+  0x5f, 0x93, 0x67, 0x93, 0x6f, 0x94, 0x77, 0x94, 0x7f, 0x94, 0x7f, 0x95, 0x87, 0x95, 0x8f, 0x96,
+  0x97, 0x96, 0x9f, 0x96, 0xa7, 0x97, 0xa7, 0x97, 0xb7, 0x97, 0xb7, 0x98, 0xbf, 0x98, 0xc7, 0x98,
+  0xcf, 0x99, 0xd7, 0x99, 0xdf, 0x9a, 0xdf, 0x9a, 0xe7, 0x9a, 0xef, 0x9b, 0xf7, 0x9b, 0xff, 0xff,
+  0x00, 0x00, 0x0f, 0xeb, 0x17, 0xeb, 0x17, 0xec, 0x27, 0xec, 0x27, 0xec, 0x2f, 0xed, 0x37, 0xed,
+  0x3f, 0xed, 0x47, 0xee, 0x47, 0xee, 0x4f, 0xee, 0x57, 0xef, 0x5f, 0xef, 0x67, 0xf0, 0x6f, 0xf0,
+  0x77, 0xf0, 0x7f, 0xf1, 0x7f, 0xf1, 0x87, 0xf1, 0x8f, 0xf2, 0x97, 0xf2, 0x9f, 0xf2, 0xa7, 0xf3,
+  0xaf, 0xf3, 0xaf, 0xf4, 0xb7, 0xf4, 0xbf, 0xf4, 0xc7, 0xf5, 0xcf, 0xf5, 0xd7, 0xf5, 0xdf, 0xf6,
+  0xdf, 0xf6, 0xef, 0xf6, 0xef, 0xf7, 0xf7, 0xf7, 0xff, 0xff,
+  0x00                                  // end
+};
@@ -0,0 +1,130 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       DITHER_ORDERED_444 command stream
+ * ---------------------------------------------------------------+ 
+ * @source      tests/screens/dither.scr
+ *
+ * @notes       generated by tools/scr2stream.py, do not edit
+ *              screen 240x280, RAM offset 0, 20
+ *              flash 1721 bytes, wire 1715 bytes (plain calls 1713 bytes)
+ * ---------------------------------------------------------------+
+ */
+#include "src/st7789.h"
+
+/** @array Command stream, ST7789_Stream_Play */
+const uint8_t DITHER_ORDERED_444[] PROGMEM = {
+  0x2a, 0x04, 0x00, 0x00, 0x00, 0x24,  // CASET 0..36
+  0x2b, 0x04, 0x00, 0x14, 0x00, 0x2a,  // RASET 0..22
+  // RAMWR 439 pixels
+  0x2c, 0xfe, 0x03, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x02, 0x10, 0x00, 0x20, 0x02,
+  0x20, 0x02, 0x30, 0x02, 0x30, 0x02, 0x40, 0x04, 0x40, 0x04, 0x50, 0x04, 0x50, 0x04, 0x60, 0x04,
+  0x60, 0x04, 0x70, 0x06, 0x70, 0x06, 0x88, 0x06, 0x88, 0x06, 0x98, 0x08, 0x88, 0x06, 0x98, 0x08,
+  0x98, 0x08, 0xa8, 0x08, 0xa8, 0x08, 0xb8, 0x0a, 0xb8, 0x0a, 0xc8, 0x0a, 0xc8, 0x0a, 0xd8, 0x0a,
+  0xd8, 0x0a, 0xe8, 0x0c, 0xe8, 0x0c, 0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0x0e, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x1d, 0x10, 0x9f, 0x10, 0x9f, 0x20, 0x9f, 0x20, 0x1f, 0x30, 0x9f, 0x30, 0x9f, 0x40, 0x9f,
+  0x40, 0x1f, 0x50, 0x9f, 0x50, 0x80, 0x60, 0x82, 0x60, 0x00, 0x70, 0x82, 0x70, 0x82, 0x70, 0x82,
+  0x70, 0x02, 0x88, 0x84, 0x88, 0x84, 0x98, 0x84, 0x98, 0x04, 0xa8, 0x86, 0xa8, 0x84, 0xb8, 0x86,
+  0xb8, 0x06, 0xc8, 0x86, 0xc8, 0x86, 0xd8, 0x88, 0xd8, 0x06, 0xe8, 0x88, 0xe8, 0x88, 0xe8, 0x88,
+  0xe8, 0x08, 0xf8, 0x8a, 0xf8, 0x8a, 0xff, 0xff, 0x00, 0x00, 0x11, 0x1b, 0x00, 0x99, 0x11, 0x1b,
+  0x10, 0x9b, 0x21, 0x1b, 0x20, 0x9b, 0x31, 0x1d, 0x30, 0x9b, 0x41, 0x1d, 0x40, 0x9d, 0x51, 0x1d,
+  0x50, 0x9d, 0x61, 0x1f, 0x60, 0x9d, 0x71, 0x1f, 0x70, 0x9f, 0x89, 0x1f, 0x88, 0x9f, 0x89, 0x1f,
+  0x98, 0x9f, 0x99, 0x00, 0x98, 0x80, 0xa9, 0x02, 0xa8, 0x80, 0xb9, 0x02, 0xb8, 0x82, 0xc9, 0x02,
+  0xc8, 0x82, 0xd9, 0x04, 0xd8, 0x82, 0xe9, 0x04, 0xe8, 0x84, 0xf9, 0x06, 0xf8, 0x84, 0xf9, 0x06,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x15, 0x11, 0x17, 0x11, 0x17, 0x21, 0x97, 0x21, 0x17, 0x31, 0x19,
+  0x31, 0x17, 0x41, 0x99, 0x41, 0x19, 0x51, 0x19, 0x51, 0x19, 0x61, 0x9b, 0x61, 0x1b, 0x71, 0x1b,
+  0x61, 0x1b, 0x89, 0x9d, 0x71, 0x1b, 0x89, 0x1d, 0x89, 0x1d, 0x99, 0x9d, 0x99, 0x1d, 0xa9, 0x1f,
+  0xa9, 0x1d, 0xb9, 0x9f, 0xb9, 0x1f, 0xc9, 0x1f, 0xc9, 0x1f, 0xd9, 0x9f, 0xd9, 0x1f, 0xe9, 0x1f,
+  0xe9, 0x00, 0xf9, 0x82, 0xf9, 0x00, 0xf9, 0x02, 0xf9, 0x02, 0xff, 0xff, 0x00, 0x00, 0x01, 0x91,
+  0x11, 0x91, 0x11, 0x93, 0x11, 0x13, 0x21, 0x93, 0x21, 0x93, 0x31, 0x95, 0x31, 0x13, 0x41, 0x95,
+  0x41, 0x95, 0x51, 0x95, 0x51, 0x15, 0x61, 0x97, 0x61, 0x97, 0x71, 0x97, 0x71, 0x17, 0x89, 0x97,
+  0x89, 0x97, 0x99, 0x99, 0x89, 0x19, 0x99, 0x99, 0x99, 0x99, 0xa9, 0x9b, 0xa9, 0x19, 0xb9, 0x9b,
+  0xb9, 0x9b, 0xc9, 0x9b, 0xc9, 0x1b, 0xd9, 0x9d, 0xd9, 0x9d, 0xe9, 0x9d, 0xe9, 0x1d, 0xf9, 0x9d,
+  0xf9, 0x9d, 0xf9, 0x9f, 0xff, 0xff, 0x00, 0x00, 0x01, 0x8c, 0x12, 0x2e, 0x11, 0x8e, 0x22, 0x2e,
+  0x21, 0x8e, 0x32, 0x31, 0x31, 0x91, 0x42, 0x31, 0x41, 0x91, 0x52, 0x33, 0x51, 0x91, 0x62, 0x33,
+  0x61, 0x93, 0x72, 0x33, 0x71, 0x93, 0x72, 0x35, 0x71, 0x93, 0x8a, 0x35, 0x89, 0x95, 0x9a, 0x35,
+  0x99, 0x95, 0xaa, 0x37, 0xa9, 0x97, 0xba, 0x37, 0xb9, 0x97, 0xca, 0x39, 0xc9, 0x97, 0xda, 0x39,
+  0xd9, 0x99, 0xea, 0x39, 0xe9, 0x99, 0xea, 0x3b, 0xe9, 0x99, 0xfa, 0x3b, 0xf9, 0x9b, 0xff, 0xff,
+  0x00, 0x00, 0x12, 0xaa, 0x02, 0x28, 0x12, 0x2a, 0x12, 0x2a, 0x22, 0xac, 0x22, 0x2a, 0x32, 0x2c,
+  0x32, 0x2c, 0x42, 0xac, 0x42, 0x2c, 0x52, 0x2e, 0x52, 0x2c, 0x62, 0xae, 0x62, 0x2e, 0x72, 0x2e,
+  0x72, 0x2e, 0x8a, 0xb1, 0x8a, 0x2e, 0x8a, 0x31, 0x9a, 0x31, 0x9a, 0xb3, 0x9a, 0x31, 0xaa, 0x33,
+  0xaa, 0x33, 0xba, 0xb3, 0xba, 0x33, 0xca, 0x35, 0xca, 0x33, 0xda, 0xb5, 0xda, 0x35, 0xea, 0x35,
+  0xea, 0x35, 0xfa, 0xb7, 0xfa, 0x35, 0xfa, 0x37, 0xff, 0xff, 0x00, 0x00, 0x02, 0xa6, 0x12, 0xa6,
+  0x12, 0xa6, 0x23, 0x28, 0x22, 0xa6, 0x32, 0xa8, 0x32, 0xa8, 0x43, 0x28, 0x42, 0xa8, 0x52, 0xaa,
+  0x52, 0xa8, 0x63, 0x2a, 0x62, 0xaa, 0x72, 0xaa, 0x62, 0xaa, 0x8b, 0x2c, 0x72, 0xac, 0x8a, 0xac,
+  0x8a, 0xac, 0x9b, 0x2e, 0x9a, 0xac, 0xaa, 0xae, 0xaa, 0xae, 0xbb, 0x2e, 0xba, 0xae, 0xca, 0xb1,
+  0xca, 0xae, 0xdb, 0x31, 0xda, 0xb1, 0xea, 0xb1, 0xea, 0xb1, 0xfb, 0x33, 0xfa, 0xb3, 0xfa, 0xb3,
+  0xfa, 0xb3, 0xff, 0xff, 0x00, 0x00, 0x03, 0x22, 0x12, 0xa2, 0x13, 0x22, 0x12, 0xa2, 0x23, 0x22,
+  0x22, 0xa2, 0x33, 0x24, 0x32, 0xa4, 0x43, 0x24, 0x42, 0xa4, 0x53, 0x26, 0x52, 0xa4, 0x63, 0x26,
+  0x62, 0xa6, 0x73, 0x26, 0x72, 0xa6, 0x8b, 0x28, 0x8a, 0xa8, 0x9b, 0x28, 0x8a, 0xa8, 0x9b, 0x28,
+  0x9a, 0xa8, 0xab, 0x2a, 0xaa, 0xaa, 0xbb, 0x2a, 0xba, 0xaa, 0xcb, 0x2c, 0xca, 0xaa, 0xdb, 0x2c,
+  0xda, 0xac, 0xeb, 0x2c, 0xea, 0xac, 0xfb, 0x2e, 0xfa, 0xae, 0xfb, 0x2e, 0xff, 0xff, 0x00, 0x00,
+  0x03, 0x3f, 0x13, 0xbf, 0x13, 0x3f, 0x23, 0xbf, 0x23, 0x3f, 0x33, 0xbf, 0x33, 0x3f, 0x43, 0xa0,
+  0x43, 0x20, 0x53, 0xa2, 0x53, 0x22, 0x63, 0xa2, 0x63, 0x22, 0x73, 0xa4, 0x73, 0x22, 0x73, 0xa4,
+  0x73, 0x24, 0x8b, 0xa4, 0x8b, 0x24, 0x9b, 0xa6, 0x9b, 0x24, 0xab, 0xa6, 0xab, 0x26, 0xbb, 0xa6,
+  0xbb, 0x26, 0xcb, 0xa8, 0xcb, 0x28, 0xdb, 0xa8, 0xdb, 0x28, 0xeb, 0xaa, 0xeb, 0x28, 0xeb, 0xaa,
+  0xeb, 0x2a, 0xfb, 0xaa, 0xfb, 0x2a, 0xff, 0xff, 0x00, 0x00, 0x13, 0xbb, 0x03, 0xbb, 0x13, 0xbb,
+  0x13, 0xbb, 0x23, 0xbd, 0x23, 0xbb, 0x33, 0xbd, 0x33, 0xbd, 0x43, 0xbf, 0x43, 0xbd, 0x53, 0xbf,
+  0x53, 0xbf, 0x63, 0xbf, 0x63, 0xbf, 0x73, 0xbf, 0x73, 0xbf, 0x8b, 0xbf, 0x8b, 0xa0, 0x8b, 0xa0,
+  0x9b, 0xa0, 0x9b, 0xa2, 0x9b, 0xa0, 0xab, 0xa2, 0xab, 0xa2, 0xbb, 0xa4, 0xbb, 0xa2, 0xcb, 0xa4,
+  0xcb, 0xa4, 0xdb, 0xa4, 0xdb, 0xa4, 0xeb, 0xa6, 0xeb, 0xa4, 0xfb, 0xa6, 0xfb, 0xa6, 0xfb, 0xa6,
+  0xff, 0xff, 0x00, 0x00, 0x04, 0x57, 0x14, 0x57, 0x14, 0x57, 0x24, 0x59, 0x24, 0x59, 0x34, 0x59,
+  0x34, 0x59, 0x44, 0x5b, 0x44, 0x59, 0x54, 0x5b, 0x54, 0x5b, 0x64, 0x5b, 0x64, 0x5b, 0x74, 0x5d,
+  0x64, 0x5b, 0x8c, 0x5d, 0x74, 0x5d, 0x8c, 0x5d, 0x8c, 0x5d, 0x9c, 0x5f, 0x9c, 0x5f, 0xac, 0x5f,
+  0xac, 0x5f, 0xbc, 0x5f, 0xbc, 0x5f, 0xcc, 0x5f, 0xcc, 0x5f, 0xdc, 0x5f, 0xdc, 0x40, 0xec, 0x42,
+  0xec, 0x40,
+  0x3c, 0xff, 0xfc, 0x42, 0x00, 0x04,  // RAMWRC 0xfc42 x 4
+  // RAMWRC 408 pixels
+  0x3c, 0xfe, 0x03, 0x30, 0xff, 0xff, 0x00, 0x00, 0x04, 0xd3, 0x14, 0x53, 0x14, 0xd3, 0x14, 0x53,
+  0x24, 0xd5, 0x24, 0x55, 0x34, 0xd5, 0x34, 0x55, 0x44, 0xd5, 0x44, 0x55, 0x54, 0xd7, 0x54, 0x57,
+  0x64, 0xd7, 0x64, 0x57, 0x74, 0xd9, 0x74, 0x57, 0x8c, 0xd9, 0x8c, 0x59, 0x9c, 0xd9, 0x8c, 0x59,
+  0x9c, 0xdb, 0x9c, 0x5b, 0xac, 0xdb, 0xac, 0x5b, 0xbc, 0xdb, 0xbc, 0x5b, 0xcc, 0xdd, 0xcc, 0x5d,
+  0xdc, 0xdd, 0xdc, 0x5d, 0xec, 0xdf, 0xec, 0x5d, 0xfc, 0xdf, 0xfc, 0x5f, 0xfc, 0xdf, 0xff, 0xff,
+  0x00, 0x00, 0x04, 0xce, 0x15, 0x51, 0x14, 0xce, 0x25, 0x51, 0x24, 0xd1, 0x35, 0x51, 0x34, 0xd1,
+  0x45, 0x53, 0x44, 0xd1, 0x55, 0x53, 0x54, 0xd3, 0x65, 0x53, 0x64, 0xd3, 0x75, 0x55, 0x74, 0xd5,
+  0x75, 0x55, 0x74, 0xd5, 0x8d, 0x57, 0x8c, 0xd5, 0x9d, 0x57, 0x9c, 0xd7, 0xad, 0x57, 0xac, 0xd7,
+  0xbd, 0x59, 0xbc, 0xd7, 0xcd, 0x59, 0xcc, 0xd9, 0xdd, 0x59, 0xdc, 0xd9, 0xed, 0x5b, 0xec, 0xdb,
+  0xed, 0x5b, 0xec, 0xdb, 0xfd, 0x5d, 0xfc, 0xdb, 0xff, 0xff, 0x00, 0x00, 0x15, 0x4a, 0x05, 0x4a,
+  0x15, 0x4c, 0x15, 0x4a, 0x25, 0x4c, 0x25, 0x4c, 0x35, 0x4c, 0x35, 0x4c, 0x45, 0x4e, 0x45, 0x4c,
+  0x55, 0x4e, 0x55, 0x4e, 0x65, 0x51, 0x65, 0x4e, 0x75, 0x51, 0x75, 0x51, 0x8d, 0x51, 0x8d, 0x51,
+  0x8d, 0x53, 0x9d, 0x51, 0x9d, 0x53, 0x9d, 0x53, 0xad, 0x53, 0xad, 0x53, 0xbd, 0x55, 0xbd, 0x53,
+  0xcd, 0x55, 0xcd, 0x55, 0xdd, 0x57, 0xdd, 0x55, 0xed, 0x57, 0xed, 0x57, 0xfd, 0x57, 0xfd, 0x57,
+  0xfd, 0x59, 0xff, 0xff, 0x00, 0x00, 0x05, 0xc6, 0x15, 0xc8, 0x15, 0xc6, 0x25, 0xc8, 0x25, 0xc8,
+  0x35, 0xc8, 0x35, 0xc8, 0x45, 0xca, 0x45, 0xca, 0x55, 0xca, 0x55, 0xca, 0x65, 0xcc, 0x65, 0xca,
+  0x75, 0xcc, 0x65, 0xcc, 0x8d, 0xcc, 0x75, 0xcc, 0x8d, 0xce, 0x8d, 0xcc, 0x9d, 0xce, 0x9d, 0xce,
+  0xad, 0xce, 0xad, 0xce, 0xbd, 0xd1, 0xbd, 0xd1, 0xcd, 0xd1, 0xcd, 0xd1, 0xdd, 0xd3, 0xdd, 0xd1,
+  0xed, 0xd3, 0xed, 0xd3, 0xfd, 0xd3, 0xfd, 0xd3, 0xfd, 0xd5, 0xfd, 0xd3, 0xff, 0xff, 0x00, 0x00,
+  0x06, 0x62, 0x15, 0xc2, 0x16, 0x64, 0x15, 0xc2, 0x26, 0x64, 0x25, 0xc4, 0x36, 0x64, 0x35, 0xc4,
+  0x46, 0x66, 0x45, 0xc6, 0x56, 0x66, 0x55, 0xc6, 0x66, 0x66, 0x65, 0xc6, 0x76, 0x68, 0x75, 0xc8,
+  0x8e, 0x68, 0x8d, 0xc8, 0x9e, 0x6a, 0x8d, 0xc8, 0x9e, 0x6a, 0x9d, 0xca, 0xae, 0x6a, 0xad, 0xca,
+  0xbe, 0x6c, 0xbd, 0xcc, 0xce, 0x6c, 0xcd, 0xcc, 0xde, 0x6c, 0xdd, 0xcc, 0xee, 0x6e, 0xed, 0xce,
+  0xfe, 0x6e, 0xfd, 0xce, 0xfe, 0x71, 0xff, 0xff, 0x00, 0x00, 0x06, 0x7f, 0x16, 0xff, 0x16, 0x7f,
+  0x26, 0xff, 0x26, 0x60, 0x36, 0xe2, 0x36, 0x60, 0x46, 0xe2, 0x46, 0x62, 0x56, 0xe2, 0x56, 0x62,
+  0x66, 0xe4, 0x66, 0x62, 0x76, 0xe4, 0x76, 0x64, 0x76, 0xe4, 0x76, 0x64, 0x8e, 0xe6, 0x8e, 0x66,
+  0x9e, 0xe6, 0x9e, 0x66, 0xae, 0xe8, 0xae, 0x66, 0xbe, 0xe8, 0xbe, 0x68, 0xce, 0xe8, 0xce, 0x68,
+  0xde, 0xea, 0xde, 0x68, 0xee, 0xea, 0xee, 0x6a, 0xee, 0xea, 0xee, 0x6a, 0xfe, 0xec, 0xfe, 0x6c,
+  0xff, 0xff, 0x00, 0x00, 0x16, 0xfd, 0x06, 0xfb, 0x16, 0xfd, 0x16, 0xfd, 0x26, 0xfd, 0x26, 0xfd,
+  0x36, 0xff, 0x36, 0xfd, 0x46, 0xff, 0x46, 0xff, 0x56, 0xff, 0x56, 0xff, 0x66, 0xff, 0x66, 0xff,
+  0x76, 0xff, 0x76, 0xe0, 0x8e, 0xe2, 0x8e, 0xe0, 0x8e, 0xe2, 0x9e, 0xe2, 0x9e, 0xe2, 0x9e, 0xe2,
+  0xae, 0xe4, 0xae, 0xe2, 0xbe, 0xe4, 0xbe, 0xe4, 0xce, 0xe4, 0xce, 0xe4, 0xde, 0xe6, 0xde, 0xe4,
+  0xee, 0xe6, 0xee, 0xe6, 0xfe, 0xe8, 0xfe, 0xe6, 0xfe, 0xe8, 0xff, 0xff, 0x00, 0x00, 0x07, 0x77,
+  0x17, 0x79, 0x17, 0x79, 0x27, 0x79, 0x27, 0x79, 0x37, 0x7b, 0x37, 0x79, 0x47, 0x7b, 0x47, 0x7b,
+  0x57, 0x7b, 0x57, 0x7b, 0x67, 0x7d, 0x67, 0x7d, 0x77, 0x7d, 0x67, 0x7d, 0x8f, 0x7f, 0x77, 0x7d,
+  0x8f, 0x7f, 0x8f, 0x7f, 0x9f, 0x7f, 0x9f, 0x7f, 0xaf, 0x7f, 0xaf, 0x7f, 0xbf, 0x7f, 0xbf, 0x7f,
+  0xcf, 0x60, 0xcf, 0x60, 0xdf, 0x62, 0xdf, 0x62, 0xef, 0x62, 0xef, 0x62, 0xff, 0x64, 0xff, 0x62,
+  0xff, 0x64, 0xff, 0x64, 0xff, 0xff, 0x00, 0x00, 0x07, 0x73, 0x17, 0x73, 0x17, 0xf5, 0x17, 0x75,
+  0x27, 0x75, 0x27, 0x75, 0x37, 0xf7, 0x37, 0x75, 0x47, 0x77, 0x47, 0x77, 0x57, 0xf7, 0x57, 0x77,
+  0x67, 0x79, 0x67, 0x79, 0x77, 0xf9, 0x77, 0x79, 0x8f, 0x79, 0x8f, 0x79, 0x9f, 0xfb, 0x8f, 0x7b,
+  0x9f, 0x7b, 0x9f, 0x7b, 0xaf, 0xfd, 0xaf, 0x7b, 0xbf, 0x7d, 0xbf, 0x7d, 0xcf, 0xfd, 0xcf, 0x7d,
+  0xdf, 0x7f, 0xdf, 0x7f, 0xef, 0xff, 0xef, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x07, 0xee, 0x17, 0xf1, 0x17, 0xf1, 0x27, 0xf1, 0x27, 0xf1, 0x37, 0xf3, 0x37, 0xf3,
+  0x47, 0xf3, 0x47, 0xf3, 0x57, 0xf5, 0x57, 0xf3, 0x67, 0xf5, 0x67, 0xf5, 0x77, 0xf5, 0x77, 0xf5,
+  0x77, 0xf7, 0x77, 0xf5, 0x8f, 0xf7, 0x8f, 0xf7, 0x9f, 0xf7, 0x9f, 0xf7, 0xaf, 0xf9, 0xaf, 0xf9,
+  0xbf, 0xf9, 0xbf, 0xf9, 0xcf, 0xfb, 0xcf, 0xf9, 0xdf, 0xfb, 0xdf, 0xfb, 0xef, 0xfb, 0xef, 0xfb,
+  0xef, 0xfd, 0xef, 0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x17, 0xec, 0x07, 0xea,
+  0x17, 0xec, 0x17, 0xec, 0x27, 0xee, 0x27, 0xec, 0x37, 0xee, 0x37, 0xee, 0x47, 0xee, 0x47, 0xee,
+  0x57, 0xf1, 0x57, 0xee, 0x67, 0xf1, 0x67, 0xf1, 0x77, 0xf1, 0x77, 0xf1, 0x8f, 0xf3, 0x8f, 0xf1,
+  0x8f, 0xf3, 0x9f, 0xf3, 0x9f, 0xf5, 0x9f, 0xf3, 0xaf, 0xf5, 0xaf, 0xf5, 0xbf, 0xf5, 0xbf, 0xf5,
+  0xcf, 0xf7, 0xcf, 0xf5, 0xdf, 0xf7, 0xdf, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xff, 0xf9, 0xff, 0xf7,
+  0xff, 0xf9, 0xff, 0xff,
+  0x00                                  // end
+};
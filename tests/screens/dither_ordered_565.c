@@ -0,0 +1,127 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       DITHER_ORDERED_565 command stream
+ * ---------------------------------------------------------------+ 
+ * @source      tests/screens/dither.scr
+ *
+ * @notes       generated by tools/scr2stream.py, do not edit
+ *              screen 240x280, RAM offset 0, 20
+ *              flash 1719 bytes, wire 1713 bytes (plain calls 1713 bytes)
+ * ---------------------------------------------------------------+
+ */
+#include "src/st7789.h"
+
+/** @array Command stream, ST7789_Stream_Play */
+const uint8_t DITHER_ORDERED_565[] PROGMEM = {
+  0x2a, 0x04, 0x00, 0x00, 0x00, 0x24,  // CASET 0..36
+  0x2b, 0x04, 0x00, 0x14, 0x00, 0x2a,  // RASET 0..22
+  // RAMWR 851 pixels
+  0x2c, 0xfe, 0x06, 0xa6, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x18, 0x01, 0x18, 0x01, 0x20, 0x02,
+  0x28, 0x02, 0x30, 0x03, 0x38, 0x03, 0x40, 0x03, 0x40, 0x03, 0x50, 0x04, 0x50, 0x04, 0x60, 0x05,
+  0x60, 0x05, 0x68, 0x06, 0x70, 0x06, 0x78, 0x06, 0x80, 0x06, 0x88, 0x07, 0x88, 0x07, 0x98, 0x08,
+  0x98, 0x08, 0xa0, 0x09, 0xa8, 0x09, 0xb0, 0x09, 0xb8, 0x09, 0xc0, 0x0a, 0xc0, 0x0a, 0xd0, 0x0b,
+  0xd0, 0x0b, 0xe0, 0x0c, 0xe0, 0x0c, 0xe8, 0x0c, 0xf0, 0x0c, 0xf8, 0x0d, 0xff, 0xff, 0x00, 0x00,
+  0x08, 0x7c, 0x10, 0x7d, 0x18, 0x7d, 0x20, 0x7e, 0x20, 0x7e, 0x30, 0x7f, 0x30, 0x7f, 0x38, 0x7f,
+  0x40, 0x7f, 0x48, 0x7f, 0x50, 0x60, 0x58, 0x61, 0x58, 0x61, 0x68, 0x62, 0x68, 0x62, 0x70, 0x62,
+  0x78, 0x62, 0x80, 0x63, 0x88, 0x63, 0x90, 0x64, 0x90, 0x64, 0xa0, 0x65, 0xa0, 0x65, 0xb0, 0x65,
+  0xb0, 0x65, 0xb8, 0x66, 0xc0, 0x66, 0xc8, 0x67, 0xc8, 0x67, 0xd8, 0x68, 0xd8, 0x68, 0xe8, 0x68,
+  0xe8, 0x68, 0xf0, 0x69, 0xf8, 0x69, 0xff, 0xff, 0x00, 0x00, 0x08, 0xd9, 0x08, 0xb9, 0x18, 0xd9,
+  0x18, 0xb9, 0x28, 0xda, 0x28, 0xba, 0x30, 0xdb, 0x38, 0xbb, 0x40, 0xdc, 0x40, 0xbc, 0x50, 0xdc,
+  0x50, 0xbc, 0x60, 0xdd, 0x60, 0xbd, 0x68, 0xde, 0x70, 0xbe, 0x78, 0xdf, 0x78, 0xbf, 0x88, 0xdf,
+  0x88, 0xbf, 0x98, 0xc0, 0x98, 0xa0, 0xa0, 0xc1, 0xa8, 0xa1, 0xb0, 0xc2, 0xb8, 0xa2, 0xc0, 0xc2,
+  0xc0, 0xa2, 0xd0, 0xc3, 0xd0, 0xa3, 0xd8, 0xc4, 0xe0, 0xa4, 0xe8, 0xc5, 0xf0, 0xa5, 0xf8, 0xc5,
+  0xff, 0xff, 0x00, 0x00, 0x09, 0x15, 0x11, 0x35, 0x11, 0x15, 0x21, 0x36, 0x21, 0x16, 0x31, 0x37,
+  0x31, 0x17, 0x39, 0x38, 0x41, 0x18, 0x49, 0x38, 0x49, 0x18, 0x59, 0x39, 0x59, 0x19, 0x69, 0x3a,
+  0x69, 0x1a, 0x79, 0x3b, 0x79, 0x1b, 0x81, 0x3b, 0x89, 0x1b, 0x91, 0x3c, 0x91, 0x1c, 0xa1, 0x3d,
+  0xa1, 0x1d, 0xb1, 0x3e, 0xb1, 0x1e, 0xb9, 0x3e, 0xc1, 0x1e, 0xc9, 0x3f, 0xd1, 0x1f, 0xd9, 0x3f,
+  0xd9, 0x00, 0xe9, 0x21, 0xe9, 0x01, 0xf1, 0x21, 0xf9, 0x01, 0xff, 0xff, 0x00, 0x00, 0x09, 0x91,
+  0x09, 0x71, 0x19, 0x92, 0x19, 0x72, 0x21, 0x92, 0x29, 0x72, 0x31, 0x93, 0x39, 0x73, 0x41, 0x94,
+  0x41, 0x74, 0x51, 0x95, 0x51, 0x75, 0x61, 0x95, 0x61, 0x75, 0x69, 0x96, 0x71, 0x76, 0x79, 0x97,
+  0x81, 0x77, 0x89, 0x98, 0x89, 0x78, 0x99, 0x98, 0x99, 0x78, 0xa1, 0x99, 0xa9, 0x79, 0xb1, 0x9a,
+  0xb9, 0x7a, 0xc1, 0x9b, 0xc1, 0x7b, 0xd1, 0x9b, 0xd1, 0x7b, 0xe1, 0x9c, 0xe1, 0x7c, 0xe9, 0x9d,
+  0xf1, 0x7d, 0xf9, 0x9e, 0xff, 0xff, 0x00, 0x00, 0x09, 0xcd, 0x11, 0xee, 0x19, 0xce, 0x21, 0xee,
+  0x21, 0xce, 0x31, 0xef, 0x31, 0xcf, 0x39, 0xf0, 0x41, 0xd0, 0x49, 0xf1, 0x51, 0xd1, 0x59, 0xf1,
+  0x59, 0xd1, 0x69, 0xf2, 0x69, 0xd2, 0x71, 0xf3, 0x79, 0xd3, 0x81, 0xf4, 0x89, 0xd4, 0x91, 0xf4,
+  0x91, 0xd4, 0xa1, 0xf5, 0xa1, 0xd5, 0xb1, 0xf6, 0xb1, 0xd6, 0xb9, 0xf7, 0xc1, 0xd7, 0xc9, 0xf7,
+  0xc9, 0xd7, 0xd9, 0xf8, 0xd9, 0xd8, 0xe9, 0xf9, 0xe9, 0xd9, 0xf1, 0xfa, 0xf9, 0xda, 0xff, 0xff,
+  0x00, 0x00, 0x0a, 0x29, 0x0a, 0x29, 0x1a, 0x2a, 0x1a, 0x2a, 0x2a, 0x2b, 0x2a, 0x2b, 0x32, 0x2b,
+  0x3a, 0x2b, 0x42, 0x2c, 0x42, 0x2c, 0x52, 0x2d, 0x52, 0x2d, 0x62, 0x2e, 0x62, 0x2e, 0x6a, 0x2e,
+  0x72, 0x2e, 0x7a, 0x2f, 0x7a, 0x2f, 0x8a, 0x30, 0x8a, 0x30, 0x9a, 0x31, 0x9a, 0x31, 0xa2, 0x31,
+  0xaa, 0x31, 0xb2, 0x32, 0xba, 0x32, 0xc2, 0x33, 0xc2, 0x33, 0xd2, 0x34, 0xd2, 0x34, 0xda, 0x34,
+  0xe2, 0x34, 0xea, 0x35, 0xf2, 0x35, 0xfa, 0x36, 0xff, 0xff, 0x00, 0x00, 0x0a, 0x85, 0x12, 0xa6,
+  0x12, 0x86, 0x22, 0xa7, 0x22, 0x87, 0x32, 0xa7, 0x32, 0x87, 0x3a, 0xa8, 0x42, 0x88, 0x4a, 0xa9,
+  0x4a, 0x89, 0x5a, 0xaa, 0x5a, 0x8a, 0x6a, 0xaa, 0x6a, 0x8a, 0x7a, 0xab, 0x7a, 0x8b, 0x82, 0xac,
+  0x8a, 0x8c, 0x92, 0xad, 0x92, 0x8d, 0xa2, 0xad, 0xa2, 0x8d, 0xb2, 0xae, 0xb2, 0x8e, 0xba, 0xaf,
+  0xc2, 0x8f, 0xca, 0xb0, 0xd2, 0x90, 0xda, 0xb0, 0xda, 0x90, 0xea, 0xb1, 0xea, 0x91, 0xf2, 0xb2,
+  0xfa, 0x92, 0xff, 0xff, 0x00, 0x00, 0x0a, 0xe1, 0x0a, 0xe1, 0x1a, 0xe2, 0x1a, 0xe2, 0x22, 0xe3,
+  0x2a, 0xe3, 0x32, 0xe4, 0x3a, 0xe4, 0x42, 0xe4, 0x42, 0xe4, 0x52, 0xe5, 0x52, 0xe5, 0x62, 0xe6,
+  0x62, 0xe6, 0x6a, 0xe7, 0x72, 0xe7, 0x7a, 0xe7, 0x82, 0xe7, 0x8a, 0xe8, 0x8a, 0xe8, 0x9a, 0xe9,
+  0x9a, 0xe9, 0xa2, 0xea, 0xaa, 0xea, 0xb2, 0xea, 0xba, 0xea, 0xc2, 0xeb, 0xc2, 0xeb, 0xd2, 0xec,
+  0xd2, 0xec, 0xe2, 0xed, 0xe2, 0xed, 0xea, 0xed, 0xf2, 0xed, 0xfa, 0xee, 0xff, 0xff, 0x00, 0x00,
+  0x0b, 0x5d, 0x13, 0x5e, 0x1b, 0x5e, 0x23, 0x5f, 0x23, 0x5f, 0x33, 0x5f, 0x33, 0x5f, 0x3b, 0x40,
+  0x43, 0x40, 0x4b, 0x41, 0x53, 0x41, 0x5b, 0x42, 0x5b, 0x42, 0x6b, 0x43, 0x6b, 0x43, 0x73, 0x43,
+  0x7b, 0x43, 0x83, 0x44, 0x8b, 0x44, 0x93, 0x45, 0x93, 0x45, 0xa3, 0x46, 0xa3, 0x46, 0xb3, 0x46,
+  0xb3, 0x46, 0xbb, 0x47, 0xc3, 0x47, 0xcb, 0x48, 0xcb, 0x48, 0xdb, 0x49, 0xdb, 0x49, 0xeb, 0x49,
+  0xeb, 0x49, 0xf3, 0x4a, 0xfb, 0x4a, 0xff, 0xff, 0x00, 0x00, 0x0b, 0xba, 0x0b, 0x9a, 0x1b, 0xba,
+  0x1b, 0x9a, 0x2b, 0xbb, 0x2b, 0x9b, 0x33, 0xbc, 0x3b, 0x9c, 0x43, 0xbd, 0x43, 0x9d, 0x53, 0xbd,
+  0x53, 0x9d, 0x63, 0xbe, 0x63, 0x9e, 0x6b, 0xbf, 0x73, 0x9f, 0x7b, 0xbf, 0x7b, 0x80, 0x8b, 0xa0,
+  0x8b, 0x80, 0x9b, 0xa1, 0x9b, 0x81, 0xa3, 0xa2, 0xab, 0x82, 0xb3, 0xa3, 0xbb, 0x83, 0xc3, 0xa3,
+  0xc3, 0x83, 0xd3, 0xa4, 0xd3, 0x84, 0xdb, 0xa5, 0xe3, 0x85, 0xeb, 0xa6, 0xf3, 0x86, 0xfb, 0xa6,
+  0xff, 0xff, 0x00, 0x00, 0x0c, 0x16, 0x14, 0x16, 0x14, 0x16, 0x24, 0x17, 0x24, 0x17, 0x34, 0x18,
+  0x34, 0x18, 0x3c, 0x19, 0x44, 0x19, 0x4c, 0x19, 0x4c, 0x19, 0x5c, 0x1a, 0x5c, 0x1a, 0x6c, 0x1b,
+  0x6c, 0x1b, 0x7c, 0x1c, 0x7c, 0x1c, 0x84, 0x1c, 0x8c, 0x1c, 0x94, 0x1d, 0x94, 0x1d, 0xa4, 0x1e,
+  0xa4, 0x1e, 0xb4, 0x1f, 0xb4, 0x1f, 0xbc, 0x1f, 0xc4, 0x1f, 0xcc, 0x1f, 0xd4, 0x00, 0xdc, 0x01,
+  0xdc, 0x01, 0xec, 0x02, 0xec, 0x02, 0xf4, 0x02, 0xfc, 0x02, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x72,
+  0x0c, 0x52, 0x1c, 0x73, 0x1c, 0x53, 0x24, 0x73, 0x2c, 0x53, 0x34, 0x74, 0x3c, 0x54, 0x44, 0x75,
+  0x44, 0x55, 0x54, 0x76, 0x54, 0x56, 0x64, 0x76, 0x64, 0x56, 0x6c, 0x77, 0x74, 0x57, 0x7c, 0x78,
+  0x84, 0x58, 0x8c, 0x79, 0x8c, 0x59, 0x9c, 0x79, 0x9c, 0x59, 0xa4, 0x7a, 0xac, 0x5a, 0xb4, 0x7b,
+  0xbc, 0x5b, 0xc4, 0x7c, 0xc4, 0x5c, 0xd4, 0x7c, 0xd4, 0x5c, 0xe4, 0x7d, 0xe4, 0x5d, 0xec, 0x7e,
+  0xf4, 0x5e, 0xfc, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x0c, 0xae, 0x14, 0xcf, 0x1c, 0xaf, 0x24, 0xcf,
+  0x24, 0xaf, 0x34, 0xd0, 0x34, 0xb0, 0x3c, 0xd1, 0x44, 0xb1, 0x4c, 0xd2, 0x54, 0xb2, 0x5c, 0xd2,
+  0x5c, 0xb2, 0x6c, 0xd3, 0x6c, 0xb3, 0x74, 0xd4, 0x7c, 0xb4, 0x84, 0xd5, 0x8c, 0xb5, 0x94, 0xd5,
+  0x94, 0xb5, 0xa4, 0xd6, 0xa4, 0xb6, 0xb4, 0xd7, 0xb4, 0xb7, 0xbc, 0xd8, 0xc4, 0xb8, 0xcc, 0xd8,
+  0xcc, 0xb8, 0xdc, 0xd9, 0xdc, 0xb9, 0xec, 0xda, 0xec, 0xba, 0xf4, 0xdb, 0xfc, 0xbb, 0xff, 0xff,
+  0x00, 0x00, 0x0d, 0x2a, 0x0d, 0x0a, 0x1d, 0x2b, 0x1d, 0x0b, 0x2d, 0x2c, 0x2d, 0x0c, 0x35, 0x2c,
+  0x3d, 0x0c, 0x45, 0x2d, 0x45, 0x0d, 0x55, 0x2e, 0x55, 0x0e, 0x65, 0x2f, 0x65, 0x0f, 0x6d, 0x2f,
+  0x75, 0x0f, 0x7d, 0x30, 0x7d, 0x10, 0x8d, 0x31, 0x8d, 0x11, 0x9d, 0x32, 0x9d, 0x12, 0xa5, 0x32,
+  0xad, 0x12, 0xb5, 0x33, 0xbd, 0x13, 0xc5, 0x34, 0xc5, 0x14, 0xd5, 0x35, 0xd5, 0x15, 0xdd, 0x35,
+  0xe5, 0x15, 0xed, 0x36, 0xf5, 0x16, 0xfd, 0x37, 0xff, 0xff, 0x00, 0x00, 0x0d, 0x66, 0x15, 0x87,
+  0x15, 0x67, 0x25, 0x88, 0x25, 0x68, 0x35, 0x88, 0x35, 0x68, 0x3d, 0x89, 0x45, 0x69, 0x4d, 0x8a,
+  0x4d, 0x6a, 0x5d, 0x8b, 0x5d, 0x6b, 0x6d, 0x8b, 0x6d, 0x6b, 0x7d, 0x8c, 0x7d, 0x6c, 0x85, 0x8d,
+  0x8d, 0x6d, 0x95, 0x8e, 0x95, 0x6e, 0xa5, 0x8e, 0xa5, 0x6e, 0xb5, 0x8f, 0xb5, 0x6f, 0xbd, 0x90,
+  0xc5, 0x70, 0xcd, 0x91, 0xd5, 0x71, 0xdd, 0x91, 0xdd, 0x71, 0xed, 0x92, 0xed, 0x72, 0xf5, 0x93,
+  0xfd, 0x73, 0xff, 0xff, 0x00, 0x00, 0x0d, 0xc2, 0x0d, 0xc2, 0x1d, 0xc3, 0x1d, 0xc3, 0x25, 0xc4,
+  0x2d, 0xc4, 0x35, 0xc5, 0x3d, 0xc5, 0x45, 0xc5, 0x45, 0xc5, 0x55, 0xc6, 0x55, 0xc6, 0x65, 0xc7,
+  0x65, 0xc7, 0x6d, 0xc8, 0x75, 0xc8, 0x7d, 0xc8, 0x85, 0xc8, 0x8d, 0xc9, 0x8d, 0xc9, 0x9d, 0xca,
+  0x9d, 0xca, 0xa5, 0xcb, 0xad, 0xcb, 0xb5, 0xcb, 0xbd, 0xcb, 0xc5, 0xcc, 0xc5, 0xcc, 0xd5, 0xcd,
+  0xd5, 0xcd, 0xe5, 0xce, 0xe5, 0xce, 0xed, 0xce, 0xf5, 0xce, 0xfd, 0xcf, 0xff, 0xff, 0x00, 0x00,
+  0x0e, 0x3e, 0x16, 0x5f, 0x1e, 0x3f, 0x26, 0x5f, 0x26, 0x20, 0x36, 0x41, 0x36, 0x21, 0x3e, 0x41,
+  0x46, 0x21, 0x4e, 0x42, 0x56, 0x22, 0x5e, 0x43, 0x5e, 0x23, 0x6e, 0x44, 0x6e, 0x24, 0x76, 0x44,
+  0x7e, 0x24, 0x86, 0x45, 0x8e, 0x25, 0x96, 0x46, 0x96, 0x26, 0xa6, 0x47, 0xa6, 0x27, 0xb6, 0x47,
+  0xb6, 0x27, 0xbe, 0x48, 0xc6, 0x28, 0xce, 0x49, 0xce, 0x29, 0xde, 0x4a, 0xde, 0x2a, 0xee, 0x4a,
+  0xee, 0x2a, 0xf6, 0x4b, 0xfe, 0x2b, 0xff, 0xff, 0x00, 0x00, 0x0e, 0x9b, 0x0e, 0x9b, 0x1e, 0x9b,
+  0x1e, 0x9b, 0x2e, 0x9c, 0x2e, 0x9c, 0x36, 0x9d, 0x3e, 0x9d, 0x46, 0x9e, 0x46, 0x9e, 0x56, 0x9e,
+  0x56, 0x9e, 0x66, 0x9f, 0x66, 0x9f, 0x6e, 0x9f, 0x76, 0x80, 0x7e, 0x81, 0x7e, 0x81, 0x8e, 0x81,
+  0x8e, 0x81, 0x9e, 0x82, 0x9e, 0x82, 0xa6, 0x83, 0xae, 0x83, 0xb6, 0x84, 0xbe, 0x84, 0xc6, 0x84,
+  0xc6, 0x84, 0xd6, 0x85, 0xd6, 0x85, 0xde, 0x86, 0xe6, 0x86, 0xee, 0x87, 0xf6, 0x87, 0xfe, 0x87,
+  0xff, 0xff, 0x00, 0x00, 0x0e, 0xf7, 0x16, 0xf7, 0x16, 0xf7, 0x26, 0xf8, 0x26, 0xf8, 0x36, 0xf9,
+  0x36, 0xf9, 0x3e, 0xfa, 0x46, 0xfa, 0x4e, 0xfa, 0x4e, 0xfa, 0x5e, 0xfb, 0x5e, 0xfb, 0x6e, 0xfc,
+  0x6e, 0xfc, 0x7e, 0xfd, 0x7e, 0xfd, 0x86, 0xfd, 0x8e, 0xfd, 0x96, 0xfe, 0x96, 0xfe, 0xa6, 0xff,
+  0xa6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xbe, 0xe0, 0xc6, 0xe0, 0xce, 0xe1, 0xd6, 0xe1, 0xde, 0xe2,
+  0xde, 0xe2, 0xee, 0xe3, 0xee, 0xe3, 0xf6, 0xe3, 0xfe, 0xe3, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x53,
+  0x0f, 0x33, 0x1f, 0x54, 0x1f, 0x34, 0x27, 0x54, 0x2f, 0x34, 0x37, 0x55, 0x3f, 0x35, 0x47, 0x56,
+  0x47, 0x36, 0x57, 0x57, 0x57, 0x37, 0x67, 0x57, 0x67, 0x37, 0x6f, 0x58, 0x77, 0x38, 0x7f, 0x59,
+  0x87, 0x39, 0x8f, 0x5a, 0x8f, 0x3a, 0x9f, 0x5a, 0x9f, 0x3a, 0xa7, 0x5b, 0xaf, 0x3b, 0xb7, 0x5c,
+  0xbf, 0x3c, 0xc7, 0x5d, 0xc7, 0x3d, 0xd7, 0x5d, 0xd7, 0x3d, 0xe7, 0x5e, 0xe7, 0x3e, 0xef, 0x5f,
+  0xf7, 0x3f, 0xff, 0x5f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xaf, 0x17, 0xb0, 0x1f, 0xb0, 0x27, 0xb0,
+  0x27, 0xb0, 0x37, 0xb1, 0x37, 0xb1, 0x3f, 0xb2, 0x47, 0xb2, 0x4f, 0xb3, 0x57, 0xb3, 0x5f, 0xb3,
+  0x5f, 0xb3, 0x6f, 0xb4, 0x6f, 0xb4, 0x77, 0xb5, 0x7f, 0xb5, 0x87, 0xb6, 0x8f, 0xb6, 0x97, 0xb6,
+  0x97, 0xb6, 0xa7, 0xb7, 0xa7, 0xb7, 0xb7, 0xb8, 0xb7, 0xb8, 0xbf, 0xb9, 0xc7, 0xb9, 0xcf, 0xb9,
+  0xcf, 0xb9, 0xdf, 0xba, 0xdf, 0xba, 0xef, 0xbb, 0xef, 0xbb, 0xf7, 0xbc, 0xff, 0xbc, 0xff, 0xff,
+  0x00, 0x00, 0x0f, 0xeb, 0x0f, 0xeb, 0x1f, 0xec, 0x1f, 0xec, 0x2f, 0xed, 0x2f, 0xed, 0x37, 0xed,
+  0x3f, 0xed, 0x47, 0xee, 0x47, 0xee, 0x57, 0xef, 0x57, 0xef, 0x67, 0xf0, 0x67, 0xf0, 0x6f, 0xf0,
+  0x77, 0xf0, 0x7f, 0xf1, 0x7f, 0xf1, 0x8f, 0xf2, 0x8f, 0xf2, 0x9f, 0xf3, 0x9f, 0xf3, 0xa7, 0xf3,
+  0xaf, 0xf3, 0xb7, 0xf4, 0xbf, 0xf4, 0xc7, 0xf5, 0xc7, 0xf5, 0xd7, 0xf6, 0xd7, 0xf6, 0xdf, 0xf6,
+  0xe7, 0xf6, 0xef, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xff, 0xff,
+  0x00                                  // end
+};
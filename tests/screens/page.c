@@ -0,0 +1,1866 @@
+/** 
+ * ---------------------------------------------------------------+ 
+ * @brief       PAGE_MAIN command stream
+ * ---------------------------------------------------------------+ 
+ * @source      tests/screens/page.scr
+ *
+ * @notes       generated by tools/scr2stream.py, do not edit
+ *              screen 240x280, RAM offset 0, 20
+ *              flash 11077 bytes, wire 136177 bytes (plain calls 245542 bytes)
+ * ---------------------------------------------------------------+
+ */
+#include "src/st7789.h"
+
+/** @array Command stream, ST7789_Stream_Play */
+const uint8_t PAGE_MAIN[] PROGMEM = {
+  0x2a, 0x04, 0x00, 0x00, 0x00, 0xef,  // CASET 0..239
+  0x2b, 0x04, 0x00, 0x14, 0x01, 0x2b,  // RASET 0..279
+  0x2c, 0xff, 0x00, 0x1f, 0x07, 0x8a,  // RAMWR 0x001f x 1930
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x08,  // RAMWRC 0xffff x 8
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0xe1,  // RAMWRC 0x001f x 225
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0xe0,  // RAMWRC 0x001f x 224
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0b,  // RAMWRC 0x001f x 11
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x58,  // RAMWRC 0x001f x 88
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x81,  // RAMWRC 0x001f x 129
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0b,  // RAMWRC 0x001f x 11
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x56,  // RAMWRC 0x001f x 86
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x80,  // RAMWRC 0x001f x 128
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x08, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0b,  // RAMWRC 0x001f x 11
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x76,  // RAMWRC 0x001f x 118
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x09,  // RAMWRC 0x001f x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x08, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x08,  // RAMWRC 0xffff x 8
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0x06, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0x0a, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x09,  // RAMWRC 0x001f x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0x0a, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x08,  // RAMWRC 0xffff x 8
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x76,  // RAMWRC 0x001f x 118
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x07,  // RAMWRC 0x001f x 7
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  // RAMWRC 9 pixels
+  0x3c, 0x12, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f,
+  0xff, 0xff, 0xff, 0xff,
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  // RAMWRC 14 pixels
+  0x3c, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x76,  // RAMWRC 0x001f x 118
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  // RAMWRC 14 pixels
+  0x3c, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f,
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x7b,  // RAMWRC 0x001f x 123
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x09,  // RAMWRC 0x001f x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x08,  // RAMWRC 0xffff x 8
+  // RAMWRC 12 pixels
+  0x3c, 0x18, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x08,  // RAMWRC 0xffff x 8
+  0x3c, 0x06, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0x04, 0x00, 0x1f, 0x00, 0x1f,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x7c,  // RAMWRC 0x001f x 124
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  // RAMWRC 12 pixels
+  0x3c, 0x18, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x08,  // RAMWRC 0xffff x 8
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x08,  // RAMWRC 0xffff x 8
+  0x3c, 0x04, 0x00, 0x1f, 0x00, 0x1f,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x7d,  // RAMWRC 0x001f x 125
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x09,  // RAMWRC 0x001f x 9
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x83,  // RAMWRC 0x001f x 131
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  // RAMWRC 12 pixels
+  0x3c, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0a,  // RAMWRC 0x001f x 10
+  0x3c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x7c,  // RAMWRC 0x001f x 124
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0x0a, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0b,  // RAMWRC 0x001f x 11
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0x08, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0b,  // RAMWRC 0x001f x 11
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x76,  // RAMWRC 0x001f x 118
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x08,  // RAMWRC 0xffff x 8
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x04,  // RAMWRC 0x001f x 4
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0c,  // RAMWRC 0x001f x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0x0a, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x08,  // RAMWRC 0x001f x 8
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x0c,  // RAMWRC 0x001f x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x07,  // RAMWRC 0xffff x 7
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x05,  // RAMWRC 0x001f x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x00, 0x06,  // RAMWRC 0x001f x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x00, 0x1f, 0x09, 0xce,  // RAMWRC 0x001f x 2510
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0xf0,  // RAMWRC 0xffff x 240
+  0x3c, 0xff, 0x00, 0x00, 0x0a, 0x5a,  // RAMWRC 0x0000 x 2650
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0xdc,  // RAMWRC 0x07e0 x 220
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0f,  // RAMWRC 0xffff x 15
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0e,  // RAMWRC 0x2104 x 14
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0d,  // RAMWRC 0xffff x 13
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0f,  // RAMWRC 0xffff x 15
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0d,  // RAMWRC 0x2104 x 13
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0e,  // RAMWRC 0xffff x 14
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0b,  // RAMWRC 0x2104 x 11
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0b,  // RAMWRC 0xffff x 11
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0f,  // RAMWRC 0xffff x 15
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0f,  // RAMWRC 0xffff x 15
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0e,  // RAMWRC 0x2104 x 14
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0b,  // RAMWRC 0xffff x 11
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7c,  // RAMWRC 0x2104 x 124
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0e,  // RAMWRC 0x2104 x 14
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x18,  // RAMWRC 0x2104 x 24
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7a,  // RAMWRC 0x2104 x 122
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x18,  // RAMWRC 0x2104 x 24
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7a,  // RAMWRC 0x2104 x 122
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x18,  // RAMWRC 0x2104 x 24
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7a,  // RAMWRC 0x2104 x 122
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x15,  // RAMWRC 0x2104 x 21
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x12,  // RAMWRC 0x2104 x 18
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0c,  // RAMWRC 0xffff x 12
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x14,  // RAMWRC 0x2104 x 20
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x13,  // RAMWRC 0x2104 x 19
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0b,  // RAMWRC 0xffff x 11
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x14,  // RAMWRC 0x2104 x 20
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x14,  // RAMWRC 0x2104 x 20
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0b,  // RAMWRC 0xffff x 11
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0e,  // RAMWRC 0x2104 x 14
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x12,  // RAMWRC 0x2104 x 18
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0d,  // RAMWRC 0x2104 x 13
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x19,  // RAMWRC 0x2104 x 25
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x12,  // RAMWRC 0x2104 x 18
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x1a,  // RAMWRC 0x2104 x 26
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x11,  // RAMWRC 0x2104 x 17
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x1a,  // RAMWRC 0x2104 x 26
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x13,  // RAMWRC 0x2104 x 19
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x18,  // RAMWRC 0x2104 x 24
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0f,  // RAMWRC 0x2104 x 15
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x14,  // RAMWRC 0x2104 x 20
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x18,  // RAMWRC 0x2104 x 24
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0e,  // RAMWRC 0x2104 x 14
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x15,  // RAMWRC 0x2104 x 21
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x18,  // RAMWRC 0x2104 x 24
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x86,  // RAMWRC 0x2104 x 134
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7a,  // RAMWRC 0x2104 x 122
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7a,  // RAMWRC 0x2104 x 122
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0b,  // RAMWRC 0x2104 x 11
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0x06, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0x06, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x05,  // RAMWRC 0xffff x 5
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7a,  // RAMWRC 0x2104 x 122
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0f,  // RAMWRC 0xffff x 15
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0b,  // RAMWRC 0xffff x 11
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x06,  // RAMWRC 0xffff x 6
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0b,  // RAMWRC 0xffff x 11
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x10,  // RAMWRC 0x2104 x 16
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0b,  // RAMWRC 0xffff x 11
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7c,  // RAMWRC 0x2104 x 124
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0f,  // RAMWRC 0xffff x 15
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x07,  // RAMWRC 0x2104 x 7
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x04,  // RAMWRC 0xffff x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x07,  // RAMWRC 0x2104 x 7
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x12,  // RAMWRC 0x2104 x 18
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0f,  // RAMWRC 0xffff x 15
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0x04, 0xff, 0xff, 0xff, 0xff,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x12,  // RAMWRC 0x2104 x 18
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x09,  // RAMWRC 0xffff x 9
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x15,  // RAMWRC 0x2104 x 21
+  0x3c, 0x08, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x33,  // RAMWRC 0x2104 x 51
+  0x3c, 0x06, 0x68, 0xa2, 0xa8, 0x41, 0xa8, 0x41,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x04,  // RAMWRC 0xf800 x 4
+  0x3c, 0x04, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7e,  // RAMWRC 0x2104 x 126
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x15,  // RAMWRC 0x2104 x 21
+  0x3c, 0x08, 0xa8, 0x41, 0xf8, 0x00, 0xf8, 0x00, 0xa8, 0x41,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x32,  // RAMWRC 0x2104 x 50
+  0x3c, 0x08, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x06,  // RAMWRC 0xf800 x 6
+  0x3c, 0x04, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x15,  // RAMWRC 0x2104 x 21
+  0x3c, 0x08, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x31,  // RAMWRC 0x2104 x 49
+  0x3c, 0x0a, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  // RAMWRC 10 pixels
+  0x3c, 0x14, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0x68, 0xa2,
+  0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x16,  // RAMWRC 0x2104 x 22
+  0x3c, 0x06, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x30,  // RAMWRC 0x2104 x 48
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x04,  // RAMWRC 0xf800 x 4
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x06, 0xa8, 0x41, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x06, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0b,  // RAMWRC 0x2104 x 11
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x04,  // RAMWRC 0xf800 x 4
+  0x3c, 0x04, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x04,  // RAMWRC 0xf800 x 4
+  // RAMWRC 26 pixels
+  0x3c, 0x34, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0xa8, 0x41, 0xa8, 0x41,
+  0x21, 0x04, 0x21, 0x04, 0xa8, 0x41, 0xf8, 0x00, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04,
+  0x21, 0x04, 0x21, 0x04, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x21, 0x04, 0x21, 0x04,
+  0xa8, 0x41, 0xa8, 0x41, 0x68, 0xa2,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0a,  // RAMWRC 0x2104 x 10
+  0x3c, 0x0e, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0x68, 0xa2, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0b,  // RAMWRC 0x2104 x 11
+  0x3c, 0x06, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0b,  // RAMWRC 0x2104 x 11
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x05,  // RAMWRC 0xf800 x 5
+  0x3c, 0x04, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x05,  // RAMWRC 0xf800 x 5
+  // RAMWRC 8 pixels
+  0x3c, 0x10, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00, 0x68, 0xa2,
+  0x68, 0xa2,
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x04,  // RAMWRC 0xf800 x 4
+  // RAMWRC 14 pixels
+  0x3c, 0x1c, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0xa8, 0x41, 0xf8, 0x00, 0xf8, 0x00,
+  0xa8, 0x41, 0x68, 0xa2, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  // RAMWRC 8 pixels
+  0x3c, 0x10, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00,
+  0xf8, 0x00,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0a,  // RAMWRC 0x2104 x 10
+  0x3c, 0x08, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x10,  // RAMWRC 0x2104 x 16
+  0x3c, 0x06, 0x68, 0xa2, 0xf8, 0x00, 0xa8, 0x41,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0b,  // RAMWRC 0x2104 x 11
+  0x3c, 0x0a, 0x68, 0xa2, 0xf8, 0x00, 0xa8, 0x41, 0x21, 0x04, 0x21, 0x04,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x04,  // RAMWRC 0xf800 x 4
+  // RAMWRC 18 pixels
+  0x3c, 0x24, 0xa8, 0x41, 0x68, 0xa2, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x21, 0x04,
+  0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00, 0x68, 0xa2, 0x68, 0xa2, 0xa8, 0x41, 0xa8, 0x41, 0x68, 0xa2,
+  0x68, 0xa2, 0xf8, 0x00, 0xa8, 0x41,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  // RAMWRC 9 pixels
+  0x3c, 0x12, 0xa8, 0x41, 0xf8, 0x00, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0x68, 0xa2, 0xf8, 0x00,
+  0xf8, 0x00, 0x68, 0xa2,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0x0a, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x10,  // RAMWRC 0x2104 x 16
+  0x3c, 0x06, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0b,  // RAMWRC 0x2104 x 11
+  // RAMWRC 27 pixels
+  0x3c, 0x36, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00,
+  0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0x68, 0xa2, 0xa8, 0x41, 0xa8, 0x41,
+  0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00,
+  0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  // RAMWRC 10 pixels
+  0x3c, 0x14, 0xf8, 0x00, 0xf8, 0x00, 0x68, 0xa2, 0x21, 0x04, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00,
+  0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0x0a, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7e,  // RAMWRC 0x2104 x 126
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0a,  // RAMWRC 0x2104 x 10
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x07,  // RAMWRC 0xf800 x 7
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x07,  // RAMWRC 0xf800 x 7
+  0x3c, 0x0c, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  // RAMWRC 10 pixels
+  0x3c, 0x14, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04,
+  0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x08,  // RAMWRC 0xf800 x 8
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x05,  // RAMWRC 0x2104 x 5
+  0x3c, 0x0a, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7f,  // RAMWRC 0x2104 x 127
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x08,  // RAMWRC 0xf800 x 8
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x08,  // RAMWRC 0xf800 x 8
+  0x3c, 0x0a, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00, 0x68, 0xa2,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  // RAMWRC 10 pixels
+  0x3c, 0x14, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04, 0x21, 0x04, 0xa8, 0x41, 0xa8, 0x41, 0x21, 0x04,
+  0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x08,  // RAMWRC 0x2104 x 8
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x07,  // RAMWRC 0xf800 x 7
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x0a, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x80,  // RAMWRC 0x2104 x 128
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xa8, 0x41, 0xf8, 0x00, 0x68, 0xa2,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  // RAMWRC 16 pixels
+  0x3c, 0x20, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x68, 0xa2,
+  0xf8, 0x00, 0xf8, 0x00, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0xa8, 0x41, 0xf8, 0x00,
+  0x68, 0xa2,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x0e, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0a,  // RAMWRC 0x2104 x 10
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0c,  // RAMWRC 0x2104 x 12
+  // RAMWRC 13 pixels
+  0x3c, 0x1a, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04,
+  0x21, 0x04, 0x21, 0x04, 0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0x68, 0xa2,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x82,  // RAMWRC 0x2104 x 130
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x06, 0xa8, 0x41, 0xf8, 0x00, 0x68, 0xa2,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  // RAMWRC 16 pixels
+  0x3c, 0x20, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04, 0x21, 0x04, 0x68, 0xa2, 0xa8, 0x41,
+  0xf8, 0x00, 0xf8, 0x00, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0xa8, 0x41, 0xf8, 0x00,
+  0x68, 0xa2,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x0e, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0a,  // RAMWRC 0x2104 x 10
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0d,  // RAMWRC 0x2104 x 13
+  // RAMWRC 12 pixels
+  0x3c, 0x18, 0x68, 0xa2, 0xf8, 0x00, 0xf8, 0x00, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04,
+  0x68, 0xa2, 0xa8, 0x41, 0xf8, 0x00, 0xf8, 0x00, 0x68, 0xa2,
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x82,  // RAMWRC 0x2104 x 130
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x09,  // RAMWRC 0x2104 x 9
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x07,  // RAMWRC 0xf800 x 7
+  0x3c, 0x08, 0xa8, 0x41, 0x21, 0x04, 0x21, 0x04, 0xa8, 0x41,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x04,  // RAMWRC 0xf800 x 4
+  0x3c, 0x0a, 0xa8, 0x41, 0x21, 0x04, 0x21, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x07,  // RAMWRC 0xf800 x 7
+  0x3c, 0x0a, 0xa8, 0x41, 0x21, 0x04, 0x21, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0a,  // RAMWRC 0x2104 x 10
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0e,  // RAMWRC 0x2104 x 14
+  0x3c, 0x04, 0xf8, 0x00, 0xf8, 0x00,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x08,  // RAMWRC 0xf800 x 8
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0a,  // RAMWRC 0x2104 x 10
+  0x3c, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x05,  // RAMWRC 0xf800 x 5
+  0x3c, 0x0a, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0xa8, 0x41,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x04,  // RAMWRC 0xf800 x 4
+  0x3c, 0x0c, 0xa8, 0x41, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x68, 0xa2, 0xa8, 0x41,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x05,  // RAMWRC 0xf800 x 5
+  0x3c, 0x0c, 0xa8, 0x41, 0x68, 0xa2, 0x21, 0x04, 0x21, 0x04, 0xa8, 0x41, 0xa8, 0x41,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0a,  // RAMWRC 0x2104 x 10
+  0x3c, 0x04, 0xa8, 0x41, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x06,  // RAMWRC 0x2104 x 6
+  0x3c, 0x04, 0xa8, 0x41, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x0e,  // RAMWRC 0x2104 x 14
+  0x3c, 0x04, 0xa8, 0x41, 0xa8, 0x41,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x04,  // RAMWRC 0x2104 x 4
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x08,  // RAMWRC 0xf800 x 8
+  0x3c, 0x02, 0xa8, 0x41,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0x7d,  // RAMWRC 0x2104 x 125
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x21, 0x04, 0x00, 0xda,  // RAMWRC 0x2104 x 218
+  0x3c, 0x02, 0x07, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x14,  // RAMWRC 0x0000 x 20
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0xdc,  // RAMWRC 0x07e0 x 220
+  0x3c, 0xff, 0x00, 0x00, 0x09, 0xe2,  // RAMWRC 0x0000 x 2530
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x47,  // RAMWRC 0x0000 x 71
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0xf8, 0x00, 0x00, 0x3d,  // RAMWRC 0xf800 x 61
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x1e,  // RAMWRC 0x8410 x 30
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x27,  // RAMWRC 0x0000 x 39
+  0x3c, 0xff, 0x07, 0xe0, 0x00, 0x15,  // RAMWRC 0x07e0 x 21
+  0x3c, 0xff, 0x84, 0x10, 0x00, 0x46,  // RAMWRC 0x8410 x 70
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x45,  // RAMWRC 0xffff x 69
+  0x3c, 0x02, 0x00, 0x00,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x47,  // RAMWRC 0x0000 x 71
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x0a,  // RAMWRC 0xffff x 10
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x09,  // RAMWRC 0x0000 x 9
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0x5b,  // RAMWRC 0xffff x 91
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0x8b,  // RAMWRC 0x0000 x 139
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0xef,  // RAMWRC 0x0000 x 239
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0xef,  // RAMWRC 0x0000 x 239
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0xef,  // RAMWRC 0x0000 x 239
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0xef,  // RAMWRC 0x0000 x 239
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x00, 0xef,  // RAMWRC 0x0000 x 239
+  0x3c, 0x02, 0xf8, 0x1f,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x00, 0x00, 0x09, 0xd7,  // RAMWRC 0x0000 x 2519
+  0x3c, 0xff, 0xff, 0xff, 0x00, 0xf0,  // RAMWRC 0xffff x 240
+  0x3c, 0xff, 0x42, 0x08, 0x07, 0x9b,  // RAMWRC 0x4208 x 1947
+  0x3c, 0x06, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x09,  // RAMWRC 0x4208 x 9
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x37,  // RAMWRC 0x4208 x 55
+  0x3c, 0x04, 0xff, 0xe0, 0xff, 0xe0,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0xa9,  // RAMWRC 0x4208 x 169
+  0x3c, 0x0a, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x08,  // RAMWRC 0x4208 x 8
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x38,  // RAMWRC 0x4208 x 56
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x98,  // RAMWRC 0x4208 x 152
+  // RAMWRC 15 pixels
+  0x3c, 0x1e, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x06,  // RAMWRC 0x4208 x 6
+  // RAMWRC 36 pixels
+  0x3c, 0x48, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08,
+  0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0,
+  0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08,
+  0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x06,  // RAMWRC 0x4208 x 6
+  // RAMWRC 17 pixels
+  0x3c, 0x22, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0,
+  0x42, 0x08, 0x42, 0x08,
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  // RAMWRC 10 pixels
+  0x3c, 0x14, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,
+  0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x91,  // RAMWRC 0x4208 x 145
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  0x3c, 0x0a, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x04,  // RAMWRC 0x4208 x 4
+  0x3c, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x06,  // RAMWRC 0x4208 x 6
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x04,  // RAMWRC 0x4208 x 4
+  // RAMWRC 11 pixels
+  0x3c, 0x16, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  0x3c, 0x0e, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x04,  // RAMWRC 0x4208 x 4
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x09,  // RAMWRC 0x4208 x 9
+  // RAMWRC 23 pixels
+  0x3c, 0x2e, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0,
+  0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08,
+  0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x91,  // RAMWRC 0x4208 x 145
+  0x3c, 0x0c, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x07,  // RAMWRC 0x4208 x 7
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x04,  // RAMWRC 0x4208 x 4
+  0x3c, 0x0e, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x04,  // RAMWRC 0x4208 x 4
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x05,  // RAMWRC 0xffe0 x 5
+  0x3c, 0x04, 0x42, 0x08, 0x42, 0x08,  // RAMWRC 2 pixels
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  0x3c, 0x0c, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  0x3c, 0x0c, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  0x3c, 0x0e, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08,  // RAMWRC 7 pixels
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  0x3c, 0x0c, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x05,  // RAMWRC 0xffe0 x 5
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x94,  // RAMWRC 0x4208 x 148
+  // RAMWRC 9 pixels
+  0x3c, 0x12, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0x42, 0x08, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x06,  // RAMWRC 0x4208 x 6
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x08,  // RAMWRC 0x4208 x 8
+  // RAMWRC 9 pixels
+  0x3c, 0x12, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0x42, 0x08, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  0x3c, 0x02, 0xff, 0xe0,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  // RAMWRC 11 pixels
+  0x3c, 0x16, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0,
+  0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x08,  // RAMWRC 0x4208 x 8
+  // RAMWRC 15 pixels
+  0x3c, 0x1e, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,
+  0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x06,  // RAMWRC 0x4208 x 6
+  0x3c, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 4 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x94,  // RAMWRC 0x4208 x 148
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  // RAMWRC 9 pixels
+  0x3c, 0x12, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08,
+  0x42, 0x08, 0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x05,  // RAMWRC 0xffe0 x 5
+  0x3c, 0x02, 0x42, 0x08,  // RAMWRC 1 pixels
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x04,  // RAMWRC 0x4208 x 4
+  0x3c, 0x0a, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 5 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x06,  // RAMWRC 0x4208 x 6
+  0x3c, 0x0c, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  0x3c, 0x0c, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0,  // RAMWRC 6 pixels
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x04,  // RAMWRC 0x4208 x 4
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  0x3c, 0x06, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08,  // RAMWRC 3 pixels
+  0x3c, 0xff, 0xff, 0xe0, 0x00, 0x04,  // RAMWRC 0xffe0 x 4
+  // RAMWRC 8 pixels
+  0x3c, 0x10, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0x42, 0x08,
+  0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x00, 0x05,  // RAMWRC 0x4208 x 5
+  // RAMWRC 8 pixels
+  0x3c, 0x10, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x42, 0x08, 0x42, 0x08, 0xff, 0xe0, 0xff, 0xe0,
+  0xff, 0xe0,
+  0x3c, 0xff, 0x42, 0x08, 0x10, 0x79,  // RAMWRC 0x4208 x 4217
+  0x00                                  // end
+};
@@ -0,0 +1,35 @@
+#include "src/st7789.h"
+#include "src/text.h"
+
+/* PAGE_MAIN as plain driver calls */
+void PAGE_MAIN_Naive (struct st7789 * lcd)
+{
+  ST7789_FillRect (lcd, 0, 239, 0, 279, 0x0000);
+  ST7789_FillRect (lcd, 0, 239, 0, 31, 0x001f);
+  ST7789_FillRect (lcd, 0, 239, 248, 279, 0x4208);
+  ST7789_FillRect (lcd, 0, 239, 32, 32, 0xffff);
+  ST7789_FillRect (lcd, 0, 239, 247, 247, 0xffff);
+  ST7789_SetPosition (8, 8);
+  ST7789_Text_DrawString (lcd, &FONT_16, "Stream page", 0xffff, 0x001f);
+  ST7789_SetPosition (8, 256);
+  ST7789_Text_DrawString (lcd, &FONT_8, "scr2stream sample", 0xffe0, 0x4208);
+  ST7789_FillRect (lcd, 10, 229, 44, 44, 0x07e0);
+  ST7789_FillRect (lcd, 10, 229, 139, 139, 0x07e0);
+  ST7789_FillRect (lcd, 10, 10, 45, 138, 0x07e0);
+  ST7789_FillRect (lcd, 229, 229, 45, 138, 0x07e0);
+  ST7789_FillRect (lcd, 11, 228, 45, 138, 0x2104);
+  ST7789_SetPosition (20, 54);
+  ST7789_Text_DrawString (lcd, &FONT_24, "23.5 C", 0xffff, 0x2104);
+  ST7789_SetPosition (20, 90);
+  ST7789_Text_DrawString (lcd, &FONT_16_AA, "alarm 42", 0xf800, 0x2104);
+  ST7789_FillRect (lcd, 120, 120, 150, 236, 0xf81f);
+  ST7789_FillRect (lcd, 20, 110, 160, 175, 0x8410);
+  ST7789_FillRect (lcd, 20, 80, 160, 175, 0xf800);
+  ST7789_FillRect (lcd, 20, 110, 190, 205, 0x8410);
+  ST7789_FillRect (lcd, 20, 40, 190, 205, 0x07e0);
+  ST7789_FillRect (lcd, 130, 220, 150, 230, 0xffff);
+  ST7789_FillRect (lcd, 140, 210, 160, 160, 0x0000);
+  ST7789_FillRect (lcd, 140, 210, 220, 220, 0x0000);
+  ST7789_FillRect (lcd, 140, 140, 161, 219, 0x0000);
+  ST7789_FillRect (lcd, 210, 210, 161, 219, 0x0000);
+}
@@ -0,0 +1,210 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Host tests against controller model
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Version 1.0
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdlib.h>
+#include "test.h"
+
+/** @var Signals of example wiring */
+static struct signal cs = { .ddr = &DDRB, .port = &PORTB, .pin = 2 };
+static struct signal bl = { .ddr = &DDRB, .port = &PORTB, .pin = 1 };
+static struct signal rs = { .ddr = &DDRB, .port = &PORTB, .pin = 0 };
+static struct signal dc = { .ddr = &DDRD, .port = &PORTD, .pin = 7 };
+
+/** @var Driver of tests */
+struct st7789 Lcd = { .cs = &cs, .bl = &bl, .dc = &dc, .rs = &rs };
+
+/** @var Results */
+static unsigned checks;
+static unsigned failed;
+
+/* Pixel as RGB888 of PPM, low bits zero as HAL_Mock_Dump */
+static void Test_Rgb (uint16_t pixel, uint8_t * rgb)
+{
+  rgb[0] = (pixel >> 8) & 0xF8;                         // red
+  rgb[1] = (pixel >> 3) & 0xFC;                         // green
+  rgb[2] = (pixel << 3) & 0xF8;                         // blue
+}
+
+/* Screen as shown to PPM file */
+static int Test_Write (const char * file)
+{
+  FILE * out = fopen (file, "wb");
+  uint8_t rgb[3];
+  int16_t x, y;
+
+  if (out == NULL) {
+    return 0;
+  }
+  fprintf (out, "P6\n%d %d\n255\n", Screen.width, Screen.height);
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      Test_Rgb (Test_Pixel (x, y), rgb);
+      fwrite (rgb, 1, 3, out);
+    }
+  }
+  fclose (out);
+  return 1;
+}
+
+/**
+ * @desc    Record result of check
+ *
+ * @param   int condition
+ * @param   const char * text of condition
+ * @param   const char * file
+ * @param   int line
+ *
+ * @return  int condition
+ */
+int Test_Check (int condition, const char * text, const char * file, int line)
+{
+  checks++;
+  if (!condition) {
+    failed++;
+    printf ("  FAIL %s:%d %s\n", file, line, text);
+  }
+  return condition;
+}
+
+/**
+ * @desc    Init driver & model in orientation, display RAM zeroed
+ *
+ * @param   uint8_t madctl
+ *
+ * @return  void
+ */
+void Test_Init (uint8_t madctl)
+{
+  HAL_Mock_Panel (Lcd.cs, Lcd.dc);
+  memset (Mock.gram, 0, sizeof (Mock.gram));
+  ST7789_Init (&Lcd, madctl);
+  Mock.errors = 0;
+}
+
+/**
+ * @desc    Display RAM of model up to date, ST7789_Flush in frame buffer mode
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void Test_Sync (void)
+{
+#if defined(ST7789_FRAMEBUFFER)
+  ST7789_Flush (&Lcd);
+#endif
+}
+
+/**
+ * @desc    Pixel shown at screen position, MADCTL applied as datasheet: MV exchanges,
+ *          MX mirrors RAM columns, MY mirrors RAM rows of panel, then scrolling
+ *
+ * @param   int16_t x
+ * @param   int16_t y
+ *
+ * @return  uint16_t
+ */
+uint16_t Test_Pixel (int16_t x, int16_t y)
+{
+  int16_t u = x, v = y;                                 // visible column & row of panel
+
+  if (Screen.madctl & ST77XX_XY_CHANGE) {
+    u = y;
+    v = x;
+  }
+  if (Screen.madctl & ST77XX_X_MIRROR) u = Panel.width - 1 - u;
+  if (Screen.madctl & ST77XX_Y_MIRROR) v = Panel.height - 1 - v;
+
+  return Mock.gram[HAL_Mock_Line (Panel.offsetY + v)][Panel.offsetX + u];
+}
+
+/**
+ * @desc    Compare screen with reference image tests/golden/<name>.ppm,
+ *          make golden (TEST_GOLDEN=1) writes reference instead
+ *
+ * @param   const char * name
+ * @param   const char * file of caller
+ * @param   int line of caller
+ *
+ * @return  int
+ */
+int Test_Golden (const char * name, const char * file, int line)
+{
+  char path[64];
+  FILE * in;
+  uint8_t rgb[3], golden[3];
+  int16_t x, y, xs = 0, xe = -1, ys = 0, ye = -1, fx = -1, fy = -1;
+  uint32_t differ = 0;
+  int width = 0, height = 0;
+
+  Test_Sync ();
+  snprintf (path, sizeof (path), "tests/golden/%s.ppm", name);
+  if (getenv ("TEST_GOLDEN")) {
+    return Test_Check (Test_Write (path), path, file, line);
+  }
+  in = fopen (path, "rb");
+  if ((in == NULL) || (fscanf (in, "P6 %d %d 255", &width, &height) != 2) || (fgetc (in) == EOF) ||
+      (width != Screen.width) || (height != Screen.height)) {
+    if (in != NULL) {
+      fclose (in);
+    }
+    printf ("       no reference %s of %dx%d, make golden\n", path, Screen.width, Screen.height);
+    return Test_Check (0, name, file, line);
+  }
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      Test_Rgb (Test_Pixel (x, y), rgb);
+      if ((fread (golden, 1, 3, in) == 3) && (memcmp (rgb, golden, 3) == 0)) {
+        continue;
+      }
+      if (differ++ == 0) {
+        fx = xs = xe = x;                               // first differing pixel
+        fy = ys = ye = y;
+      }
+      if (x < xs) xs = x;                               // bounding box
+      if (x > xe) xe = x;
+      ye = y;
+    }
+  }
+  fclose (in);
+  if (!Test_Check (differ == 0, name, file, line)) {
+    snprintf (path, sizeof (path), "tests/bin/%s.ppm", name);
+    Test_Write (path);                                  // screen to compare
+    printf ("       %u pixels differ in %d..%d x %d..%d, first %d, %d, screen in %s\n",
+            differ, xs, xe, ys, ye, fx, fy, path);
+    return 0;
+  }
+  return 1;
+}
+
+/**
+ * @desc    Report & exit code of test program
+ *
+ * @param   const char * name
+ *
+ * @return  int
+ */
+int Test_Done (const char * name)
+{
+  if (Mock.errors) {
+    printf ("  FAIL %u chunk boundary errors\n", Mock.errors);
+    failed++;
+  }
+  printf ("%-12s %u checks, %u failed\n", name, checks, failed);
+  return failed ? 1 : 0;
+}
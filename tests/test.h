@@ -0,0 +1,108 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Host tests against controller model
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test.h
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      src/st7789.h, src/hal/model.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       make test [FRAME=1] builds every tests/test_*.c with tests/test.c
+ *              against src/hal/hal_mock.c & model, runs it, stops at first failure
+ *
+ *              Checks compare display RAM of the model with a reference drawn
+ *              by the test itself, or with a reference image of the screen in
+ *              tests/golden/<name>.ppm. A failing golden prints count, bounding
+ *              box & first of differing pixels and writes the screen to
+ *              tests/bin/<name>.ppm; make golden writes the references.
+ * --------------------------------------------------------------------------------------------+
+ */
+
+#ifndef __TEST_H__
+#define __TEST_H__
+
+  #include <stdio.h>
+  #include <string.h>
+  #include "src/st7789.h"
+
+  /** @var Driver of tests, tests/test.c */
+  extern struct st7789 Lcd;
+
+  /** @var Screen & panel of driver, st7789.c */
+  extern struct S_SCREEN Screen;
+  extern struct S_PANEL Panel;
+
+  // Check, failure reported with file & line, test continues
+  #define TEST_CHECK(condition) Test_Check ((condition), #condition, __FILE__, __LINE__)
+  // Screen against tests/golden/<name>.ppm, failure reported with file & line
+  #define TEST_GOLDEN(name)     Test_Golden ((name), __FILE__, __LINE__)
+
+  /**
+   * @desc    Record result of check
+   *
+   * @param   int condition
+   * @param   const char * text of condition
+   * @param   const char * file
+   * @param   int line
+   *
+   * @return  int condition
+   */
+  int Test_Check (int, const char *, const char *, int);
+
+  /**
+   * @desc    Init driver & model in orientation, display RAM zeroed
+   *
+   * @param   uint8_t madctl
+   *
+   * @return  void
+   */
+  void Test_Init (uint8_t);
+
+  /**
+   * @desc    Display RAM of model up to date, ST7789_Flush in frame buffer mode
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void Test_Sync (void);
+
+  /**
+   * @desc    Pixel shown at screen position, MADCTL applied as datasheet: MV exchanges,
+   *          MX mirrors RAM columns, MY mirrors RAM rows of panel, then scrolling
+   *
+   * @param   int16_t x
+   * @param   int16_t y
+   *
+   * @return  uint16_t
+   */
+  uint16_t Test_Pixel (int16_t, int16_t);
+
+  /**
+   * @desc    Compare screen with reference image tests/golden/<name>.ppm,
+   *          make golden (TEST_GOLDEN=1) writes reference instead
+   *
+   * @param   const char * name
+   * @param   const char * file of caller
+   * @param   int line of caller
+   *
+   * @return  int
+   */
+  int Test_Golden (const char *, const char *, int);
+
+  /**
+   * @desc    Report & exit code of test program
+   *
+   * @param   const char * name
+   *
+   * @return  int
+   */
+  int Test_Done (const char *);
+
+#endif
@@ -0,0 +1,247 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        External assets
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_asset.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/asset.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       100x60 image as RAM blit, SPI NOR flash passed through to panel,
+ *              chunked flash reads & chunked file reads against image of this
+ *              test, whole, cut by screen edge, by clip rectangle, in viewport
+ *              with origin & corners reversed, store failing inside image (short
+ *              read) & outside
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/asset.h"
+
+#define IMAGE_W               100                       // test image
+#define IMAGE_H               60
+#define BG                    0x1234                    // screen around image
+
+/** @var Image in RAM & in flash, flash in wire order */
+static uint16_t image[IMAGE_W * IMAGE_H];
+static uint8_t memory[IMAGE_W * IMAGE_H * 2];
+
+/** @var SPI NOR flash on display bus */
+static struct signal fcs = { .ddr = &DDRB, .port = &PORTB, .pin = 3 };
+static struct S_FLASH flash = { .cs = &fcs };
+static uint32_t flashIndex;                             // byte since chip select
+static uint32_t flashAddress;
+
+/** @var Reads of failing store before short read */
+static uint8_t readsLeft;
+
+/** @var Corners of drawn rectangle reversed */
+static uint8_t reversed;
+
+/** @var Rectangle of image & clip on screen */
+static int16_t left, top;
+static int16_t clipXs, clipXe, clipYs, clipYe;
+
+/* Flash model, READ command & 24 bit address, then data, transaction ends
+   at byte clocked with flash idle or at next read */
+static uint8_t Asset_Flash (uint8_t data)
+{
+  uint8_t out = 0xFF;
+
+  if (*fcs.port & (1 << fcs.pin)) {
+    flashIndex = 0;                                     // not selected
+    return 0xFF;
+  }
+  if ((flashIndex >= 1) && (flashIndex <= 3)) {
+    flashAddress = (flashAddress << 8) | data;          // address
+  } else if (flashIndex > 3) {
+    out = (flashAddress < sizeof (memory)) ? memory[flashAddress] : 0xFF;
+    flashAddress++;
+  } else {
+    flashAddress = 0;                                   // command
+  }
+  flashIndex++;
+
+  return out;
+}
+
+/* Read callback of flash, chip select edge ends transaction of model */
+static uint8_t Asset_Flash_Read (void * context, uint32_t address, uint8_t * buffer, uint8_t length)
+{
+  flashIndex = 0;
+  return ST7789_Flash_Read (context, address, buffer, length);
+}
+
+/* Store giving one byte less at read after readsLeft */
+static uint8_t Asset_Short (void * context, uint32_t address, uint8_t * buffer, uint8_t length)
+{
+  (void) context;
+  memcpy (buffer, &memory[address], length);
+
+  return readsLeft-- ? length : length - 1;
+}
+
+/* Expected pixel at screen position */
+static uint16_t Asset_Expect (int16_t x, int16_t y)
+{
+  if ((x < left) || (x >= left + IMAGE_W) || (y < top) || (y >= top + IMAGE_H) ||
+      (x < clipXs) || (x > clipXe) || (y < clipYs) || (y > clipYe)) {
+    return BG;
+  }
+  return image[(y - top) * IMAGE_W + (x - left)];
+}
+
+/* Image at xs, ys of view by one of the paths */
+static uint8_t Asset_Draw (uint8_t path, FILE * file, int16_t xs, int16_t ys)
+{
+  struct S_ASSETS flashStore = { Asset_Flash_Read, &flash };
+  struct S_ASSETS fileStore = { ST7789_File_Read, file };
+  uint16_t xe = xs + IMAGE_W - 1, ye = ys + IMAGE_H - 1;
+
+  if (reversed) {
+    xe = xs;                                            // same rectangle, right bottom first
+    xs = xs + IMAGE_W - 1;
+    ye = ys;
+    ys = ys + IMAGE_H - 1;
+  }
+  switch (path) {
+    case 0: return ST7789_DrawImage (&Lcd, xs, xe, ys, ye, image);
+    case 1: return ST7789_Flash_Image (&Lcd, &flash, 0, xs, xe, ys, ye);
+    case 2: return ST7789_Asset_Image (&Lcd, &flashStore, 0, xs, xe, ys, ye);
+    default: return ST7789_Asset_Image (&Lcd, &fileStore, 0, xs, xe, ys, ye);
+  }
+}
+
+/* Screen equals image, drawn at xs, ys in view at ox, oy */
+static int Asset_Same (uint8_t path, FILE * file, const char * where, int16_t ox, int16_t oy, int16_t xs, int16_t ys)
+{
+  const char * paths[] = { "RAM blit", "flash pass-through", "chunked flash reads", "chunked file reads" };
+  int16_t x, y;
+  uint16_t expect;
+
+  left = xs + ox;
+  top = ys + oy;
+  if (Asset_Draw (path, file, xs, ys) != ST77XX_SUCCESS) {
+    printf ("       %s %s, error\n", paths[path], where);
+    return 0;
+  }
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      expect = Asset_Expect (x, y);
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       %s %s, pixel %d, %d: 0x%04x, expected 0x%04x\n",
+                paths[path], where, x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Screen cleared, clip of reference */
+static void Asset_Clear (int16_t xs, int16_t xe, int16_t ys, int16_t ye)
+{
+  ST7789_View_Reset ();
+  ST7789_ClearScreen (&Lcd, BG);
+  clipXs = xs; clipXe = xe;
+  clipYs = ys; clipYe = ye;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  struct S_ASSETS failing = { Asset_Short, NULL };
+  FILE * file = tmpfile ();
+  struct S_ASSETS fileStore = { ST7789_File_Read, file };
+#if !defined(ST7789_FRAMEBUFFER)
+  uint32_t bytes[2];
+#endif
+  uint8_t path, whole = 1, edge = 1, cut = 1, view = 1, swapped = 1;
+  uint32_t i;
+
+  for (i = 0; i < IMAGE_W * IMAGE_H; i++) {
+    image[i] = (uint16_t) (i * 2654435761u >> 16);
+    memory[2 * i] = (uint8_t) (image[i] >> 8);
+    memory[2 * i + 1] = (uint8_t) image[i];
+  }
+  TEST_CHECK (file && (fwrite (memory, sizeof (memory), 1, file) == 1));
+  Test_Init (ST77XX_ROTATE_0);
+  HAL_Pin_Output (&fcs);
+  HAL_Pin_Set (&fcs);                                   // flash idle
+  Mock.device = Asset_Flash;
+
+  for (path = 0; path < 4; path++) {
+    // whole image, one read of flash
+    Asset_Clear (0, Screen.width - 1, 0, Screen.height - 1);
+    whole &= Asset_Same (path, file, "whole", 0, 0, 20, 30);
+
+    // cut by left & bottom screen edge, read row by row
+    Asset_Clear (0, Screen.width - 1, 0, Screen.height - 1);
+    edge &= Asset_Same (path, file, "screen edge", 0, 0, -30, Screen.height - 25);
+
+    // clip rectangle inside image on every side
+    Asset_Clear (40, 90, 50, 70);
+    ST7789_Clip_Push (40, 90, 50, 70);
+    cut &= Asset_Same (path, file, "clipped", 0, 0, 20, 30);
+
+    // viewport with origin, image partly outside view
+    Asset_Clear (30, 200, 40, 250);
+    ST7789_View_Push (30, 200, 40, 250);
+    view &= Asset_Same (path, file, "in view", 30, 40, -11, -7);
+
+    // corners reversed, clipped in view
+    Asset_Clear (30, 200, 40, 250);
+    ST7789_View_Push (30, 200, 40, 250);
+    reversed = 1;
+    swapped &= Asset_Same (path, file, "reversed", 30, 40, -11, -7);
+    reversed = 0;
+  }
+  ST7789_View_Reset ();
+  TEST_CHECK (whole);
+  TEST_CHECK (edge);
+  TEST_CHECK (cut);
+  TEST_CHECK (view);
+  TEST_CHECK (swapped);
+
+  // short read inside image, panel released
+  readsLeft = 3;
+  TEST_CHECK (ST7789_Asset_Image (&Lcd, &failing, 0, 20, 20 + IMAGE_W - 1, 30, 30 + IMAGE_H - 1) == ST77XX_ERROR);
+  TEST_CHECK (*Lcd.cs->port & (1 << Lcd.cs->pin));
+  // image behind end of file
+  TEST_CHECK (ST7789_Asset_Image (&Lcd, &fileStore, sizeof (memory) - 10, 20, 29, 30, 39) == ST77XX_ERROR);
+  TEST_CHECK (*Lcd.cs->port & (1 << Lcd.cs->pin));
+  // nothing visible
+  TEST_CHECK (Asset_Draw (1, file, Screen.width, 0) == ST77XX_ERROR);
+  TEST_CHECK (Asset_Draw (2, file, Screen.width, 0) == ST77XX_ERROR);
+
+#if !defined(ST7789_FRAMEBUFFER)
+  // frame buffer sends changed rows at flush only
+  bytes[0] = Mock.clocks;
+  Asset_Draw (1, file, 20, 30);
+  bytes[0] = Mock.clocks - bytes[0];
+  bytes[1] = Mock.clocks;
+  Asset_Draw (2, file, 20, 30);
+  bytes[1] = Mock.clocks - bytes[1];
+  printf ("  %ux%u image, bytes on shared bus: pass-through %u, chunked reads %u\n",
+          IMAGE_W, IMAGE_H, bytes[0], bytes[1]);
+  TEST_CHECK (bytes[0] < bytes[1]);
+#endif
+  TEST_CHECK (Mock.errors == 0);
+
+  if (file) {
+    fclose (file);
+  }
+  return Test_Done ("asset");
+}
@@ -0,0 +1,137 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        5x8 characters
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_char.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/font.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       ST7789_DrawChar of every character in X1 / X2 / X3 against dots
+ *              of FONTS drawn one by one, whole, cut by clip rectangle on every
+ *              side & by screen edge, bytes on bus of whole character set
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+
+#define FG                    WHITE                     // dots
+#define BG                    BLUE                      // background
+
+/** @var Clip of check, screen or clip rectangle */
+static int16_t clipXs, clipXe, clipYs, clipYe;
+
+/* Pixel of character at x, y by dots of FONTS, BG outside glyph or clip */
+static uint16_t Char_Dot (char character, enum S_SIZE size, int16_t x, int16_t y, int16_t px, int16_t py)
+{
+  uint8_t dotX = size & 0x01, dotY = size >> 7;
+  int16_t col = (px - x) >> dotX, row = (py - y) >> dotY;
+
+  if ((px < clipXs) || (px > clipXe) || (py < clipYs) || (py > clipYe) ||
+      (px < x) || (py < y) || (col >= CHARS_COLS_LEN) || (row >= CHARS_ROWS_LEN)) {
+    return BG;
+  }
+  return (FONTS[character - 32][col] & (1 << row)) ? FG : BG;
+}
+
+/* Character drawn at x, y on BG equals dots of FONTS, one pixel around too */
+static int Char_Same (char character, enum S_SIZE size, int16_t x, int16_t y)
+{
+  int16_t w = CHARS_COLS_LEN << (size & 0x01), h = CHARS_ROWS_LEN << (size >> 7);
+  int16_t px, py;
+  uint16_t expect;
+
+  ST7789_FillRect (&Lcd, 0, Screen.width - 1, y > 0 ? y - 1 : 0, y + h, BG);
+  ST7789_SetPosition (x, y);
+  ST7789_DrawChar (&Lcd, character, FG, size);
+  Test_Sync ();
+  for (py = y - 1; py <= y + h; py++) {
+    for (px = x - 1; px <= x + w; px++) {
+      if ((px < 0) || (py < 0) || (px >= Screen.width) || (py >= Screen.height)) {
+        continue;                                       // off screen
+      }
+      expect = Char_Dot (character, size, x, y, px, py);
+      if (Test_Pixel (px, py) != expect) {
+        printf ("       '%c' size 0x%02x at %d, %d, pixel %d, %d: 0x%04x, expected 0x%04x\n",
+                character, size, x, y, px, py, Test_Pixel (px, py), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const enum S_SIZE sizes[] = { X1, X2, X3 };
+  int16_t clip[4];
+#if !defined(ST7789_FRAMEBUFFER)
+  uint32_t bytes;
+#endif
+  uint8_t s, c, same = 1, cut = 1, edge = 1;
+
+  Test_Init (ST77XX_ROTATE_0);
+  ST7789_ClearScreen (&Lcd, BG);
+
+  for (s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++) {
+    // whole character
+    clipXs = 0; clipXe = Screen.width - 1;
+    clipYs = 0; clipYe = Screen.height - 1;
+    for (c = 0x20; c <= 0x7F; c++) {
+      same &= Char_Same (c, sizes[s], 20 + c % 7, 40);
+    }
+
+    // clip rectangle through middle of dots, every side
+    clip[0] = 22; clip[1] = 25;                         // left & right edge inside character
+    clip[2] = 103; clip[3] = 108;                       // top & bottom edge inside character
+    ST7789_Clip_Push (clip[0], clip[1], clip[2], clip[3]);
+    clipXs = clip[0]; clipXe = clip[1];
+    clipYs = clip[2]; clipYe = clip[3];
+    for (c = 0x20; c <= 0x7F; c++) {
+      cut &= Char_Same (c, sizes[s], 20 + (c & 1), 100 + (c & 3));
+    }
+    ST7789_View_Pop ();
+
+    // right & bottom edge of screen
+    clipXs = 0; clipXe = Screen.width - 1;
+    clipYs = 0; clipYe = Screen.height - 1;
+    for (c = 0x20; c <= 0x7F; c++) {
+      edge &= Char_Same (c, sizes[s], Screen.width - 1 - (c % 9), 200);
+      edge &= Char_Same (c, sizes[s], 150, Screen.height - 1 - (c % 15));
+    }
+  }
+  TEST_CHECK (same);
+  TEST_CHECK (cut);
+  TEST_CHECK (edge);
+
+  // out of range, nothing drawn
+  ST7789_SetPosition (20, 40);
+  TEST_CHECK (ST7789_DrawChar (&Lcd, 0x1F, FG, X1) == ST77XX_ERROR);
+  TEST_CHECK (ST7789_DrawChar (&Lcd, (char) 0x80, FG, X1) == ST77XX_ERROR);
+
+#if !defined(ST7789_FRAMEBUFFER)
+  // frame buffer sends changed rows at flush only
+  for (s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++) {
+    bytes = Mock.clocks;
+    for (c = 0x20; c <= 0x7F; c++) {
+      ST7789_SetPosition (20, 40);
+      ST7789_DrawChar (&Lcd, c, FG, sizes[s]);
+    }
+    printf ("  96 characters size 0x%02x, bytes on bus: %u\n", sizes[s], Mock.clocks - bytes);
+  }
+#endif
+
+  return Test_Done ("char");
+}
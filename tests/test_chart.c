@@ -0,0 +1,141 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Strip chart
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_chart.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/widget.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Strip chart scrolled by VSCRDEF & VSCSAD of the model in both
+ *              rotations with MV, shown screen against chart drawn from the
+ *              last samples, fixed areas untouched, one column per sample,
+ *              band out of screen, moved by view or cut by clip rejected
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdlib.h>
+#include "test.h"
+#include "src/widget.h"
+
+#define SAMPLES               300                       // more than width, wraps
+
+/** @var Samples */
+static uint16_t samples[SAMPLES];
+
+/* Row of value */
+static uint16_t Chart_Row (struct S_CHART * chart, uint16_t value)
+{
+  return chart->y + chart->height - 1 - ((uint32_t) value * (chart->height - 1)) / chart->max;
+}
+
+/* Shown chart equals last n samples, newest at right edge */
+static int Chart_Same (struct S_CHART * chart, uint16_t n)
+{
+  uint16_t x, y, row, last, from, to, expect;
+  int16_t i;
+
+  Test_Sync ();
+  for (x = 0; x < chart->width; x++) {
+    i = (int16_t) n - chart->width + x;                 // sample of column
+    row = (i >= 0) ? Chart_Row (chart, samples[i]) : 0;
+    last = (i >= 1) ? Chart_Row (chart, samples[i - 1]) : chart->y + chart->height - 1;
+    from = (row < last) ? row : last;
+    to = (row < last) ? last : row;
+    for (y = chart->y; y < chart->y + chart->height; y++) {
+      expect = chart->bg;
+      if (i >= 0) {
+        if (y == row) expect = chart->point;
+        else if ((y >= from) && (y <= to)) expect = chart->fg;
+      }
+      if (Test_Pixel (chart->x + x, y) != expect) {
+        printf ("       madctl 0x%02x, sample %u, pixel %u, %u: 0x%04x, expected 0x%04x\n",
+                Screen.madctl, n, chart->x + x, y, Test_Pixel (chart->x + x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const uint8_t rotations[] = { ST77XX_ROTATE_90, ST77XX_ROTATE_270 };
+  struct S_CHART chart = { .x = 30, .width = 200, .y = 40, .height = 100, .max = 1000,
+                           .fg = WHITE, .point = RED, .bg = BLUE };
+  struct S_CHART bad;
+  uint16_t i, same;
+  uint8_t r;
+
+  srand (1);
+  for (i = 0; i < SAMPLES; i++) {
+    samples[i] = rand () % (chart.max + 1);
+  }
+
+  for (r = 0; r < sizeof (rotations); r++) {
+    Test_Init (rotations[r]);
+    ST7789_ClearScreen (&Lcd, BLACK);
+    ST7789_FillRect (&Lcd, 0, chart.x - 1, 0, Screen.height - 1, RED);
+    ST7789_FillRect (&Lcd, chart.x + chart.width, Screen.width - 1, 0, Screen.height - 1, WHITE);
+    TEST_CHECK (ST7789_Chart_Init (&Lcd, &chart) == ST77XX_SUCCESS);
+    TEST_CHECK (Chart_Same (&chart, 0));
+
+    same = 1;
+    for (i = 0; (i < SAMPLES) && same; i++) {
+      ST7789_Chart_Push (&Lcd, &chart, samples[i]);
+      same = Chart_Same (&chart, i + 1);
+    }
+    TEST_CHECK (same);
+
+    // fixed areas left & right of band
+    TEST_CHECK (Test_Pixel (0, 0) == RED);
+    TEST_CHECK (Test_Pixel (chart.x - 1, Screen.height - 1) == RED);
+    TEST_CHECK (Test_Pixel (chart.x + chart.width, 0) == WHITE);
+    TEST_CHECK (Test_Pixel (Screen.width - 1, Screen.height - 1) == WHITE);
+
+    // scrolling off, fixed area stays
+    ST7789_Chart_Stop (&Lcd);
+    Test_Sync ();
+    TEST_CHECK (Test_Pixel (0, 0) == RED);
+  }
+
+  // band out of screen, moved by view origin or cut by clip, nothing drawn
+  Test_Init (ST77XX_ROTATE_90);
+  ST7789_ClearScreen (&Lcd, BLACK);
+  bad = chart;
+  bad.y = Screen.height - chart.height + 1;
+  TEST_CHECK (ST7789_Chart_Init (&Lcd, &bad) == ST77XX_ERROR);
+  bad = chart;
+  bad.x = Screen.width - chart.width + 1;
+  TEST_CHECK (ST7789_Chart_Init (&Lcd, &bad) == ST77XX_ERROR);
+  bad = chart;
+  bad.height = 0;
+  TEST_CHECK (ST7789_Chart_Init (&Lcd, &bad) == ST77XX_ERROR);
+  ST7789_View_Push (10, Screen.width - 1, 0, Screen.height - 1);
+  TEST_CHECK (ST7789_Chart_Init (&Lcd, &chart) == ST77XX_ERROR);
+  ST7789_View_Reset ();
+  ST7789_Clip_Push (0, Screen.width - 1, 0, chart.y + chart.height - 2);
+  TEST_CHECK (ST7789_Chart_Init (&Lcd, &chart) == ST77XX_ERROR);
+  ST7789_View_Reset ();
+  Test_Sync ();
+  TEST_CHECK (Test_Pixel (chart.x, chart.y) == BLACK);
+  TEST_CHECK (Test_Pixel (chart.x, chart.y + chart.height - 1) == BLACK);
+
+  // rotation without MV would scroll vertically
+  Test_Init (ST77XX_ROTATE_0);
+  TEST_CHECK (ST7789_Chart_Init (&Lcd, &chart) == ST77XX_ERROR);
+
+  return Test_Done ("chart");
+}
@@ -0,0 +1,193 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Clip rectangles & viewports
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_clip.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Primitives under clip & nested viewports against the same drawing
+ *              without clip masked by the clip rectangle, nested clips without
+ *              overlap send nothing, clipped lines golden
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/pixel.h"
+
+#define IMAGE_W               40                        // test image
+#define IMAGE_H               30
+
+/** @var Screens without & with clip */
+static uint16_t full[ST7789_HEIGHT][ST7789_WIDTH];
+static uint16_t image[IMAGE_W * IMAGE_H];
+static uint16_t large[201 * 201];
+
+/* Copy of screen */
+static void Clip_Save (void)
+{
+  int16_t x, y;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      full[y][x] = Test_Pixel (x, y);
+    }
+  }
+}
+
+/* Screen equals saved screen inside clip & background outside */
+static int Clip_Same (int16_t xs, int16_t xe, int16_t ys, int16_t ye, uint16_t background)
+{
+  int16_t x, y;
+  uint16_t expect;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      expect = ((x >= xs) && (x <= xe) && (y >= ys) && (y <= ye)) ? full[y][x] : background;
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       pixel %d, %d: 0x%04x, expected 0x%04x\n", x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Scene drawn in view coordinates */
+static void Clip_Scene (void)
+{
+  ST7789_FillRect (&Lcd, 10, 120, 20, 90, RED);
+  ST7789_DrawImage (&Lcd, 60, 60 + IMAGE_W - 1, 70, 70 + IMAGE_H - 1, image);
+  ST7789_FastLineHorizontal (&Lcd, 0, 200, 50, WHITE);
+  ST7789_FastLineVertical (&Lcd, 100, 0, 200, WHITE);
+  ST7789_DrawPixel (&Lcd, 41, 41, WHITE);
+  ST7789_SetPosition (30, 40);
+  ST7789_DrawString (&Lcd, "CLIP", WHITE, X3);
+}
+
+/* Nothing of scene & large image sent under current clip */
+static int Clip_Nothing (void)
+{
+  uint32_t bytes;
+
+  Test_Sync ();
+  bytes = Mock.bytes;
+  if (ST7789_DrawImage (&Lcd, 0, 200, 0, 200, large) != ST77XX_ERROR) {
+    return 0;
+  }
+  Clip_Scene ();
+  ST7789_DrawLine (&Lcd, 0, 200, 0, 200, WHITE);
+  ST7789_ClearScreen (&Lcd, WHITE);
+  Test_Sync ();
+
+  return Mock.bytes == bytes;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  int16_t i;
+
+  for (i = 0; i < IMAGE_W * IMAGE_H; i++) {
+    image[i] = (uint16_t) (i * 2654435761u >> 16);
+  }
+  Test_Init (ST77XX_ROTATE_0);
+
+  // clip rectangle, the rest untouched
+  ST7789_ClearScreen (&Lcd, BLACK);
+  Clip_Scene ();
+  Clip_Save ();
+  ST7789_ClearScreen (&Lcd, BLACK);
+  TEST_CHECK (ST7789_Clip_Push (35, 84, 45, 77) == ST77XX_SUCCESS);
+  Clip_Scene ();
+  ST7789_View_Pop ();
+  TEST_CHECK (Clip_Same (35, 84, 45, 77, BLACK));
+
+  // nested clips intersect
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_Clip_Push (20, 90, 30, 95);
+  ST7789_Clip_Push (50, 150, 10, 60);
+  Clip_Scene ();
+  ST7789_View_Pop ();
+  ST7789_View_Pop ();
+  TEST_CHECK (Clip_Same (50, 90, 30, 60, BLACK));
+
+  // clear screen fills only clip
+  ST7789_ClearScreen (&Lcd, BLACK);
+  Clip_Scene ();
+  Clip_Save ();
+  ST7789_Clip_Push (5, 25, 5, 25);
+  ST7789_ClearScreen (&Lcd, BLUE);
+  ST7789_View_Pop ();
+  for (i = 5; i <= 25; i++) {
+    ST7789_Pixel_Fill (&full[i][5], BLUE, 21);
+  }
+  TEST_CHECK (Clip_Same (0, Screen.width - 1, 0, Screen.height - 1, BLACK));
+
+  // nested clips without overlap, empty clip
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_View_Push (10, 50, 10, 50);
+  ST7789_Clip_Push (100, 120, 0, 20);                   // columns miss
+  TEST_CHECK (Clip_Nothing ());
+  ST7789_View_Pop ();
+  ST7789_Clip_Push (100, 120, 100, 120);                // columns & rows miss
+  TEST_CHECK (Clip_Nothing ());
+  ST7789_View_Pop ();
+  ST7789_View_Pop ();
+  TEST_CHECK (Clip_Same (0, -1, 0, -1, BLACK));         // all black
+
+  // viewport moves origin, nested origins add up
+  ST7789_ClearScreen (&Lcd, BLACK);
+  Clip_Scene ();
+  Clip_Save ();
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_View_Push (0, Screen.width - 1, 0, Screen.height - 1);
+  ST7789_View_Push (0, Screen.width - 1, 0, Screen.height - 1);
+  Clip_Scene ();
+  ST7789_View_Pop ();
+  ST7789_View_Pop ();
+  TEST_CHECK (Clip_Same (0, Screen.width - 1, 0, Screen.height - 1, BLACK));
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_View_Push (30, 200, 40, 200);
+  ST7789_View_Push (5, 100, 5, 100);
+  ST7789_FillRect (&Lcd, 0, 9, 0, 9, RED);
+  ST7789_FillRect (&Lcd, 90, 120, 90, 120, RED);        // clipped at screen 130, 140
+  ST7789_View_Pop ();
+  ST7789_View_Pop ();
+  Test_Sync ();
+  TEST_CHECK (Test_Pixel (35, 45) == RED);
+  TEST_CHECK (Test_Pixel (44, 54) == RED);
+  TEST_CHECK (Test_Pixel (34, 45) == BLACK);
+  TEST_CHECK (Test_Pixel (130, 140) == RED);
+  TEST_CHECK (Test_Pixel (131, 140) == BLACK);
+  TEST_CHECK (Test_Pixel (130, 141) == BLACK);
+  TEST_CHECK (ST7789_View_Pop () == ST77XX_ERROR);      // stack empty
+
+  // clipped lines stay inside clip
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_Clip_Push (40, 180, 60, 200);
+  for (i = 0; i < Screen.height; i += 7) {
+    ST7789_DrawLine (&Lcd, 0, Screen.width - 1, i, Screen.height - 1 - i, WHITE);
+    ST7789_DrawLine (&Lcd, i % Screen.width, Screen.width - 1 - (i % Screen.width), 0, Screen.height - 1, RED);
+  }
+  ST7789_View_Pop ();
+  Clip_Save ();
+  TEST_CHECK (Clip_Same (40, 180, 60, 200, BLACK));
+  TEST_GOLDEN ("clip_lines");
+
+  return Test_Done ("clip");
+}
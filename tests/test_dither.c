@@ -0,0 +1,199 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Ordered dither & error diffusion
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_dither.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/pixel.h, tests/screens/dither_*.c, tests/screens/dither.ppm
+ * --------------------------------------------------------------------------------------------+
+ * @descr       ST7789_Pixel_Dither_565 / _444 & ST7789_Pixel_Diffuse against
+ *              words computed by hand (Bayer 4x4 of gray 100, Floyd-Steinberg
+ *              of 3x2 gray 8), ST7789_Pixel_RGB888 row dither equal to single
+ *              pixels, tools/scr2stream.py image of tests/screens/dither.ppm in
+ *              every mode & depth (make screens) equal to the C functions
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/pixel.h"
+#include "tests/screens/dither_ordered_565.c"           // DITHER_ORDERED_565
+#include "tests/screens/dither_ordered_444.c"           // DITHER_ORDERED_444
+#include "tests/screens/dither_diffusion_565.c"         // DITHER_DIFFUSION_565
+#include "tests/screens/dither_diffusion_444.c"         // DITHER_DIFFUSION_444
+
+#define IMAGE                 "tests/screens/dither.ppm"
+#define IMAGE_WIDTH           37
+#define IMAGE_HEIGHT          23
+#define BG                    0x1234                    // screen around image
+
+/** @enum Dither of stream */
+enum { ORDERED, DIFFUSION };
+
+/** @struct Stream compiled by scr2stream.py */
+struct S_CASE {
+  const uint8_t * stream;
+  uint8_t dither;
+  uint8_t depth;                                        // ST7789_PIXEL_565 / _444
+  const char * name;
+};
+
+/** @var Streams under test */
+static const struct S_CASE cases[] = {
+  { DITHER_ORDERED_565, ORDERED, ST7789_PIXEL_565, "ordered 565" },
+  { DITHER_ORDERED_444, ORDERED, ST7789_PIXEL_444, "ordered 444" },
+  { DITHER_DIFFUSION_565, DIFFUSION, ST7789_PIXEL_565, "diffusion 565" },
+  { DITHER_DIFFUSION_444, DIFFUSION, ST7789_PIXEL_444, "diffusion 444" }
+};
+
+/** @var Gray 100 + Bayer: 565 level 13 of red & blue at threshold >= 8, 444 level 7 at >= 12 */
+static const uint16_t bayer565[4][4] = {
+  { 0x632C, 0x6B2D, 0x632C, 0x6B2D },
+  { 0x6B2D, 0x632C, 0x6B2D, 0x632C },
+  { 0x632C, 0x6B2D, 0x632C, 0x6B2D },
+  { 0x6B2D, 0x632C, 0x6B2D, 0x632C }
+};
+static const uint16_t bayer444[4][4] = {
+  { 0x632C, 0x632C, 0x632C, 0x632C },
+  { 0x73AE, 0x632C, 0x73AE, 0x632C },
+  { 0x632C, 0x632C, 0x632C, 0x632C },
+  { 0x73AE, 0x632C, 0x73AE, 0x632C }
+};
+
+/** @var Gray 8 by Floyd-Steinberg in 444: errors 8, -6, 6 of row 0 leave 1, 0, 1 below */
+static const uint16_t diffused444[2][3] = {
+  { 0x0000, 0x1082, 0x0000 },
+  { 0x1082, 0x0000, 0x1082 }
+};
+
+/** @var Image, bytes R, G, B */
+static uint8_t image[IMAGE_HEIGHT][IMAGE_WIDTH * 3];
+
+/* Image of parity check, binary PPM of tests/screens */
+static int Dither_Load (void)
+{
+  FILE * file = fopen (IMAGE, "rb");
+  int width = 0, height = 0, read = 0;
+
+  if (file) {
+    if ((fscanf (file, "P6 %d %d 255", &width, &height) == 2) && (fgetc (file) != EOF) &&
+        (width == IMAGE_WIDTH) && (height == IMAGE_HEIGHT)) {
+      read = fread (image, sizeof (image), 1, file) == 1;
+    }
+    fclose (file);
+  }
+  if (!read) {
+    printf ("       no image %s %dx%d\n", IMAGE, IMAGE_WIDTH, IMAGE_HEIGHT);
+  }
+  return read;
+}
+
+/* Image converted by C functions of the driver */
+static void Dither_Expect (const struct S_CASE * check, uint16_t expect[IMAGE_HEIGHT][IMAGE_WIDTH])
+{
+  int16_t errors[3 * IMAGE_WIDTH];
+  const uint8_t * rgb;
+  int16_t x, y;
+
+  memset (errors, 0, sizeof (errors));
+  for (y = 0; y < IMAGE_HEIGHT; y++) {
+    if (check->dither == DIFFUSION) {
+      ST7789_Pixel_Diffuse (expect[y], image[y], IMAGE_WIDTH, errors, check->depth);
+      continue;
+    }
+    for (x = 0; x < IMAGE_WIDTH; x++) {
+      rgb = &image[y][3 * x];
+      expect[y][x] = (check->depth == ST7789_PIXEL_444)
+                     ? ST7789_Pixel_Dither_444 (rgb[0], rgb[1], rgb[2], ST7789_BAYER (x, y))
+                     : ST7789_Pixel_Dither_565 (rgb[0], rgb[1], rgb[2], ST7789_BAYER (x, y));
+    }
+  }
+}
+
+/* Played stream equals image converted in C, screen around untouched */
+static int Dither_Same (const struct S_CASE * check)
+{
+  uint16_t expect[IMAGE_HEIGHT][IMAGE_WIDTH];
+  uint16_t pixel, want;
+  int16_t x, y;
+
+  Dither_Expect (check, expect);
+  ST7789_ClearScreen (&Lcd, BG);
+  ST7789_Stream_Play (&Lcd, check->stream);
+  Test_Sync ();
+  for (y = 0; y <= IMAGE_HEIGHT; y++) {
+    for (x = 0; x <= IMAGE_WIDTH; x++) {
+      pixel = Test_Pixel (x, y);
+      want = ((x < IMAGE_WIDTH) && (y < IMAGE_HEIGHT)) ? expect[y][x] : BG;
+      if (pixel != want) {
+        printf ("       %s, pixel %d, %d: 0x%04x, expected 0x%04x\n", check->name, x, y, pixel, want);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const uint8_t gray[3 * 3] = { 8, 8, 8, 8, 8, 8, 8, 8, 8 };
+  uint8_t row[3 * IMAGE_WIDTH];
+  uint16_t words[IMAGE_WIDTH];
+  int16_t errors[3 * 3];
+  uint8_t x, y, bayer = 1, rows = 1, parity = 1;
+
+  Test_Init (ST77XX_ROTATE_0);
+
+  // Bayer 4x4 by hand, white saturates
+  for (y = 0; y < 4; y++) {
+    for (x = 0; x < 4; x++) {
+      bayer &= ST7789_Pixel_Dither_565 (100, 100, 100, ST7789_BAYER (x, y)) == bayer565[y][x];
+      bayer &= ST7789_Pixel_Dither_444 (100, 100, 100, ST7789_BAYER (x, y)) == bayer444[y][x];
+      bayer &= ST7789_Pixel_Dither_565 (255, 255, 255, ST7789_BAYER (x, y)) == 0xFFFF;
+      bayer &= ST7789_Pixel_Dither_444 (255, 255, 255, ST7789_BAYER (x, y)) == 0xFFFF;
+    }
+  }
+  TEST_CHECK (bayer);
+
+  // row conversion dithers as single pixels, every kernel tail included
+  TEST_CHECK (Dither_Load ());
+  for (y = 0; y < IMAGE_HEIGHT; y++) {
+    memcpy (row, image[y], sizeof (row));
+    ST7789_Pixel_RGB888 (words, row, IMAGE_WIDTH, y);
+    for (x = 0; x < IMAGE_WIDTH; x++) {
+      rows &= words[x] == ST7789_Pixel_Dither_565 (row[3 * x], row[3 * x + 1], row[3 * x + 2], ST7789_BAYER (x, y));
+    }
+  }
+  TEST_CHECK (rows);
+
+  // Floyd-Steinberg by hand, gray 8 exact in 565
+  memset (errors, 0, sizeof (errors));
+  for (y = 0; y < 2; y++) {
+    ST7789_Pixel_Diffuse (words, gray, 3, errors, ST7789_PIXEL_444);
+    TEST_CHECK (memcmp (words, diffused444[y], sizeof (diffused444[y])) == 0);
+  }
+  memset (errors, 0, sizeof (errors));
+  ST7789_Pixel_Diffuse (words, gray, 3, errors, ST7789_PIXEL_565);
+  TEST_CHECK ((words[0] == 0x0841) && (words[1] == 0x0841) && (words[2] == 0x0841));
+  TEST_CHECK ((errors[0] == 0) && (errors[4] == 0) && (errors[8] == 0));
+
+  // scr2stream.py quantize against C functions
+  for (x = 0; x < sizeof (cases) / sizeof (cases[0]); x++) {
+    parity &= Dither_Same (&cases[x]);
+  }
+  TEST_CHECK (parity);
+
+  return Test_Done ("dither");
+}
@@ -0,0 +1,161 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Display lists
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_dlist.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/dlist.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Every record into buffer of exact size & one byte less, guard bytes
+ *              behind buffer untouched, blits of record length above 16 bits,
+ *              replay of list against direct drawing
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/dlist.h"
+
+#define GUARD                 0xA5                      // byte behind list
+#define GUARDS                16
+
+/** @var List buffer with guard bytes, screen of direct drawing, font table */
+static uint8_t buffer[256 + GUARDS];
+static uint16_t direct[ST7789_HEIGHT][ST7789_WIDTH];
+static const struct S_FONT * const fonts[] = { &FONT_8 };
+
+/** @var Pixels of blit records */
+static const uint16_t pixels[] = { 0x1234, 0xF81F, 0x07E0, 0x001F, 0xFFE0, 0x8410 };
+
+/* Record of given kind */
+static uint8_t List_Record (struct S_LIST * list, uint8_t op)
+{
+  switch (op) {
+    case 0: return ST7789_List_Fill (list, 10, 60, 20, 40, RED);
+    case 1: return ST7789_List_HLine (list, 5, 200, 50, WHITE);
+    case 2: return ST7789_List_VLine (list, 100, 60, 250, BLUE);
+    case 3: return ST7789_List_Line (list, 0, 239, 279, 0, WHITE);
+    case 4: return ST7789_List_Text (list, 30, 100, WHITE, BLUE, 0, "AB");
+    case 5: return ST7789_List_Blit (list, 200, 200, 200, 200, pixels);
+    default: return ST7789_List_Blit (list, 150, 151, 150, 152, pixels);
+  }
+}
+
+/* Record into list of given size, guard bytes behind size */
+static uint8_t List_Fit (struct S_LIST * list, uint8_t op, uint16_t size)
+{
+  memset (buffer, GUARD, sizeof (buffer));
+  list->size = size;
+  ST7789_List_Clear (list);
+  return List_Record (list, op);
+}
+
+/* Guard bytes behind size untouched */
+static int List_Guarded (uint16_t size)
+{
+  uint16_t i;
+
+  for (i = size; i < sizeof (buffer); i++) {
+    if (buffer[i] != GUARD) {
+      printf ("       byte %u of %u written\n", i, size);
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const uint8_t lengths[] = { 11, 9, 9, 11, 13, 11, 21 };  // op, words, string, pixels
+  struct S_LIST list = { .buffer = buffer };
+  int16_t x, y;
+  uint16_t count;
+  uint8_t op, fit = 1, full = 1, wrap = 1, same = 1;
+
+  // exact size = record + closing LIST_OP_END, one byte less is full
+  for (op = 0; op < sizeof (lengths); op++) {
+    if ((List_Fit (&list, op, lengths[op] + 1) != ST77XX_SUCCESS) || (list.length != lengths[op]) ||
+        (buffer[lengths[op]] != LIST_OP_END) || !List_Guarded (lengths[op] + 1)) {
+      printf ("       record %u does not fit %u bytes\n", op, lengths[op] + 1);
+      fit = 0;
+    }
+    if ((List_Fit (&list, op, lengths[op]) != ST77XX_ERROR) || (list.length != 0) ||
+        (buffer[0] != LIST_OP_END) || !List_Guarded (lengths[op])) {
+      printf ("       record %u fits %u bytes\n", op, lengths[op]);
+      full = 0;
+    }
+  }
+  TEST_CHECK (fit);
+  TEST_CHECK (full);
+
+  // blit of 32764 .. 32767 pixels, record length above 16 bits
+  for (count = 32764; count <= 32767; count++) {
+    memset (buffer, GUARD, sizeof (buffer));
+    list.size = 64;
+    ST7789_List_Clear (&list);
+    if ((ST7789_List_Blit (&list, 0, count - 1, 0, 0, pixels) != ST77XX_ERROR) || (list.length != 0) ||
+        !List_Guarded (list.size)) {
+      printf ("       blit of %u pixels fits %u bytes\n", count, list.size);
+      wrap = 0;
+    }
+  }
+  TEST_CHECK (wrap);
+
+  // list filled to last byte, replay against direct drawing
+  Test_Init (ST77XX_ROTATE_0);
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_FillRect (&Lcd, 10, 60, 20, 40, RED);
+  ST7789_DrawLine (&Lcd, 5, 200, 50, 50, WHITE);
+  ST7789_DrawLine (&Lcd, 100, 100, 60, 250, BLUE);
+  ST7789_DrawLine (&Lcd, 0, 239, 279, 0, WHITE);
+  ST7789_SetPosition (30, 100);
+  ST7789_Text_DrawString (&Lcd, &FONT_8, "AB", WHITE, BLUE);
+  ST7789_DrawImage (&Lcd, 200, 200, 200, 200, pixels);
+  ST7789_DrawImage (&Lcd, 150, 151, 150, 152, pixels);
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      direct[y][x] = Test_Pixel (x, y);
+    }
+  }
+
+  memset (buffer, GUARD, sizeof (buffer));
+  list.size = 0;
+  for (op = 0; op < sizeof (lengths); op++) {
+    list.size += lengths[op];
+  }
+  list.size++;                                          // closing LIST_OP_END
+  ST7789_List_Clear (&list);
+  for (op = 0; op < sizeof (lengths); op++) {
+    TEST_CHECK (List_Record (&list, op) == ST77XX_SUCCESS);
+  }
+  TEST_CHECK (List_Record (&list, 1) == ST77XX_ERROR);  // full
+  TEST_CHECK (List_Guarded (list.size));
+
+  ST7789_ClearScreen (&Lcd, BLACK);
+  TEST_CHECK (ST7789_List_Play (&Lcd, buffer, LIST_RAM, fonts) == ST77XX_SUCCESS);
+  Test_Sync ();
+  for (y = 0; (y < Screen.height) && same; y++) {
+    for (x = 0; (x < Screen.width) && same; x++) {
+      if (Test_Pixel (x, y) != direct[y][x]) {
+        printf ("       pixel %d, %d: 0x%04x, expected 0x%04x\n", x, y, Test_Pixel (x, y), direct[y][x]);
+        same = 0;
+      }
+    }
+  }
+  TEST_CHECK (same);
+
+  return Test_Done ("dlist");
+}
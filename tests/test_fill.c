@@ -0,0 +1,207 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Gradient & pattern fills
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_fill.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/fill.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Every gradient, stripe, checker & pattern fill against per-pixel
+ *              reference of this test (8.8 ramp in 32 bits, phase from top left
+ *              corner), whole, cut by clip rectangle, in viewport with origin,
+ *              corners reversed, one column & one row gradients
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/fill.h"
+
+#define BG                    0x1234                    // screen around fill
+#define FILL_FG               RED
+#define FILL_BG               BLUE
+#define FILL_FROM             RGB888 (10, 250, 30)      // gradient ends
+#define FILL_TO               RGB888 (240, 5, 128)
+
+/** @enum Kind of fill */
+enum { GRADIENT, CHECKER, STRIPES, PATTERN };
+
+/** @struct Fill under test */
+struct S_CASE {
+  uint8_t kind;
+  uint8_t mode;                                         // gradient or stripes mode
+  uint8_t size;                                         // cell or stripe width
+  const uint8_t * pattern;
+};
+
+/** @var Fills under test */
+static const struct S_CASE cases[] = {
+  { GRADIENT, GRADIENT_HORIZONTAL, 0, NULL },
+  { GRADIENT, GRADIENT_VERTICAL, 0, NULL },
+  { GRADIENT, GRADIENT_HORIZONTAL | GRADIENT_DITHER, 0, NULL },
+  { GRADIENT, GRADIENT_VERTICAL | GRADIENT_DITHER, 0, NULL },
+  { CHECKER, 0, 5, NULL },
+  { STRIPES, STRIPES_HORIZONTAL, 3, NULL },
+  { STRIPES, STRIPES_VERTICAL, 4, NULL },
+  { STRIPES, STRIPES_DIAGONAL, 6, NULL },
+  { PATTERN, 0, 0, PATTERN_DOTS },
+  { PATTERN, 0, 0, PATTERN_GRID },
+  { PATTERN, 0, 0, PATTERN_HATCH },
+  { PATTERN, 0, 0, PATTERN_BRICK }
+};
+
+/** @var Rectangle of fill & clip on screen, ordered */
+static int16_t left, right, top, bottom;
+static int16_t clipXs, clipXe, clipYs, clipYe;
+
+/* Channel level at step k of steps, 8.8 step truncated toward zero, half level added */
+static uint8_t Fill_Level (uint8_t shift, int32_t steps, int32_t k)
+{
+  int32_t from = (FILL_FROM >> shift) & 0xFF, to = (FILL_TO >> shift) & 0xFF;
+  int32_t step = steps ? (to - from) * 256 / steps : 0;
+
+  return (uint8_t) ((from * 256 + 128 + step * k) >> 8);
+}
+
+/* Expected pixel at screen position */
+static uint16_t Fill_Expect (const struct S_CASE * fill, int16_t x, int16_t y)
+{
+  int32_t col = x - left, row = y - top, steps, k;
+  uint8_t r, g, b, on = 0;
+
+  if ((x < left) || (x > right) || (y < top) || (y > bottom) ||
+      (x < clipXs) || (x > clipXe) || (y < clipYs) || (y > clipYe)) {
+    return BG;
+  }
+  switch (fill->kind) {
+    case GRADIENT:
+      steps = (fill->mode & GRADIENT_VERTICAL) ? bottom - top : right - left;
+      k = (fill->mode & GRADIENT_VERTICAL) ? row : col;
+      r = Fill_Level (16, steps, k);
+      g = Fill_Level (8, steps, k);
+      b = Fill_Level (0, steps, k);
+      if (fill->mode & GRADIENT_DITHER) {
+        return ST7789_Pixel_Dither_565 (r, g, b, BAYER_4X4[y & 3][x & 3]);
+      }
+      return ((uint16_t) (r >> 3) << 11) | ((uint16_t) (g >> 2) << 5) | (b >> 3);
+    case CHECKER:
+      on = ((col / fill->size + row / fill->size) & 1) == 0;
+      break;
+    case STRIPES:
+      if (fill->mode == STRIPES_HORIZONTAL) on = (row % (2 * fill->size)) < fill->size;
+      if (fill->mode == STRIPES_VERTICAL) on = (col % (2 * fill->size)) < fill->size;
+      if (fill->mode == STRIPES_DIAGONAL) on = ((col + row) % (2 * fill->size)) < fill->size;
+      break;
+    default:
+      on = (fill->pattern[row & 7] & (0x80 >> (col & 7))) != 0;
+      break;
+  }
+  return on ? FILL_FG : FILL_BG;
+}
+
+/* Fill of rectangle in view coordinates */
+static uint8_t Fill_Draw (const struct S_CASE * fill, int16_t xs, int16_t xe, int16_t ys, int16_t ye)
+{
+  switch (fill->kind) {
+    case GRADIENT: return ST7789_FillGradient (&Lcd, xs, xe, ys, ye, FILL_FROM, FILL_TO, fill->mode);
+    case CHECKER: return ST7789_FillChecker (&Lcd, xs, xe, ys, ye, fill->size, FILL_FG, FILL_BG);
+    case STRIPES: return ST7789_FillStripes (&Lcd, xs, xe, ys, ye, fill->size, fill->mode, FILL_FG, FILL_BG);
+    default: return ST7789_FillPattern (&Lcd, xs, xe, ys, ye, fill->pattern, FILL_FG, FILL_BG);
+  }
+}
+
+/* Screen equals reference, fill of rectangle xs .. ye in view at ox, oy */
+static int Fill_Same (const struct S_CASE * fill, const char * where, int16_t ox, int16_t oy,
+                      int16_t xs, int16_t xe, int16_t ys, int16_t ye)
+{
+  int16_t x, y;
+  uint16_t expect;
+
+  left = ((xs < xe) ? xs : xe) + ox;
+  right = ((xs < xe) ? xe : xs) + ox;
+  top = ((ys < ye) ? ys : ye) + oy;
+  bottom = ((ys < ye) ? ye : ys) + oy;
+  Fill_Draw (fill, xs, xe, ys, ye);
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      expect = Fill_Expect (fill, x, y);
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       fill %u mode %u %s, pixel %d, %d: 0x%04x, expected 0x%04x\n",
+                fill->kind, fill->mode, where, x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Screen cleared, clip of reference */
+static void Fill_Clear (int16_t xs, int16_t xe, int16_t ys, int16_t ye)
+{
+  ST7789_View_Reset ();
+  ST7789_ClearScreen (&Lcd, BG);
+  clipXs = xs; clipXe = xe;
+  clipYs = ys; clipYe = ye;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const struct S_CASE * fill;
+  const struct S_CASE line = { GRADIENT, GRADIENT_HORIZONTAL, 0, NULL };
+  uint8_t i, whole = 1, cut = 1, view = 1, reversed = 1, steps = 1;
+
+  Test_Init (ST77XX_ROTATE_0);
+
+  for (i = 0; i < sizeof (cases) / sizeof (cases[0]); i++) {
+    fill = &cases[i];
+
+    // whole rectangle
+    Fill_Clear (0, Screen.width - 1, 0, Screen.height - 1);
+    whole &= Fill_Same (fill, "whole", 0, 0, 13, 200, 21, 157);
+
+    // clip rectangle cuts every side, phase & ramp keep anchor
+    Fill_Clear (37, 150, 44, 131);
+    ST7789_Clip_Push (37, 150, 44, 131);
+    cut &= Fill_Same (fill, "clipped", 0, 0, 13, 200, 21, 157);
+
+    // viewport with origin, rectangle partly outside view
+    Fill_Clear (30, 200, 40, 250);
+    ST7789_View_Push (30, 200, 40, 250);
+    view &= Fill_Same (fill, "in view", 30, 40, -11, 120, -7, 100);
+
+    // corners reversed, same as ordered
+    Fill_Clear (0, Screen.width - 1, 0, Screen.height - 1);
+    reversed &= Fill_Same (fill, "reversed", 0, 0, 200, 13, 157, 21);
+  }
+  ST7789_View_Reset ();
+  TEST_CHECK (whole);
+  TEST_CHECK (cut);
+  TEST_CHECK (view);
+  TEST_CHECK (reversed);
+
+  // one column & one row, no step
+  Fill_Clear (0, Screen.width - 1, 0, Screen.height - 1);
+  steps &= Fill_Same (&line, "one column", 0, 0, 50, 50, 10, 60);
+  Fill_Clear (0, Screen.width - 1, 0, Screen.height - 1);
+  steps &= Fill_Same (&cases[1], "one row", 0, 0, 10, 60, 50, 50);
+  TEST_CHECK (steps);
+
+  // nothing visible, unknown stripes
+  TEST_CHECK (ST7789_FillGradient (&Lcd, 300, 310, 0, 9, FILL_FROM, FILL_TO, GRADIENT_HORIZONTAL) == ST77XX_ERROR);
+  TEST_CHECK (ST7789_FillStripes (&Lcd, 0, 9, 0, 9, 2, STRIPES_DIAGONAL + 1, FILL_FG, FILL_BG) == ST77XX_ERROR);
+
+  return Test_Done ("fill");
+}
@@ -0,0 +1,115 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Frame buffer flush
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_frame.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/frame.h, built with -DST7789_FRAMEBUFFER by make test
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Bytes on bus of ST7789_Flush: unchanged frame & pixel drawn with
+ *              same color send nothing, one pixel one window, two regions one
+ *              window each, overlapping regions merged, in rotation 0 & 90,
+ *              display RAM equal to frame after every flush
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+
+#define WINDOW                11                        // CASET, RASET & RAMWR bytes
+#define BG                    0x1234
+
+/** @var Expected screen, screen coordinates */
+static uint16_t expect[HAL_MOCK_HEIGHT][HAL_MOCK_HEIGHT];
+
+/* Rectangle into frame & expected screen */
+static void Frame_Rect (int16_t xs, int16_t xe, int16_t ys, int16_t ye, uint16_t color)
+{
+  int16_t x, y;
+
+  ST7789_FillRect (&Lcd, xs, xe, ys, ye, color);
+  for (y = ys; y <= ye; y++) {
+    for (x = xs; x <= xe; x++) {
+      expect[y][x] = color;
+    }
+  }
+}
+
+/* Bytes on bus of flush, display RAM equals expected screen */
+static uint32_t Frame_Flush (uint8_t * same)
+{
+  uint32_t bytes = Mock.clocks;
+  int16_t x, y;
+
+  ST7789_Flush (&Lcd);
+  bytes = Mock.clocks - bytes;
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      if (Test_Pixel (x, y) != expect[y][x]) {
+        printf ("       pixel %d, %d: 0x%04x, expected 0x%04x\n", x, y, Test_Pixel (x, y), expect[y][x]);
+        *same = 0;
+        return bytes;
+      }
+    }
+  }
+  return bytes;
+}
+
+/* Flush scenarios in orientation */
+static void Frame_Scenes (uint8_t madctl)
+{
+  uint8_t same = 1;
+  uint32_t bytes;
+
+  Test_Init (madctl);
+  Frame_Rect (0, Screen.width - 1, 0, Screen.height - 1, BG);
+  Frame_Flush (&same);                                  // first flush, whole screen
+
+  // unchanged frame, nothing sent
+  TEST_CHECK (Frame_Flush (&same) == 0);
+
+  // pixel drawn with its own color, nothing sent
+  ST7789_DrawPixel (&Lcd, 17, 23, BG);
+  TEST_CHECK (Frame_Flush (&same) == 0);
+
+  // one pixel, one window of one pixel
+  ST7789_DrawPixel (&Lcd, 17, 23, RED);
+  expect[23][17] = RED;
+  bytes = Frame_Flush (&same);
+  printf ("  rotation 0x%02x, one pixel, bytes on bus: %u\n", madctl, bytes);
+  TEST_CHECK (bytes == WINDOW + 2);
+
+  // two regions in different rows, one window each
+  Frame_Rect (10, 19, 30, 34, BLUE);
+  Frame_Rect (100, 129, 150, 151, WHITE);
+  bytes = Frame_Flush (&same);
+  TEST_CHECK (bytes == 2 * WINDOW + 2 * (10 * 5 + 30 * 2));
+
+  // regions overlapping in neighbouring rows & columns, one window over both
+  Frame_Rect (5, 9, 60, 63, RED);
+  Frame_Rect (8, 20, 64, 66, RED);
+  bytes = Frame_Flush (&same);
+  TEST_CHECK (bytes == WINDOW + 2 * (16 * 7));
+
+  TEST_CHECK (same);
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  Frame_Scenes (ST77XX_ROTATE_0);
+  Frame_Scenes (ST77XX_ROTATE_90);
+
+  return Test_Done ("frame");
+}
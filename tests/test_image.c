@@ -0,0 +1,135 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Images & readback
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_image.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       ST7789_DrawImage whole & clipped, ST7789_ReadRect of RAMRD (RGB666
+ *              holds every RGB565 value), corners reversed, save-under &
+ *              restore, image golden
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+
+#define IMAGE_W               50                        // test image
+#define IMAGE_H               40
+
+/** @var Image & readback */
+static uint16_t image[IMAGE_W * IMAGE_H];
+static uint16_t back[IMAGE_W * IMAGE_H];
+
+/* Part of image at screen position */
+static int Image_Same (int16_t x, int16_t y, int16_t left, int16_t top, int16_t w, int16_t h)
+{
+  int16_t i, j;
+
+  Test_Sync ();
+  for (j = 0; j < h; j++) {
+    for (i = 0; i < w; i++) {
+      if (Test_Pixel (x + i, y + j) != image[(top + j) * IMAGE_W + left + i]) {
+        printf ("       pixel %d, %d: 0x%04x\n", x + i, y + j, Test_Pixel (x + i, y + j));
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  int16_t i, w = IMAGE_W - 1, h = IMAGE_H - 1;
+
+  for (i = 0; i < IMAGE_W * IMAGE_H; i++) {
+    image[i] = (uint16_t) (i * 2654435761u >> 16);
+  }
+  Test_Init (ST77XX_ROTATE_0);
+  ST7789_ClearScreen (&Lcd, BLACK);
+
+  // whole image, every pixel
+  TEST_CHECK (ST7789_DrawImage (&Lcd, 10, 10 + w, 20, 20 + h, image) == ST77XX_SUCCESS);
+  TEST_CHECK (Image_Same (10, 20, 0, 0, IMAGE_W, IMAGE_H));
+  TEST_CHECK (Test_Pixel (9, 20) == BLACK);
+  TEST_CHECK (Test_Pixel (10 + IMAGE_W, 20) == BLACK);
+
+  // readback of every pixel
+  Test_Sync ();
+  TEST_CHECK (ST7789_ReadRect (&Lcd, 10, 10 + w, 20, 20 + h, back) == ST77XX_SUCCESS);
+  TEST_CHECK (memcmp (back, image, sizeof (image)) == 0);
+
+  // clipped by right & bottom edge of screen
+  ST7789_DrawImage (&Lcd, Screen.width - 20, Screen.width - 20 + w, Screen.height - 15, Screen.height - 15 + h, image);
+  TEST_CHECK (Image_Same (Screen.width - 20, Screen.height - 15, 0, 0, 20, 15));
+
+  // clipped by clip rectangle on all sides
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_Clip_Push (105, 130, 208, 230);
+  ST7789_DrawImage (&Lcd, 100, 100 + w, 200, 200 + h, image);
+  ST7789_View_Pop ();
+  TEST_CHECK (Image_Same (105, 208, 5, 8, 26, 23));
+  TEST_CHECK (Test_Pixel (104, 208) == BLACK);
+  TEST_CHECK (Test_Pixel (131, 230) == BLACK);
+  TEST_CHECK (Test_Pixel (105, 231) == BLACK);
+
+  // image starting left & above screen
+  ST7789_ClearScreen (&Lcd, BLACK);
+  TEST_CHECK (ST7789_DrawImage (&Lcd, -5, -5 + w, -3, -3 + h, image) == ST77XX_SUCCESS);
+  TEST_CHECK (Image_Same (0, 0, 5, 3, IMAGE_W - 5, IMAGE_H - 3));
+  memset (back, 0, sizeof (back));
+  TEST_CHECK (ST7789_ReadRect (&Lcd, -5, -5 + w, -3, -3 + h, back) == ST77XX_SUCCESS);
+  TEST_CHECK (back[3 * IMAGE_W + 5] == image[3 * IMAGE_W + 5]);
+  TEST_CHECK (back[IMAGE_W * IMAGE_H - 1] == image[IMAGE_W * IMAGE_H - 1]);
+  TEST_CHECK (back[3 * IMAGE_W + 4] == 0);              // outside screen, not read
+
+  // corners reversed, same as ordered
+  ST7789_ClearScreen (&Lcd, BLACK);
+  TEST_CHECK (ST7789_DrawImage (&Lcd, 10 + w, 10, 20 + h, 20, image) == ST77XX_SUCCESS);
+  TEST_CHECK (Image_Same (10, 20, 0, 0, IMAGE_W, IMAGE_H));
+  TEST_CHECK (Test_Pixel (9, 20) == BLACK);
+  memset (back, 0, sizeof (back));
+  TEST_CHECK (ST7789_ReadRect (&Lcd, 10 + w, 10, 20, 20 + h, back) == ST77XX_SUCCESS);
+  TEST_CHECK (memcmp (back, image, sizeof (image)) == 0);
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_Clip_Push (15, 40, 25, 50);
+  ST7789_DrawImage (&Lcd, 10 + w, 10, 20 + h, 20, image);
+  ST7789_View_Pop ();
+  TEST_CHECK (Image_Same (15, 25, 5, 5, 26, 26));
+  TEST_CHECK (Test_Pixel (14, 25) == BLACK);
+
+  // image out of clip
+  TEST_CHECK (ST7789_DrawImage (&Lcd, Screen.width, Screen.width + w, 0, h, image) == ST77XX_ERROR);
+
+  // save-under & restore
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_DrawImage (&Lcd, 60, 60 + w, 60, 60 + h, image);
+  Test_Sync ();
+  ST7789_SaveRect (&Lcd, 60, 60 + w, 60, 60 + h, back);
+  ST7789_FillRect (&Lcd, 50, 150, 50, 150, RED);
+  ST7789_RestoreRect (&Lcd, 60, 60 + w, 60, 60 + h, back);
+  TEST_CHECK (Image_Same (60, 60, 0, 0, IMAGE_W, IMAGE_H));
+  TEST_CHECK (Test_Pixel (59, 60) == RED);
+
+  // tiles of image
+  ST7789_ClearScreen (&Lcd, WHITE);
+  for (i = 0; i < 5; i++) {
+    ST7789_DrawImage (&Lcd, 20 + i * 41, 20 + i * 41 + w, 30 + i * 37, 30 + i * 37 + h, image);
+  }
+  TEST_GOLDEN ("image_tiles");
+
+  return Test_Done ("image");
+}
@@ -0,0 +1,158 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Lines & pixels
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_lines.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       ST7789_DrawLine against per pixel Bresenham of the original driver,
+ *              one window per run, fast lines & pixels against expected screen,
+ *              line fan golden
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdlib.h>
+#include "test.h"
+
+/** @var Expected screen */
+static uint16_t expect[ST7789_HEIGHT][ST7789_WIDTH];
+
+/* Screen equals expected */
+static int Lines_Same (void)
+{
+  int16_t x, y;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      if (Test_Pixel (x, y) != expect[y][x]) {
+        printf ("       pixel %d, %d: 0x%04x, expected 0x%04x\n", x, y, Test_Pixel (x, y), expect[y][x]);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Bresenham of original driver, pixel by pixel into expected screen */
+static void Lines_Reference (int16_t x1, int16_t x2, int16_t y1, int16_t y2, uint16_t color)
+{
+  int16_t D;
+  int16_t delta_x = x2 - x1, delta_y = y2 - y1;
+  int16_t trace_x = 1, trace_y = 1;
+
+  if (delta_x < 0) { delta_x = -delta_x; trace_x = -1; }
+  if (delta_y < 0) { delta_y = -delta_y; trace_y = -1; }
+
+  expect[y1][x1] = color;
+  if (delta_y < delta_x) {
+    D = (delta_y << 1) - delta_x;
+    while (x1 != x2) {
+      x1 += trace_x;
+      if (D >= 0) {
+        y1 += trace_y;
+        D -= 2 * delta_x;
+      }
+      D += 2 * delta_y;
+      expect[y1][x1] = color;
+    }
+  } else {
+    D = delta_y - (delta_x << 1);
+    while (y1 != y2) {
+      y1 += trace_y;
+      if (D <= 0) {
+        x1 += trace_x;
+        D += 2 * delta_y;
+      }
+      D -= 2 * delta_x;
+      expect[y1][x1] = color;
+    }
+  }
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  int16_t x1, x2, y1, y2, i;
+#if !defined(ST7789_FRAMEBUFFER)
+  uint32_t lists;
+#endif
+
+  Test_Init (ST77XX_ROTATE_0);
+  ST7789_ClearScreen (&Lcd, BLACK);
+  memset (expect, 0, sizeof (expect));
+
+  // random lines, drawn & compared, then erased the same way
+  srand (1);
+  for (i = 0; i < 300; i++) {
+    x1 = rand () % Screen.width;
+    x2 = (i % 10 == 0) ? x1 : rand () % Screen.width;   // some vertical
+    y1 = rand () % Screen.height;
+    y2 = (i % 10 == 5) ? y1 : rand () % Screen.height;  // some horizontal
+    ST7789_DrawLine (&Lcd, x1, x2, y1, y2, WHITE);
+    Lines_Reference (x1, x2, y1, y2, WHITE);
+    if (!TEST_CHECK (Lines_Same ())) {
+      printf ("       line %d, %d -> %d, %d\n", x1, y1, x2, y2);
+      break;
+    }
+    ST7789_DrawLine (&Lcd, x1, x2, y1, y2, BLACK);
+    Lines_Reference (x1, x2, y1, y2, BLACK);
+  }
+
+#if !defined(ST7789_FRAMEBUFFER)
+  // one window per run of row or column
+  lists = Mock.lists;
+  ST7789_DrawLine (&Lcd, 0, 200, 0, 10, WHITE);
+  TEST_CHECK (Mock.lists - lists == 11);
+  lists = Mock.lists;
+  ST7789_DrawLine (&Lcd, 15, 5, 0, 200, WHITE);
+  TEST_CHECK (Mock.lists - lists == 11);
+  ST7789_DrawLine (&Lcd, 0, 200, 0, 10, BLACK);
+  ST7789_DrawLine (&Lcd, 15, 5, 0, 200, BLACK);
+#endif
+
+  // fast lines, both ends inclusive, any order
+  ST7789_FastLineHorizontal (&Lcd, 10, 20, 5, RED);
+  ST7789_FastLineHorizontal (&Lcd, 40, 30, 6, RED);
+  ST7789_FastLineVertical (&Lcd, 50, 10, 20, BLUE);
+  ST7789_FastLineVertical (&Lcd, 51, 40, 30, BLUE);
+  ST7789_DrawPixel (&Lcd, 0, 0, WHITE);
+  ST7789_DrawPixel (&Lcd, Screen.width - 1, Screen.height - 1, WHITE);
+  for (i = 10; i <= 20; i++) expect[5][i] = RED;
+  for (i = 30; i <= 40; i++) expect[6][i] = RED;
+  for (i = 10; i <= 20; i++) expect[i][50] = BLUE;
+  for (i = 30; i <= 40; i++) expect[i][51] = BLUE;
+  expect[0][0] = WHITE;
+  expect[Screen.height - 1][Screen.width - 1] = WHITE;
+  TEST_CHECK (Lines_Same ());
+
+  // off screen, nothing drawn
+  ST7789_DrawPixel (&Lcd, Screen.width, 0, WHITE);
+  ST7789_FastLineHorizontal (&Lcd, 0, 10, Screen.height, WHITE);
+  TEST_CHECK (Lines_Same ());
+
+  // fan of main.c
+  ST7789_ClearScreen (&Lcd, WHITE);
+  for (i = 0; i < Screen.height; i += 5) {
+    ST7789_DrawLine (&Lcd, 0, Screen.width, 0, i, RED);
+  }
+  for (i = 0; i < Screen.height; i += 5) {
+    ST7789_DrawLine (&Lcd, 0, Screen.width, i, 0, BLUE);
+  }
+  TEST_GOLDEN ("lines_fan");
+
+  return Test_Done ("lines");
+}
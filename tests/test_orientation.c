@@ -0,0 +1,131 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Orientations
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_orientation.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       All 8 MADCTL values on a panel with different offsets on each side,
+ *              screen origin & direction in RAM, every visible pixel, nothing
+ *              outside the glass, repeated ST7789_Set_MADCTL
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+
+#define PANEL_W               200                       // glass of test
+#define PANEL_H               270
+#define PANEL_X               10                        // 30 columns right
+#define PANEL_Y               15                        // 35 rows below
+
+/** @var Screen sized image, every pixel different */
+static uint16_t image[PANEL_W * PANEL_H];
+
+/** @var MADCTL, RAM row & column of screen origin, RAM step of screen x */
+static const struct {
+  uint8_t madctl;
+  uint16_t row;
+  uint16_t col;
+  int8_t stepRow;
+  int8_t stepCol;
+} orientations[] = {
+  { 0x00, PANEL_Y,                PANEL_X,                0,  1 },
+  { 0x40, PANEL_Y,                PANEL_X + PANEL_W - 1,  0, -1 },
+  { 0x80, PANEL_Y + PANEL_H - 1,  PANEL_X,                0,  1 },
+  { 0xC0, PANEL_Y + PANEL_H - 1,  PANEL_X + PANEL_W - 1,  0, -1 },
+  { 0x20, PANEL_Y,                PANEL_X,                1,  0 },
+  { 0x60, PANEL_Y,                PANEL_X + PANEL_W - 1,  1,  0 },
+  { 0xA0, PANEL_Y + PANEL_H - 1,  PANEL_X,               -1,  0 },
+  { 0xE0, PANEL_Y + PANEL_H - 1,  PANEL_X + PANEL_W - 1, -1,  0 }
+};
+
+/* Every screen pixel holds its image value */
+static int Orientation_Same (void)
+{
+  int16_t x, y;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      if (Test_Pixel (x, y) != image[y * Screen.width + x]) {
+        printf ("       madctl 0x%02x, pixel %d, %d: 0x%04x\n", Screen.madctl, x, y, Test_Pixel (x, y));
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Written pixels of display RAM */
+static uint32_t Orientation_Written (void)
+{
+  uint32_t count = 0;
+  uint16_t x, y;
+
+  for (y = 0; y < HAL_MOCK_HEIGHT; y++) {
+    for (x = 0; x < HAL_MOCK_WIDTH; x++) {
+      if (Mock.gram[y][x]) count++;
+    }
+  }
+  return count;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  uint32_t i;
+  uint16_t width, height, offsetX, offsetY;
+
+  for (i = 0; i < PANEL_W * PANEL_H; i++) {
+    image[i] = (uint16_t) (i + 1);                      // none is zero
+  }
+  Panel.width = PANEL_W;
+  Panel.height = PANEL_H;
+  Panel.offsetX = PANEL_X;
+  Panel.offsetY = PANEL_Y;
+
+  for (i = 0; i < sizeof (orientations) / sizeof (orientations[0]); i++) {
+    Test_Init (orientations[i].madctl);
+
+    // screen size
+    if (orientations[i].madctl & ST77XX_XY_CHANGE) {
+      TEST_CHECK ((Screen.width == PANEL_H) && (Screen.height == PANEL_W));
+    } else {
+      TEST_CHECK ((Screen.width == PANEL_W) && (Screen.height == PANEL_H));
+    }
+
+    // whole screen of different pixels
+    TEST_CHECK (ST7789_DrawImage (&Lcd, 0, Screen.width - 1, 0, Screen.height - 1, image) == ST77XX_SUCCESS);
+    Test_Sync ();
+    TEST_CHECK (Mock.gram[orientations[i].row][orientations[i].col] == image[0]);
+    TEST_CHECK (Mock.gram[orientations[i].row + orientations[i].stepRow]
+                         [orientations[i].col + orientations[i].stepCol] == image[1]);
+    TEST_CHECK (Orientation_Same ());
+    TEST_CHECK (Orientation_Written () == PANEL_W * PANEL_H);
+
+    // repeated MADCTL, same screen
+    width = Screen.width;
+    height = Screen.height;
+    offsetX = Screen.offsetX;
+    offsetY = Screen.offsetY;
+    ST7789_Set_MADCTL (&Lcd, orientations[i].madctl);
+    ST7789_Set_MADCTL (&Lcd, orientations[i].madctl);
+    TEST_CHECK ((Screen.width == width) && (Screen.height == height));
+    TEST_CHECK ((Screen.offsetX == offsetX) && (Screen.offsetY == offsetY));
+  }
+
+  return Test_Done ("orientation");
+}
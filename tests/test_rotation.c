@@ -0,0 +1,78 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Rotations
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_rotation.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Same scene in all four rotations, screen size & golden of each
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+
+#define IMAGE_W               32                        // test image
+#define IMAGE_H               24
+
+/** @var Test image */
+static uint16_t image[IMAGE_W * IMAGE_H];
+
+/** @var Rotations, references tests/golden/<name>.ppm */
+static const struct {
+  const char * name;
+  uint8_t madctl;
+  uint16_t width;
+  uint16_t height;
+} rotations[] = {
+  { "rotate_0",   ST77XX_ROTATE_0,   ST7789_PANEL_WIDTH,  ST7789_PANEL_HEIGHT },
+  { "rotate_90",  ST77XX_ROTATE_90,  ST7789_PANEL_HEIGHT, ST7789_PANEL_WIDTH  },
+  { "rotate_180", ST77XX_ROTATE_180, ST7789_PANEL_WIDTH,  ST7789_PANEL_HEIGHT },
+  { "rotate_270", ST77XX_ROTATE_270, ST7789_PANEL_HEIGHT, ST7789_PANEL_WIDTH  }
+};
+
+/* Scene with marked corners, asymmetric in both axes */
+static void Rotation_Scene (void)
+{
+  int16_t w = Screen.width - 1, h = Screen.height - 1;
+
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_FillRect (&Lcd, 0, 19, 0, 9, RED);             // top left
+  ST7789_FillRect (&Lcd, w - 9, w, 0, 4, 0x07E0);       // top right, green
+  ST7789_FillRect (&Lcd, 0, 4, h - 9, h, BLUE);         // bottom left
+  ST7789_DrawLine (&Lcd, 0, w, 0, h, WHITE);
+  ST7789_DrawImage (&Lcd, 40, 40 + IMAGE_W - 1, 30, 30 + IMAGE_H - 1, image);
+  ST7789_SetPosition (30, 60);
+  ST7789_DrawString (&Lcd, "ROTATE", WHITE, X2);
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  uint8_t i;
+
+  for (i = 0; i < IMAGE_H; i++) {
+    memset (&image[i * IMAGE_W], i * 10, IMAGE_W * sizeof (uint16_t));
+  }
+  for (i = 0; i < sizeof (rotations) / sizeof (rotations[0]); i++) {
+    Test_Init (rotations[i].madctl);
+    TEST_CHECK (Screen.width == rotations[i].width);
+    TEST_CHECK (Screen.height == rotations[i].height);
+    Rotation_Scene ();
+    TEST_GOLDEN (rotations[i].name);
+  }
+
+  return Test_Done ("rotation");
+}
@@ -0,0 +1,227 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Filled shapes
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_shape.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/shape.h, src/trig.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       300 random polygons & triangles, partly off screen, against exact
+ *              even-odd test of pixel centers, 300 random ring segments against
+ *              floating-point distance & angle and against exact per-pixel test
+ *              of the integer ring & Q14 wedge rule
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <math.h>
+#include <stdlib.h>
+#include "test.h"
+#include "src/shape.h"
+#include "src/trig.h"
+
+#define SHAPES                300                       // random shapes of each kind
+#define RAY_MARGIN            0.01                      // px off boundary ray, Q14 sine
+
+/** @var Vertices of polygon */
+static struct S_POINT vertices[ST7789_POLYGON_EDGES];
+
+/* Random number min .. max */
+static int16_t Shape_Random (int16_t min, int16_t max)
+{
+  return min + rand () % (max - min + 1);
+}
+
+/* Center of pixel inside polygon, even-odd, crossing at or left of center */
+static int Shape_Inside (uint8_t n, int16_t x, int16_t y)
+{
+  const struct S_POINT * a;
+  const struct S_POINT * b;
+  int32_t d;
+  uint8_t i, odd = 0;
+
+  for (i = 0; i < n; i++) {
+    a = &vertices[i];
+    b = &vertices[(i + 1) % n];
+    if (a->y > b->y) {
+      a = b;
+      b = &vertices[i];
+    }
+    if ((y < a->y) || (y >= b->y)) {
+      continue;                                         // edge not on row, horizontal too
+    }
+    d = b->y - a->y;
+    if ((int32_t) a->x * d + (int32_t) (b->x - a->x) * (y - a->y) <= (int32_t) x * d) {
+      odd ^= 1;
+    }
+  }
+  return odd;
+}
+
+/* Screen equals polygon of first n vertices */
+static int Shape_Polygon_Same (uint8_t n)
+{
+  int16_t x, y;
+  uint16_t expect;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      expect = Shape_Inside (n, x, y) ? WHITE : BLACK;
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       %u vertices, pixel %d, %d: 0x%04x, expected 0x%04x\n", n, x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Distance of point from ray of angle, infinite when behind center */
+static double Shape_Ray (double x, double y, double angle)
+{
+  double c = cos (angle * M_PI / 180), s = sin (angle * M_PI / 180);
+
+  return (x * c + y * s < 0) ? INFINITY : fabs (x * s - y * c);
+}
+
+/* Screen equals ring segment, pixels on boundary rays skipped */
+static int Shape_Arc_Same (int16_t cx, int16_t cy, uint8_t inner, uint8_t outer, int16_t start, int16_t sweep)
+{
+  int16_t x, y;
+  uint16_t expect;
+  double dx, dy, distance, angle;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      dx = x - cx;
+      dy = y - cy;
+      distance = sqrt (dx * dx + dy * dy);
+      angle = fmod (atan2 (dy, dx) * 180 / M_PI - start, 360);
+      if (angle < 0) angle += 360;
+      expect = BLACK;
+      if ((distance > inner - 0.5) && (distance <= outer + 0.5) &&
+          ((sweep >= 360) || (distance == 0) || (angle <= sweep))) {
+        expect = WHITE;
+      }
+      if ((sweep < 360) && ((Shape_Ray (dx, dy, start) < RAY_MARGIN) ||
+                            (Shape_Ray (dx, dy, start + sweep) < RAY_MARGIN))) {
+        continue;                                       // on boundary, sine rounding
+      }
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       arc %d, %d, %u .. %u, %d + %d, pixel %d, %d: 0x%04x, expected 0x%04x\n",
+                cx, cy, inner, outer, start, sweep, x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Pixel in wedge a .. b, b - a <= 180, clockwise of a & counterclockwise of b */
+static int Shape_Wedge (int16_t a, int16_t b, int32_t x, int32_t y)
+{
+  return ((int32_t) ST7789_Sin (a) * x <= (int32_t) ST7789_Cos (a) * y) &&
+         ((int32_t) ST7789_Sin (b) * x >= (int32_t) ST7789_Cos (b) * y);
+}
+
+/* Screen equals ring segment, every pixel by integer ring & Q14 wedge rule */
+static int Shape_Ring_Same (int16_t cx, int16_t cy, uint8_t inner, uint8_t outer, int16_t start, int16_t sweep)
+{
+  int16_t x, y, middle = start + (sweep >> 1);
+  int32_t square;
+  uint16_t expect;
+  uint8_t in;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      square = (int32_t) (x - cx) * (x - cx) + (int32_t) (y - cy) * (y - cy);
+      in = (square <= (int32_t) outer * outer + outer) && (!inner || (square > (int32_t) inner * inner - inner));
+      if (in && (sweep < 360)) {
+        if (sweep > 180) {
+          in = Shape_Wedge (start, middle, x - cx, y - cy) || Shape_Wedge (middle, start + sweep, x - cx, y - cy);
+        } else {
+          in = Shape_Wedge (start, start + sweep, x - cx, y - cy);
+        }
+      }
+      expect = in ? WHITE : BLACK;
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       ring %d, %d, %u .. %u, %d + %d, pixel %d, %d: 0x%04x, expected 0x%04x\n",
+                cx, cy, inner, outer, start, sweep, x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  uint16_t i, polygons = 1, triangles = 1, arcs = 1, rings = 1;
+  int16_t cx, cy, start, sweep;
+  uint8_t n, j, inner, outer;
+
+  Test_Init (ST77XX_ROTATE_0);
+  srand (1);
+
+  // polygons & triangle of first three vertices, partly off screen
+  for (i = 0; (i < SHAPES) && polygons && triangles; i++) {
+    n = Shape_Random (3, ST7789_POLYGON_EDGES);
+    for (j = 0; j < n; j++) {
+      vertices[j].x = Shape_Random (-40, Screen.width + 40);
+      vertices[j].y = Shape_Random (-40, Screen.height + 40);
+    }
+    ST7789_ClearScreen (&Lcd, BLACK);
+    TEST_CHECK (ST7789_FillPolygon (&Lcd, vertices, n, WHITE) == ST77XX_SUCCESS);
+    polygons = Shape_Polygon_Same (n);
+
+    ST7789_ClearScreen (&Lcd, BLACK);
+    ST7789_FillTriangle (&Lcd, vertices[0].x, vertices[0].y, vertices[1].x, vertices[1].y,
+                         vertices[2].x, vertices[2].y, WHITE);
+    triangles = Shape_Polygon_Same (3);
+  }
+  TEST_CHECK (polygons);
+  TEST_CHECK (triangles);
+  TEST_CHECK (ST7789_FillPolygon (&Lcd, vertices, 2, WHITE) == ST77XX_ERROR);
+  TEST_CHECK (ST7789_FillPolygon (&Lcd, vertices, ST7789_POLYGON_EDGES + 1, WHITE) == ST77XX_ERROR);
+
+  // ring segments, any start & sweep, partly off screen
+  for (i = 0; (i < SHAPES) && arcs && rings; i++) {
+    cx = Shape_Random (-20, Screen.width + 20);
+    cy = Shape_Random (-20, Screen.height + 20);
+    outer = Shape_Random (1, 130);
+    inner = Shape_Random (0, outer);
+    start = Shape_Random (-360, 360);
+    sweep = Shape_Random (1, 400);
+    ST7789_ClearScreen (&Lcd, BLACK);
+    ST7789_FillArc (&Lcd, cx, cy, inner, outer, start, sweep, WHITE);
+    arcs = Shape_Arc_Same (cx, cy, inner, outer, start, sweep);
+    rings = Shape_Ring_Same (cx, cy, inner, outer, start, sweep);
+  }
+  TEST_CHECK (arcs);
+  TEST_CHECK (rings);
+
+  // empty sweep, circle = whole ring
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_FillArc (&Lcd, 120, 140, 10, 50, 30, 0, WHITE);
+  Test_Sync ();
+  TEST_CHECK (Test_Pixel (150, 140) == BLACK);
+  ST7789_FillCircle (&Lcd, 120, 140, 50, WHITE);
+  TEST_CHECK (Shape_Ring_Same (120, 140, 0, 50, 0, 360));
+
+  return Test_Done ("shape");
+}
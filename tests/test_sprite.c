@@ -0,0 +1,154 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Sprites
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_sprite.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/sprite.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       16x16 sprite moved diagonally by 1 px over background callback,
+ *              with save-under & work buffer and with save-under alone, screen
+ *              against composed reference, bytes on bus per move
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/sprite.h"
+
+#define SPRITE_SIZE           16                        // sprite width & height
+#define KEY                   0xF81F                    // transparent color
+#define MOVES                 20                        // diagonal steps
+
+/** @var Sprite image, ring with key color inside & corners */
+static uint16_t image[SPRITE_SIZE * SPRITE_SIZE];
+static uint16_t under[SPRITE_SIZE * SPRITE_SIZE];
+static uint16_t work[(SPRITE_SIZE + 1) * (SPRITE_SIZE + 1)];
+static uint16_t background[ST7789_HEIGHT * ST7789_WIDTH];
+
+/* Background of screen */
+static uint16_t Sprite_Background (int16_t x, int16_t y)
+{
+  return (uint16_t) (x * 31 + y * 2047);
+}
+
+/* Screen equals background with sprite at x, y */
+static int Sprite_Same (struct S_SPRITE * sprite)
+{
+  int16_t x, y, i, j;
+  uint16_t expect;
+
+  Test_Sync ();
+  for (y = 0; y < 80; y++) {
+    for (x = 0; x < 80; x++) {
+      i = x - sprite->x;
+      j = y - sprite->y;
+      expect = Sprite_Background (x, y);
+      if (sprite->visible && (i >= 0) && (j >= 0) && (i < SPRITE_SIZE) && (j < SPRITE_SIZE) &&
+          (image[j * SPRITE_SIZE + i] != KEY)) {
+        expect = image[j * SPRITE_SIZE + i];
+      }
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       pixel %d, %d: 0x%04x, expected 0x%04x\n", x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Background on screen, sprite drawn, MOVES diagonal steps checked, bytes per step */
+static uint32_t Sprite_Moves (struct S_SCENE * scene)
+{
+  struct S_SPRITE * sprite = scene->sprites;
+  uint32_t clocks;
+  uint8_t i, same = 1;
+
+  ST7789_DrawImage (&Lcd, 0, Screen.width - 1, 0, Screen.height - 1, background);
+  sprite->x = 10;
+  sprite->y = 10;
+  sprite->visible = 1;
+  ST7789_Sprite_Draw (&Lcd, scene);
+  Test_Sync ();
+  clocks = Mock.clocks;
+  for (i = 0; i < MOVES; i++) {
+    ST7789_Sprite_Move (&Lcd, scene, sprite, sprite->x + 1, sprite->y + 1);
+    Test_Sync ();
+    same &= Sprite_Same (sprite);
+  }
+  clocks = (Mock.clocks - clocks) / MOVES;
+  TEST_CHECK (same);
+
+  // far move & hide restore background
+  ST7789_Sprite_Move (&Lcd, scene, sprite, 50, 5);
+  TEST_CHECK (Sprite_Same (sprite));
+  ST7789_Sprite_Show (&Lcd, scene, sprite, 0);
+  TEST_CHECK (Sprite_Same (sprite));
+
+  return clocks;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  struct S_SPRITE sprite = { .width = SPRITE_SIZE, .height = SPRITE_SIZE, .key = KEY, .image = image };
+  struct S_SCENE scene = { .sprites = &sprite, .count = 1 };
+  uint32_t bytes[4];
+  int16_t x, y, r;
+
+  for (y = 0; y < SPRITE_SIZE; y++) {
+    for (x = 0; x < SPRITE_SIZE; x++) {
+      r = (2 * x - 15) * (2 * x - 15) + (2 * y - 15) * (2 * y - 15);
+      image[y * SPRITE_SIZE + x] = ((r > 100) && (r < 225)) ? (uint16_t) (0x07E0 + x * y) : KEY;
+    }
+  }
+  Test_Init (ST77XX_ROTATE_0);
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      background[y * Screen.width + x] = Sprite_Background (x, y);
+    }
+  }
+
+  // composed from background callback
+  scene.background = Sprite_Background;
+  bytes[0] = Sprite_Moves (&scene);
+
+  // save-under, union read back into work buffer
+  scene.background = NULL;
+  scene.color = BLACK;                                  // wrong background, must not show
+  sprite.under = under;
+  scene.work = work;
+  bytes[1] = Sprite_Moves (&scene);
+
+  // save-under without work buffer, old & new window
+  scene.work = NULL;
+  bytes[2] = Sprite_Moves (&scene);
+
+  // clear & redraw = two windows of composed scene
+  sprite.under = NULL;
+  sprite.visible = 1;
+  scene.background = Sprite_Background;
+  bytes[3] = Mock.clocks;
+  ST7789_Sprite_Move (&Lcd, &scene, &sprite, 100, 100);
+  bytes[3] = Mock.clocks - bytes[3];
+
+#if !defined(ST7789_FRAMEBUFFER)
+  // frame buffer sends changed rows at flush only
+  printf ("  16x16 sprite by 1 px, bytes on bus: union %u, save-under %u, "
+          "save-under without work %u, clear & redraw %u\n", bytes[0], bytes[1], bytes[2], bytes[3]);
+  TEST_CHECK (bytes[0] < bytes[3]);
+#endif
+
+  return Test_Done ("sprite");
+}
@@ -0,0 +1,145 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Instrumentation counters
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_stats.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/stats.h, built with -DST7789_STATS by make test
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Every tagged module counted by its id, bytes of outermost function
+ *              equal bytes on bus, nested functions not charged, busy wait of
+ *              host ticks, names of ids
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/shape.h"
+#include "src/sprite.h"
+#include "src/tile.h"
+#include "src/widget.h"
+#include "src/dlist.h"
+#include "src/fill.h"
+
+#define CELLS                 (4 * 2)                   // tile map 4 x 2
+
+/** @var Tile map */
+static uint8_t tiles[CELLS], attrs[CELLS], dirty[(CELLS + 7) / 8];
+static const uint16_t palette[16] = { BLACK, WHITE, RED, BLUE };
+
+/** @var Sprite image & list */
+static uint16_t image[8 * 8];
+static uint8_t buffer[64];
+
+/* Work of one tagged module */
+static void Stats_Draw (uint8_t api)
+{
+  struct S_TILEMAP map = { .x = 10, .y = 10, .cols = 4, .rows = 2, .cellW = 8, .cellH = 8,
+                           .tiles = tiles, .attrs = attrs, .dirty = dirty, .palette = palette };
+  struct S_SPRITE sprite = { .x = 50, .y = 50, .width = 8, .height = 8, .image = image, .visible = 1 };
+  struct S_SCENE scene = { .sprites = &sprite, .count = 1, .color = BLACK };
+  struct S_BAR bar = { .x = 20, .y = 100, .width = 100, .height = 10, .max = 10, .fill = 5, .fg = RED, .bg = BLUE };
+  struct S_LIST list = { .buffer = buffer, .size = sizeof (buffer) };
+
+  switch (api) {
+    case STATS_CLEAR_SCREEN: ST7789_ClearScreen (&Lcd, BLACK); break;
+    case STATS_SHAPE: ST7789_FillArc (&Lcd, 120, 140, 20, 40, 0, 270, WHITE); break;
+    case STATS_SPRITE: ST7789_Sprite_Draw (&Lcd, &scene); break;
+    case STATS_TILE:
+      ST7789_Tile_Clear (&map, ' ', 0x10);
+      ST7789_Tile_Print (&map, 0, 0, "Tile", 0x21);
+      ST7789_Tile_Update (&Lcd, &map);
+      break;
+    case STATS_WIDGET: ST7789_Bar_Draw (&Lcd, &bar); break;
+    case STATS_LIST:
+      ST7789_List_Clear (&list);
+      ST7789_List_Fill (&list, 0, 50, 200, 220, RED);
+      ST7789_List_Play (&Lcd, buffer, LIST_RAM, NULL);
+      break;
+    default: ST7789_FillChecker (&Lcd, 0, 99, 0, 99, 4, WHITE, BLACK); break;
+  }
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const uint8_t apis[] = { STATS_CLEAR_SCREEN, STATS_SHAPE, STATS_SPRITE, STATS_TILE, STATS_WIDGET, STATS_LIST, STATS_FILL };
+  uint32_t clocks;
+  uint8_t a, i, j, counted = 1, charged = 1, named = 1;
+
+  Test_Init (ST77XX_ROTATE_0);
+
+  // each module counted once, its bytes charged to it alone
+  for (a = 0; a < sizeof (apis); a++) {
+    Test_Sync ();
+    ST7789_Stats_Reset ();
+    clocks = Mock.clocks;
+    Stats_Draw (apis[a]);
+    Test_Sync ();                                       // flush charged to untagged
+    clocks = Mock.clocks - clocks;
+    if ((Stats.calls[apis[a]] != 1) || (Stats.api != STATS_OTHER)) {
+      printf ("       %s: %u calls\n", ST7789_Stats_Name (apis[a]), Stats.calls[apis[a]]);
+      counted = 0;
+    }
+    for (i = 0; i < STATS_APIS; i++) {
+#if defined(ST7789_FRAMEBUFFER)
+      if ((i != apis[a]) && (i != STATS_OTHER) && Stats.bytes[i]) {
+#else
+      if ((i != apis[a]) && Stats.bytes[i]) {
+#endif
+        printf ("       %s: %u bytes charged to %s\n", ST7789_Stats_Name (apis[a]), Stats.bytes[i], ST7789_Stats_Name (i));
+        charged = 0;
+      }
+    }
+#if !defined(ST7789_FRAMEBUFFER)
+    // frame buffer sends changed rows at flush only
+    if ((Stats.bytes[apis[a]] == 0) || (Stats.bytes[apis[a]] != clocks)) {
+      printf ("       %s: %u bytes, %u on bus\n", ST7789_Stats_Name (apis[a]), Stats.bytes[apis[a]], clocks);
+      charged = 0;
+    }
+#endif
+  }
+  TEST_CHECK (counted);
+  TEST_CHECK (charged);
+
+  // nested tagged functions counted, bytes of outermost
+  ST7789_Stats_Reset ();
+  Stats_Draw (STATS_WIDGET);
+  TEST_CHECK (Stats.calls[STATS_FILL_RECT] > 0);
+  TEST_CHECK (Stats.bytes[STATS_FILL_RECT] == 0);
+
+#if !defined(ST7789_FRAMEBUFFER)
+  // busy wait measured by host ticks
+  ST7789_Stats_Reset ();
+  Stats_Draw (STATS_CLEAR_SCREEN);
+  TEST_CHECK (Stats.wait[STATS_CLEAR_SCREEN] > 0);
+#endif
+
+  // every library id named once, application ids not
+  for (i = 0; i < STATS_USER; i++) {
+    if (ST7789_Stats_Name (i) == NULL) {
+      named = 0;
+      continue;
+    }
+    for (j = 0; j < i; j++) {
+      if (ST7789_Stats_Name (j) && (strcmp (ST7789_Stats_Name (i), ST7789_Stats_Name (j)) == 0)) {
+        named = 0;
+      }
+    }
+  }
+  TEST_CHECK (named);
+  TEST_CHECK (ST7789_Stats_Name (STATS_USER) == NULL);
+
+  return Test_Done ("stats");
+}
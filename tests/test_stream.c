@@ -0,0 +1,130 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Command streams
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_stream.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, tests/screens/page.c, tests/screens/page_naive.c
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Sample page compiled by tools/scr2stream.py (make screens): stream
+ *              played from memory, run from external source by blocks of every
+ *              size & drawn by plain driver calls give the same display RAM,
+ *              source ended inside record, wire bytes of stream & plain calls
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "tests/screens/page.c"                         // PAGE_MAIN
+#include "tests/screens/page_naive.c"                   // PAGE_MAIN_Naive
+
+/** @var Display RAM of played stream */
+static uint16_t played[HAL_MOCK_HEIGHT][HAL_MOCK_WIDTH];
+
+/** @struct External source, stream in memory read by blocks */
+struct S_SOURCE {
+  uint32_t address;                                     // next byte
+  uint32_t size;                                        // bytes of stream
+  uint8_t block;                                        // bytes per read at most
+};
+
+/* Read of external source */
+static uint8_t Stream_Read (void * context, uint8_t * buffer, uint8_t n)
+{
+  struct S_SOURCE * source = context;
+  uint8_t count = 0;
+
+  if (n > source->block) {
+    n = source->block;
+  }
+  while ((count < n) && (source->address < source->size)) {
+    buffer[count++] = PAGE_MAIN[source->address++];
+  }
+  return count;
+}
+
+/* Screen cleared, visible before next drawing */
+static void Stream_Clear (void)
+{
+  ST7789_ClearScreen (&Lcd, RED);
+  Test_Sync ();
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  struct S_SOURCE source = { .size = sizeof (PAGE_MAIN) };
+  struct S_STREAM stream = { .read = Stream_Read, .context = &source };
+#if !defined(ST7789_FRAMEBUFFER)
+  uint32_t bytes[2];
+#endif
+  uint8_t result, same = 1;
+
+  Test_Init (ST77XX_ROTATE_0);
+
+  // played from memory
+  Stream_Clear ();
+  ST7789_Stream_Play (&Lcd, PAGE_MAIN);
+  Test_Sync ();
+  memcpy (played, Mock.gram, sizeof (played));
+  TEST_CHECK (Test_Pixel (0, 0) == 0x001F);             // header
+  TEST_CHECK (Test_Pixel (Screen.width - 1, Screen.height - 1) == 0x4208);
+
+  // run from external source, records split at every block boundary
+  for (source.block = 1; source.block <= ST7789_STREAM_BUFFER; source.block++) {
+    Stream_Clear ();
+    source.address = 0;
+    result = ST7789_Stream_Run (&Lcd, &stream);
+    Test_Sync ();
+    if ((result != ST77XX_SUCCESS) || memcmp (played, Mock.gram, sizeof (played))) {
+      printf ("       blocks of %u bytes differ\n", source.block);
+      same = 0;
+    }
+  }
+  TEST_CHECK (same);
+
+  // plain driver calls of layout
+  Stream_Clear ();
+  PAGE_MAIN_Naive (&Lcd);
+  Test_Sync ();
+  TEST_CHECK (memcmp (played, Mock.gram, sizeof (played)) == 0);
+
+  // source ended inside record
+  source.address = 0;
+  source.size = sizeof (PAGE_MAIN) / 2;
+  TEST_CHECK (ST7789_Stream_Run (&Lcd, &stream) == ST77XX_ERROR);
+  source.size = sizeof (PAGE_MAIN);
+
+  // window cache invalidated by stream
+  ST7789_FillRect (&Lcd, 0, 9, 0, 9, WHITE);
+  ST7789_Stream_Play (&Lcd, PAGE_MAIN);
+  ST7789_FillRect (&Lcd, 0, 9, 0, 9, WHITE);
+  Test_Sync ();
+  TEST_CHECK (Test_Pixel (9, 9) == WHITE);
+
+#if !defined(ST7789_FRAMEBUFFER)
+  // frame buffer sends changed rows at flush only
+  bytes[0] = Mock.clocks;
+  ST7789_Stream_Play (&Lcd, PAGE_MAIN);
+  bytes[0] = Mock.clocks - bytes[0];
+  bytes[1] = Mock.clocks;
+  PAGE_MAIN_Naive (&Lcd);
+  bytes[1] = Mock.clocks - bytes[1];
+  printf ("  sample page, %u bytes of stream, bytes on bus: stream %u, plain calls %u\n",
+          (unsigned) sizeof (PAGE_MAIN), bytes[0], bytes[1]);
+  TEST_CHECK (bytes[0] < bytes[1]);
+#endif
+
+  return Test_Done ("stream");
+}
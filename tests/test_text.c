@@ -0,0 +1,171 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Text
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_text.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/text.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       5x8 font in all sizes & proportional fonts 1 / 2 bpp, goldens,
+ *              opaque glyph boxes against ST7789_Text_Width, characters out
+ *              of font as space, antialiased glyphs blended over pattern read
+ *              back from display RAM against per-pixel blend of this test
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/text.h"
+
+#define OVER_X                30                        // glyph drawn over pattern
+#define OVER_Y                200
+
+/** @var Pattern under glyph */
+static uint16_t pattern[24 * 40];
+
+/* Pattern pixel at screen position */
+static uint16_t Text_Pattern (int16_t x, int16_t y)
+{
+  return (uint16_t) ((x * 7919 + y * 104729) * 2654435761u >> 16);
+}
+
+/* Channels of fg over bg, alpha 0 .. 32 */
+static uint16_t Text_Mix (uint16_t fg, uint16_t bg, int16_t alpha)
+{
+  int16_t r = bg >> 11, g = (bg >> 5) & 0x3F, b = bg & 0x1F;
+
+  r += (((fg >> 11) - r) * alpha) >> 5;
+  g += ((((fg >> 5) & 0x3F) - g) * alpha) >> 5;
+  b += (((fg & 0x1F) - b) * alpha) >> 5;
+
+  return (uint16_t) ((r << 11) | (g << 5) | b);
+}
+
+/* Glyph blended over pattern equals coverage of bitmap mixed pixel by pixel */
+static int Text_Over (const struct S_FONT * font, char character, uint16_t fg)
+{
+  uint8_t index = (uint8_t) character - font->first;
+  uint8_t width = font->widths[index], levels = (1 << font->bpp) - 1;
+  const uint8_t * glyph = font->bitmap + font->offsets[index];
+  uint16_t w = width + font->spacing, expect, bit;
+  uint8_t level;
+  int16_t x, y;
+
+  // pattern around & under glyph
+  for (y = 0; y < font->height + 2; y++) {
+    for (x = 0; x < w + 2; x++) {
+      pattern[y * (w + 2) + x] = Text_Pattern (OVER_X - 1 + x, OVER_Y - 1 + y);
+    }
+  }
+  ST7789_DrawImage (&Lcd, OVER_X - 1, OVER_X + w, OVER_Y - 1, OVER_Y + font->height, pattern);
+  ST7789_SetPosition (OVER_X, OVER_Y);
+  if (ST7789_Text_DrawCharOver (&Lcd, font, character, fg, pattern) != ST77XX_SUCCESS) {
+    return 0;
+  }
+  Test_Sync ();
+  for (y = OVER_Y - 1; y <= OVER_Y + font->height; y++) {
+    for (x = OVER_X - 1; x <= OVER_X + w; x++) {
+      expect = Text_Pattern (x, y);
+      if ((x >= OVER_X) && (x < OVER_X + width) && (y >= OVER_Y) && (y < OVER_Y + font->height)) {
+        bit = ((y - OVER_Y) * width + (x - OVER_X)) * font->bpp;
+        level = (glyph[bit >> 3] >> (8 - font->bpp - (bit & 0x07))) & levels;
+        expect = Text_Mix (fg, expect, ((level << 5) + (levels >> 1)) / levels);
+      }
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       '%c' bpp %u over pattern, pixel %d, %d: 0x%04x, expected 0x%04x\n",
+                character, font->bpp, x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Two screen areas equal */
+static int Text_Same (int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t w, int16_t h)
+{
+  int16_t x, y;
+
+  Test_Sync ();
+  for (y = 0; y < h; y++) {
+    for (x = 0; x < w; x++) {
+      if (Test_Pixel (x1 + x, y1 + y) != Test_Pixel (x2 + x, y2 + y)) {
+        printf ("       pixel %d, %d: 0x%04x\n", x2 + x, y2 + y, Test_Pixel (x2 + x, y2 + y));
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  char text[] = "Hello, ST7789 0123456789 !?";
+  char c;
+  uint8_t over = 1;
+
+  Test_Init (ST77XX_ROTATE_0);
+
+  // 5x8 font, X1 / X2 / X3
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_SetPosition (2, 2);
+  ST7789_DrawString (&Lcd, text, WHITE, X1);
+  ST7789_SetPosition (2, 20);
+  ST7789_DrawString (&Lcd, text, RED, X2);
+  ST7789_SetPosition (2, 60);
+  ST7789_DrawString (&Lcd, text, BLUE, X3);
+  TEST_GOLDEN ("text_5x8");
+
+  // proportional fonts, background box as wide as string
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_SetPosition (0, 0);
+  ST7789_Text_DrawString (&Lcd, &FONT_8, text, WHITE, RED);
+  Test_Sync ();
+  TEST_CHECK (Test_Pixel (ST7789_Text_Width (&FONT_8, text) - 1, 0) == RED);
+  TEST_CHECK (Test_Pixel (ST7789_Text_Width (&FONT_8, text), 0) == BLACK);
+  ST7789_SetPosition (0, 20);
+  ST7789_Text_DrawString (&Lcd, &FONT_16, text, WHITE, BLUE);
+  ST7789_SetPosition (0, 50);
+  ST7789_Text_DrawString (&Lcd, &FONT_24, "Text 24", BLACK, WHITE);
+  ST7789_SetPosition (0, 90);
+  ST7789_Text_DrawString (&Lcd, &FONT_16_AA, text, WHITE, BLACK);
+  ST7789_SetPosition (0, 120);
+  ST7789_Text_DrawString (&Lcd, &FONT_24_AA, "AA 24", 0xFFE0, 0x0010);
+  TEST_GOLDEN ("text_fonts");
+
+  // character out of font drawn & counted as space
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_SetPosition (0, 0);
+  ST7789_Text_DrawString (&Lcd, &FONT_16, "A B x", WHITE, BLUE);
+  ST7789_SetPosition (0, 40);
+  ST7789_Text_DrawString (&Lcd, &FONT_16, "A\x01" "B\xa0" "x", WHITE, BLUE);
+  TEST_CHECK (ST7789_Text_Width (&FONT_16, "A\x01" "B\xa0" "x") == ST7789_Text_Width (&FONT_16, "A B x"));
+  TEST_CHECK (Text_Same (0, 0, 0, 40, ST7789_Text_Width (&FONT_16, "A B x") + 1, 20));
+
+  // antialiased glyphs over pattern, ramp of other font & colors built before
+  ST7789_ClearScreen (&Lcd, BLACK);
+  for (c = 'A'; c <= 'Z'; c += 5) {
+    ST7789_SetPosition (0, 0);
+    ST7789_Text_DrawString (&Lcd, &FONT_24_AA, "x", RED, BLUE);
+    over &= Text_Over (&FONT_16_AA, c, WHITE);
+    ST7789_SetPosition (0, 0);
+    ST7789_Text_DrawString (&Lcd, &FONT_16_AA, "x", WHITE, BLACK);
+    over &= Text_Over (&FONT_24_AA, c + 1, 0xFFE0);
+    over &= Text_Over (&FONT_16, c + 2, RED);
+  }
+  TEST_CHECK (over);
+
+  return Test_Done ("text");
+}
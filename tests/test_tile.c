@@ -0,0 +1,162 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Tile maps
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_tile.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/tile.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Cells of FONTS & of 1 bpp sheets above 8 kB against reference of
+ *              the test, second update sends nothing, changed cell sends one
+ *              window of its pixels, unchanged put sends nothing
+ * --------------------------------------------------------------------------------------------+
+ */
+#include "test.h"
+#include "src/tile.h"
+
+#define BG                    0x1234                    // screen around map
+#define COLS                  8
+#define ROWS                  4
+#define CELLS                 (COLS * ROWS)
+#define SHEET_TILES           130                       // 24x24 tiles, 72 bytes each
+#define SHEET_BYTES           (SHEET_TILES * 72)
+
+/** @var Tile map */
+static uint8_t tiles[CELLS], attrs[CELLS], dirty[(CELLS + 7) / 8];
+static const uint16_t palette[16] = { BLACK, WHITE, RED, BLUE, 0x07E0, 0xFFE0, 0xF81F, 0x07FF,
+                                      0x8410, 0x4208, 0xC618, 0x2104, 0x001F, 0xF800, 0x0400, 0x8000 };
+
+/** @var Sheet of tiles, bigger than 8 kB */
+static uint8_t sheet[SHEET_BYTES];
+
+/* Expected pixel at screen position */
+static uint16_t Tile_Expect (const struct S_TILEMAP * map, int16_t x, int16_t y)
+{
+  int16_t col, row, dx, dy;
+  uint8_t tile, attr, sx, sy, on = 0;
+  uint32_t bit;
+
+  if ((x < map->x) || (y < map->y) ||
+      (x >= map->x + map->cols * map->cellW) || (y >= map->y + map->rows * map->cellH)) {
+    return BG;
+  }
+  col = (x - map->x) / map->cellW;
+  row = (y - map->y) / map->cellH;
+  dx = (x - map->x) % map->cellW;
+  dy = (y - map->y) % map->cellH;
+  tile = map->tiles[row * map->cols + col];
+  attr = map->attrs[row * map->cols + col];
+  if (map->sheet) {
+    bit = (uint32_t) tile * ((map->cellW * map->cellH + 7) / 8 * 8) + dy * map->cellW + dx;
+    on = (map->sheet[bit / 8] >> (7 - bit % 8)) & 1;
+  } else {
+    sx = map->cellW / 6 ? map->cellW / 6 : 1;           // 5 columns + spacing
+    sy = map->cellH / 8 ? map->cellH / 8 : 1;
+    if ((tile >= 0x20) && (tile <= 0x7F) && (dx / sx < CHARS_COLS_LEN) && (dy / sy < CHARS_ROWS_LEN)) {
+      on = (FONTS[tile - 0x20][dx / sx] >> (dy / sy)) & 1;
+    }
+  }
+  return palette[on ? attr >> 4 : attr & 0x0F];
+}
+
+/* Screen equals map */
+static int Tile_Same (const struct S_TILEMAP * map, const char * name)
+{
+  int16_t x, y;
+  uint16_t expect;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      expect = Tile_Expect (map, x, y);
+      if (Test_Pixel (x, y) != expect) {
+        printf ("       %s, pixel %d, %d: 0x%04x, expected 0x%04x\n", name, x, y, Test_Pixel (x, y), expect);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  struct S_TILEMAP text = { .x = 7, .y = 11, .cols = COLS, .rows = ROWS, .cellW = 12, .cellH = 16,
+                            .tiles = tiles, .attrs = attrs, .dirty = dirty, .palette = palette };
+  struct S_TILEMAP tiled = { .x = 20, .y = 90, .cols = COLS, .rows = ROWS, .cellW = 24, .cellH = 24,
+                             .tiles = tiles, .attrs = attrs, .dirty = dirty, .palette = palette, .sheet = sheet };
+  struct S_TILEMAP odd = { .x = 3, .y = 200, .cols = COLS, .rows = ROWS, .cellW = 5, .cellH = 7,
+                           .tiles = tiles, .attrs = attrs, .dirty = dirty, .palette = palette, .sheet = sheet };
+  uint32_t bytes;
+  uint16_t i;
+
+  Test_Init (ST77XX_ROTATE_0);
+  for (i = 0; i < SHEET_BYTES; i++) {
+    sheet[i] = (uint8_t) (i * 37 + (i >> 8) * 11 + 5);  // every tile different
+  }
+
+  // FONTS cells, whole character set & out of range tiles
+  ST7789_ClearScreen (&Lcd, BG);
+  ST7789_Tile_Clear (&text, ' ', TILE_ATTR (1, 0));
+  for (i = 0; i < CELLS; i++) {
+    ST7789_Tile_Put (&text, i % COLS, i / COLS, (i < CELLS - 2) ? 0x21 + i * 3 : i * 8, TILE_ATTR (i & 0x0F, (i + 5) & 0x0F));
+  }
+  TEST_CHECK (ST7789_Tile_Update (&Lcd, &text) == CELLS);
+  TEST_CHECK (Tile_Same (&text, "fonts"));
+
+  // second update sends nothing
+  Test_Sync ();
+  bytes = Mock.clocks;
+  TEST_CHECK (ST7789_Tile_Update (&Lcd, &text) == 0);
+  Test_Sync ();
+  TEST_CHECK (Mock.clocks == bytes);
+
+  // same tile put again, nothing changed
+  ST7789_Tile_Put (&text, 3, 2, tiles[2 * COLS + 3], attrs[2 * COLS + 3]);
+  TEST_CHECK (ST7789_Tile_Update (&Lcd, &text) == 0);
+
+  // one changed cell, one window of its pixels
+  ST7789_Tile_Put (&text, 3, 2, 'Q', TILE_ATTR (2, 3));
+  bytes = Mock.clocks;
+  TEST_CHECK (ST7789_Tile_Update (&Lcd, &text) == 1);
+#if !defined(ST7789_FRAMEBUFFER)
+  // frame buffer sends changed rows at flush only
+  bytes = Mock.clocks - bytes;
+  printf ("  one changed cell 12x16, bytes on bus: %u\n", bytes);
+  TEST_CHECK ((bytes > 2 * 12 * 16) && (bytes <= 2 * 12 * 16 + 11));  // CASET, RASET, RAMWR
+#endif
+  TEST_CHECK (Tile_Same (&text, "one cell"));
+
+  // sheet of 24x24 tiles, tiles behind 8 kB
+  ST7789_ClearScreen (&Lcd, BG);
+  for (i = 0; i < CELLS; i++) {
+    ST7789_Tile_Put (&tiled, i % COLS, i / COLS, (i * 17 + 100) % SHEET_TILES, TILE_ATTR (i & 0x0F, (i + 9) & 0x0F));
+  }
+  ST7789_Tile_Put (&tiled, 0, 0, 114, TILE_ATTR (1, 0));  // first tile above 16 bit index
+  ST7789_Tile_Invalidate (&tiled);
+  TEST_CHECK (ST7789_Tile_Update (&Lcd, &tiled) == CELLS);
+  TEST_CHECK (Tile_Same (&tiled, "sheet 24x24"));
+
+  // 5x7 tiles padded to 40 bits
+  ST7789_ClearScreen (&Lcd, BG);
+  ST7789_Tile_Invalidate (&odd);
+  TEST_CHECK (ST7789_Tile_Update (&Lcd, &odd) == CELLS);
+  TEST_CHECK (Tile_Same (&odd, "sheet 5x7"));
+
+  TEST_CHECK (ST7789_Tile_Put (&text, COLS, 0, 'A', 0) == ST77XX_ERROR);
+
+  return Test_Done ("tile");
+}
@@ -0,0 +1,132 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Widgets
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        test_widget.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      test.h, src/widget.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Bars & gauge after delta updates against full repaint, max 0,
+ *              bytes on bus of delta update & full repaint
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdlib.h>
+#include "test.h"
+#include "src/widget.h"
+
+/** @var Screen after delta updates */
+static uint16_t delta[ST7789_HEIGHT][ST7789_WIDTH];
+
+/* Copy of screen */
+static void Widget_Save (void)
+{
+  int16_t x, y;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      delta[y][x] = Test_Pixel (x, y);
+    }
+  }
+}
+
+/* Screen equals saved screen */
+static int Widget_Same (void)
+{
+  int16_t x, y;
+
+  Test_Sync ();
+  for (y = 0; y < Screen.height; y++) {
+    for (x = 0; x < Screen.width; x++) {
+      if (Test_Pixel (x, y) != delta[y][x]) {
+        printf ("       pixel %d, %d: 0x%04x, expected 0x%04x\n", x, y, Test_Pixel (x, y), delta[y][x]);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  struct S_BAR bars[] = {
+    { .x = 20, .y = 20,  .width = 200, .height = 20,  .direction = BAR_HORIZONTAL, .max = 1000, .fg = RED,  .bg = BLUE },
+    { .x = 20, .y = 60,  .width = 30,  .height = 150, .direction = BAR_VERTICAL,   .max = 7,    .fg = WHITE, .bg = RED }
+  };
+  struct S_GAUGE gauge = { .x = 150, .y = 150, .inner = 10, .radius = 80, .start = 135, .sweep = 270,
+                           .max = 100, .fg = WHITE, .bg = BLACK, .angle = 135 };
+  struct S_BAR empty = { .x = 60, .y = 60, .width = 40, .height = 10, .max = 0, .fg = RED, .bg = BLUE };
+#if !defined(ST7789_FRAMEBUFFER)
+  uint32_t bytes[2];
+#endif
+  uint16_t value;
+  uint8_t i, b;
+
+  Test_Init (ST77XX_ROTATE_0);
+  srand (1);
+
+  // bars, delta updates equal full repaint
+  for (b = 0; b < sizeof (bars) / sizeof (bars[0]); b++) {
+    ST7789_ClearScreen (&Lcd, BLACK);
+    ST7789_Bar_Draw (&Lcd, &bars[b]);
+    for (i = 0; i < 50; i++) {
+      value = rand () % (bars[b].max + bars[b].max / 4 + 1);  // some over max
+      ST7789_Bar_Set (&Lcd, &bars[b], value);
+    }
+    Widget_Save ();
+    ST7789_ClearScreen (&Lcd, BLACK);
+    ST7789_Bar_Draw (&Lcd, &bars[b]);
+    TEST_CHECK (Widget_Same ());
+  }
+  ST7789_Bar_Set (&Lcd, &bars[0], 2000);
+  TEST_CHECK (bars[0].fill == bars[0].width);           // saturated
+
+  // gauge, erase & draw equal needle drawn once
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_Gauge_Draw (&Lcd, &gauge);
+  for (i = 0; i <= 100; i += 7) {
+    ST7789_Gauge_Set (&Lcd, &gauge, i);
+  }
+  Widget_Save ();
+  ST7789_ClearScreen (&Lcd, BLACK);
+  ST7789_Gauge_Draw (&Lcd, &gauge);
+  TEST_CHECK (Widget_Same ());
+
+  // max 0, empty bar & needle at start
+  ST7789_Bar_Draw (&Lcd, &empty);
+  ST7789_Bar_Set (&Lcd, &empty, 5);
+  TEST_CHECK (empty.fill == 0);
+  gauge.max = 0;
+  ST7789_Gauge_Set (&Lcd, &gauge, 5);
+  TEST_CHECK (gauge.angle == gauge.start);
+
+#if !defined(ST7789_FRAMEBUFFER)
+  // frame buffer sends changed rows at flush only
+  ST7789_Bar_Set (&Lcd, &bars[0], 500);
+  bytes[0] = Mock.clocks;
+  ST7789_Bar_Set (&Lcd, &bars[0], 510);
+  bytes[0] = Mock.clocks - bytes[0];
+  ST7789_Window_Invalidate ();
+  bytes[1] = Mock.clocks;
+  ST7789_Bar_Draw (&Lcd, &bars[0]);
+  bytes[1] = Mock.clocks - bytes[1];
+  printf ("  200x20 bar 50%% -> 51%%, bytes on bus: delta %u, full repaint %u\n", bytes[0], bytes[1]);
+  TEST_CHECK (bytes[0] < bytes[1] / 10);
+#endif
+
+  return Test_Done ("widget");
+}
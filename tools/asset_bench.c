@@ -0,0 +1,117 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        External asset benchmark
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        asset_bench.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      src/asset.h, src/hal/model.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       make bench, host bus model: 100x60 image as RAM blit, SPI NOR flash
+ *              passed through to panel & chunked flash reads through RAM, bytes
+ *              clocked on the shared bus, display RAM checked by tests/test_asset.c
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdio.h>
+#include "src/asset.h"
+
+#define IMAGE_W               100                       // test image
+#define IMAGE_H               60
+
+/** @var Image in RAM & in flash, flash in wire order */
+static uint16_t image[IMAGE_W * IMAGE_H];
+static uint8_t memory[IMAGE_W * IMAGE_H * 2];
+
+/** @var SPI NOR flash on display bus */
+static struct signal fcs = { .ddr = &DDRB, .port = &PORTB, .pin = 3 };
+static struct S_FLASH flash = { .cs = &fcs };
+static uint32_t flashIndex;                             // byte since chip select
+static uint32_t flashAddress;
+
+/* Flash model, READ command & 24 bit address, then data. Transaction ends
+   at first byte clocked with flash idle, every path writes the panel alone
+   between two reads */
+static uint8_t Bench_Flash (uint8_t data)
+{
+  uint8_t out = 0xFF;
+
+  if (*fcs.port & (1 << fcs.pin)) {
+    flashIndex = 0;                                     // not selected
+    return 0xFF;
+  }
+  if ((flashIndex >= 1) && (flashIndex <= 3)) {
+    flashAddress = (flashAddress << 8) | data;          // address
+  } else if (flashIndex > 3) {
+    out = (flashAddress < sizeof (memory)) ? memory[flashAddress] : 0xFF;
+    flashAddress++;
+  } else {
+    flashAddress = 0;                                   // command
+  }
+  flashIndex++;
+
+  return out;
+}
+
+/* Image at xs, ys by one of the paths, bytes clocked on bus */
+static uint32_t Bench_Draw (struct st7789 * lcd, uint8_t path, int16_t xs, int16_t ys)
+{
+  struct S_ASSETS assets = { ST7789_Flash_Read, &flash };
+  uint16_t xe = xs + IMAGE_W - 1, ye = ys + IMAGE_H - 1;
+  uint32_t clocks;
+
+  ST7789_Window_Invalidate ();                          // every path sets its window
+  clocks = Mock.clocks;
+  switch (path) {
+    case 0: ST7789_DrawImage (lcd, xs, xe, ys, ye, image); break;
+    case 1: ST7789_Flash_Image (lcd, &flash, 0, xs, xe, ys, ye); break;
+    default: ST7789_Asset_Image (lcd, &assets, 0, xs, xe, ys, ye); break;
+  }
+  return Mock.clocks - clocks;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const char * paths[] = { "RAM blit", "flash pass-through", "chunked flash reads" };
+  const int16_t at[][2] = { { 20, 30 }, { -30, 250 } };  // whole & clipped
+  struct signal cs = { .ddr = &DDRB, .port = &PORTB, .pin = 2 };
+  struct signal bl = { .ddr = &DDRB, .port = &PORTB, .pin = 1 };
+  struct signal rs = { .ddr = &DDRB, .port = &PORTB, .pin = 0 };
+  struct signal dc = { .ddr = &DDRD, .port = &PORTD, .pin = 7 };
+  struct st7789 lcd = { .cs = &cs, .bl = &bl, .dc = &dc, .rs = &rs };
+  uint32_t i;
+  uint8_t path, a;
+
+  for (i = 0; i < IMAGE_W * IMAGE_H; i++) {
+    image[i] = (uint16_t) (i * 2654435761u >> 16);
+    memory[2 * i] = (uint8_t) (image[i] >> 8);
+    memory[2 * i + 1] = (uint8_t) image[i];
+  }
+  HAL_Pin_Output (&fcs);
+  HAL_Pin_Set (&fcs);                                   // flash idle
+  HAL_Mock_Panel (&cs, &dc);
+  Mock.device = Bench_Flash;
+  ST7789_Init (&lcd, ST77XX_ROTATE_0);
+
+  printf ("%ux%u image, bytes clocked on shared bus\n", IMAGE_W, IMAGE_H);
+  for (a = 0; a < sizeof (at) / sizeof (at[0]); a++) {
+    printf ("  at %d, %d\n", at[a][0], at[a][1]);
+    for (path = 0; path < sizeof (paths) / sizeof (paths[0]); path++) {
+      ST7789_ClearScreen (&lcd, BLACK);
+      printf ("    %-20s %6u B\n", paths[path], Bench_Draw (&lcd, path, at[a][0], at[a][1]));
+    }
+  }
+  return Mock.errors ? 1 : 0;
+}
@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+#
+# @description  Convert BDF fonts (or the built-in 5x8 FONTS table) to the
+#               proportional font format of src/font.h (struct S_FONT)
+#
+# @usage        tools/bdf2font.py font.bdf FONT_16 > src/fonts/font_16.c
+#               tools/bdf2font.py --legacy src/font.c --scale 2 FONT_16 > src/fonts/font_16.c
+#               tools/bdf2font.py --legacy src/font.c --scale 2 --bpp 2 FONT_16_AA > src/fonts/font_16_aa.c
+#               tools/bdf2font.py --supersample 4 --bpp 4 big.bdf FONT_AA > font_aa.c
+#
+# @format       glyph rows are packed row by row, MSB first, 1, 2 or 4 bits
+#               per pixel (coverage), every glyph starts on a byte boundary
+#
+import argparse
+import re
+import sys
+
+FIRST = 0x20
+LAST = 0x7E
+
+
+def parse_bdf(path):
+    """Return (height, {code: rows}) where rows are lists of 0/1."""
+    glyphs = {}
+    ascent = descent = None
+    code = None
+    bitmap = None
+    bbx = None
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            words = line.split()
+            if not words:
+                continue
+            key = words[0]
+            if key == "FONT_ASCENT":
+                ascent = int(words[1])
+            elif key == "FONT_DESCENT":
+                descent = int(words[1])
+            elif key == "ENCODING":
+                code = int(words[1])
+            elif key == "BBX":
+                bbx = [int(w) for w in words[1:5]]
+            elif key == "BITMAP":
+                bitmap = []
+            elif key == "ENDCHAR":
+                if code is not None and FIRST <= code <= LAST:
+                    glyphs[code] = (bbx, bitmap)
+                code = bitmap = bbx = None
+            elif bitmap is not None:
+                bitmap.append((int(key, 16), len(key) * 4))
+    if ascent is None or descent is None:
+        sys.exit("bdf2font: FONT_ASCENT / FONT_DESCENT missing")
+
+    height = ascent + descent
+    out = {}
+    for code, (bbx, bitmap) in glyphs.items():
+        w, h, xoff, yoff = bbx
+        cols = max(w + max(xoff, 0), 1)
+        rows = [[0] * cols for _ in range(height)]
+        top = ascent - (h + yoff)
+        for r, (value, nbits) in enumerate(bitmap):
+            y = top + r
+            if not 0 <= y < height:
+                continue
+            for c in range(w):
+                if value & (1 << (nbits - 1 - c)):
+                    rows[y][c + max(xoff, 0)] = 1
+        out[code] = rows
+    return height, out
+
+
+def parse_legacy(path):
+    """Read the column-major 5x8 FONTS table of src/font.c."""
+    text = open(path).read()
+    body = text[text.index("FONTS"):]
+    entries = re.findall(r"\{([^{}]*)\}", body)
+    out = {}
+    for i, entry in enumerate(entries):
+        cols = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", entry)]
+        code = FIRST + i
+        if code > LAST:
+            break
+        out[code] = [[(col >> row) & 1 for col in cols] for row in range(8)]
+    return 8, out
+
+
+def scale2x(rows):
+    """EPX / Scale2x, smooths diagonals instead of doubling blocks."""
+    h, w = len(rows), len(rows[0])
+    px = lambda y, x: rows[y][x] if 0 <= y < h and 0 <= x < w else 0
+    out = [[0] * (w * 2) for _ in range(h * 2)]
+    for y in range(h):
+        for x in range(w):
+            p, a, b, c, d = px(y, x), px(y - 1, x), px(y, x + 1), px(y, x - 1), px(y + 1, x)
+            e = [p, p, p, p]
+            if c == a and c != d and a != b: e[0] = a
+            if a == b and a != c and b != d: e[1] = b
+            if d == c and d != b and c != a: e[2] = c
+            if b == d and b != a and d != c: e[3] = d
+            out[2 * y][2 * x], out[2 * y][2 * x + 1] = e[0], e[1]
+            out[2 * y + 1][2 * x], out[2 * y + 1][2 * x + 1] = e[2], e[3]
+    return out
+
+
+def scale3x(rows):
+    """AdvMAME3x / Scale3x."""
+    h, w = len(rows), len(rows[0])
+    px = lambda y, x: rows[y][x] if 0 <= y < h and 0 <= x < w else 0
+    out = [[0] * (w * 3) for _ in range(h * 3)]
+    for y in range(h):
+        for x in range(w):
+            a, b, c = px(y - 1, x - 1), px(y - 1, x), px(y - 1, x + 1)
+            d, e, f = px(y, x - 1), px(y, x), px(y, x + 1)
+            g, hh, i = px(y + 1, x - 1), px(y + 1, x), px(y + 1, x + 1)
+            o = [e] * 9
+            if b != hh and d != f:
+                o[0] = d if d == b else e
+                o[1] = b if (d == b and e != c) or (b == f and e != a) else e
+                o[2] = f if b == f else e
+                o[3] = d if (d == b and e != g) or (d == hh and e != a) else e
+                o[5] = f if (b == f and e != i) or (hh == f and e != c) else e
+                o[6] = d if d == hh else e
+                o[7] = hh if (d == hh and e != i) or (hh == f and e != g) else e
+                o[8] = f if hh == f else e
+            for k in range(9):
+                out[3 * y + k // 3][3 * x + k % 3] = o[k]
+    return out
+
+
+def scale(rows, factor):
+    if factor == 1:
+        return rows
+    if factor == 2:
+        return scale2x(rows)
+    if factor == 3:
+        return scale3x(rows)
+    if factor == 4:
+        return scale2x(scale2x(rows))
+    if factor == 6:
+        return scale3x(scale2x(rows))
+    if factor == 8:
+        return scale2x(scale2x(scale2x(rows)))
+    sys.exit("bdf2font: scale must be 1, 2, 3, 4, 6 or 8")
+
+
+def downsample(rows, k, bpp):
+    """Box filter k x k pixels into one coverage value of bpp bits."""
+    levels = (1 << bpp) - 1
+    h, w = len(rows) // k, (len(rows[0]) + k - 1) // k
+    px = lambda y, x: rows[y][x] if x < len(rows[0]) else 0
+    out = []
+    for y in range(h):
+        out.append([])
+        for x in range(w):
+            cover = sum(px(y * k + j, x * k + i) for j in range(k) for i in range(k))
+            out[-1].append((cover * levels + k * k // 2) // (k * k))
+    return out
+
+
+def trim(rows, space):
+    """Drop blank columns left and right, keep at least `space` columns."""
+    used = [x for x in range(len(rows[0])) if any(r[x] for r in rows)]
+    if not used:
+        return [[0] * space for _ in rows]
+    return [r[used[0]:used[-1] + 1] for r in rows]
+
+
+def pack(rows, bpp):
+    values = [v for r in rows for v in r]
+    per = 8 // bpp
+    data = []
+    for i in range(0, len(values), per):
+        chunk = values[i:i + per] + [0] * (per - len(values[i:i + per]))
+        data.append(sum(v << (8 - bpp * (k + 1)) for k, v in enumerate(chunk)))
+    return data
+
+
+def emit(name, height, spacing, bpp, glyphs, source):
+    widths, offsets, bitmap = [], [], []
+    for code in range(FIRST, LAST + 1):
+        rows = glyphs[code]
+        widths.append(len(rows[0]))
+        offsets.append(len(bitmap))
+        bitmap += pack(rows, bpp)
+    if len(bitmap) > 0xFFFF:
+        sys.exit("bdf2font: bitmap exceeds 64kB")
+
+    flash = len(widths) + 2 * len(offsets) + len(bitmap)
+    lower = name.lower()
+    lines = []
+    lines.append("/** ")
+    lines.append(" * ---------------------------------------------------------------+ ")
+    lines.append(" * @brief       %s %dpx proportional font, %d bpp" % (name, height, bpp))
+    lines.append(" * ---------------------------------------------------------------+ ")
+    lines.append(" * @file        %s.c" % lower)
+    lines.append(" * @source      %s" % source)
+    lines.append(" *")
+    lines.append(" * @notes       generated by tools/bdf2font.py, do not edit")
+    lines.append(" *              flash %d bytes" % flash)
+    lines.append(" * ---------------------------------------------------------------+")
+    lines.append(" */")
+    lines.append('#include "../font.h"')
+    lines.append("")
+    lines.append("/** @array Glyph widths */")
+    lines.append("static const uint8_t %s_WIDTHS[] PROGMEM = {" % name)
+    for i in range(0, len(widths), 16):
+        lines.append("  " + ", ".join("%d" % w for w in widths[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("/** @array Glyph offsets into bitmap */")
+    lines.append("static const uint16_t %s_OFFSETS[] PROGMEM = {" % name)
+    for i in range(0, len(offsets), 12):
+        lines.append("  " + ", ".join("%d" % o for o in offsets[i:i + 12]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("/** @array Glyph bitmap, row by row, MSB first, %d bpp */" % bpp)
+    lines.append("static const uint8_t %s_BITMAP[] PROGMEM = {" % name)
+    for i in range(0, len(bitmap), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in bitmap[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("/** @const Font */")
+    lines.append("const struct S_FONT %s PROGMEM = {" % name)
+    lines.append("  .height = %d," % height)
+    lines.append("  .first = 0x%02x," % FIRST)
+    lines.append("  .last = 0x%02x," % LAST)
+    lines.append("  .spacing = %d," % spacing)
+    lines.append("  .bpp = %d," % bpp)
+    lines.append("  .widths = %s_WIDTHS," % name)
+    lines.append("  .offsets = %s_OFFSETS," % name)
+    lines.append("  .bitmap = %s_BITMAP" % name)
+    lines.append("};")
+    print("\n".join(lines))
+
+    # report: flash per font, wire bytes per opaque glyph window
+    # CASET + RASET = 2 x (1 + 4), RAMWR = 1, pixels = 2 bytes each
+    wire = [11 + 2 * (w + spacing) * height for w in widths]
+    sys.stderr.write("%s: %d glyphs, flash %d bytes, wire %d..%d bytes per glyph (avg %.1f)\n" % (
+        name, len(widths), flash, min(wire), max(wire), sum(wire) / len(wire)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument("source", nargs="?", help="BDF font file")
+    ap.add_argument("name", help="C name of the font, e.g. FONT_16")
+    ap.add_argument("--legacy", metavar="FONT_C", help="read 5x8 FONTS table instead of BDF")
+    ap.add_argument("--scale", type=int, default=1, help="Scale2x/Scale3x upscaling factor (1-4)")
+    ap.add_argument("--spacing", type=int, default=1, help="blank columns after each glyph")
+    ap.add_argument("--bpp", type=int, default=1, choices=(1, 2, 4), help="bits of coverage per pixel")
+    ap.add_argument("--supersample", type=int, default=0,
+                    help="box filter k x k source pixels per output pixel (--bpp 2/4, default 2 for --legacy)")
+    args = ap.parse_args()
+
+    if args.legacy:
+        height, glyphs = parse_legacy(args.legacy)
+        source = args.legacy
+    elif args.source:
+        height, glyphs = parse_bdf(args.source)
+        source = args.source
+    else:
+        ap.error("BDF file or --legacy required")
+
+    # anti-aliased: upscale k times more than requested, then box filter k x k
+    k = args.supersample or (2 if args.legacy and args.bpp > 1 else 1)
+    factor = args.scale * k if args.legacy else args.scale
+    space = max(1, max(1, height // 3) * factor // k)
+    blank = [[0] * max(1, height // 3) for _ in range(height)]
+    height = height * factor
+    if height % k:
+        sys.exit("bdf2font: font height %d not divisible by --supersample %d" % (height, k))
+
+    out = {}
+    for code in range(FIRST, LAST + 1):
+        rows = glyphs.get(code, blank)
+        rows = scale(rows, factor)
+        if args.bpp > 1 or k > 1:
+            rows = downsample(rows, k, args.bpp)
+        out[code] = trim(rows, space)
+    emit(args.name, height // k, args.spacing * max(1, factor // k), args.bpp, out, source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,111 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Gradient & pattern fill benchmark
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        fill_bench.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      src/fill.h, src/hal/model.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       make bench, every fill on full screen against ST7789_DrawImage of
+ *              the same pixels taken from the mock, both through the controller
+ *              model; pixels of fills are checked by tests/test_fill.c
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdio.h>
+#include <time.h>
+#include "src/fill.h"
+
+#define ROUNDS                20                        // draws per measurement
+
+/** @var Screen definition */
+extern struct S_SCREEN Screen;
+
+static uint16_t image[HAL_MOCK_WIDTH * HAL_MOCK_HEIGHT];
+
+/* Nanoseconds now */
+static double Bench_Now (void)
+{
+  struct timespec now;
+
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/* One fill on full screen, ROUNDS times */
+static void Bench_Fill (struct st7789 * lcd, uint8_t id)
+{
+  uint16_t w = Screen.width - 1, h = Screen.height - 1;
+
+  switch (id) {
+    case 0: ST7789_FillGradient (lcd, 0, w, 0, h, RGB888 (0, 32, 96), RGB888 (255, 160, 0), GRADIENT_HORIZONTAL); break;
+    case 1: ST7789_FillGradient (lcd, 0, w, 0, h, RGB888 (0, 32, 96), RGB888 (255, 160, 0), GRADIENT_HORIZONTAL | GRADIENT_DITHER); break;
+    case 2: ST7789_FillGradient (lcd, 0, w, 0, h, RGB888 (0, 32, 96), RGB888 (255, 160, 0), GRADIENT_VERTICAL); break;
+    case 3: ST7789_FillGradient (lcd, 0, w, 0, h, RGB888 (0, 32, 96), RGB888 (255, 160, 0), GRADIENT_VERTICAL | GRADIENT_DITHER); break;
+    case 4: ST7789_FillChecker (lcd, 0, w, 0, h, 8, WHITE, BLACK); break;
+    case 5: ST7789_FillStripes (lcd, 0, w, 0, h, 6, STRIPES_DIAGONAL, WHITE, BLACK); break;
+    default: ST7789_FillPattern (lcd, 0, w, 0, h, PATTERN_BRICK, WHITE, BLACK); break;
+  }
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const char * fills[] = { "gradient h", "gradient h dither", "gradient v", "gradient v dither", "checker 8", "stripes diagonal", "pattern brick" };
+  struct signal cs = { .ddr = &DDRB, .port = &PORTB, .pin = 2 };
+  struct signal bl = { .ddr = &DDRB, .port = &PORTB, .pin = 1 };
+  struct signal rs = { .ddr = &DDRB, .port = &PORTB, .pin = 0 };
+  struct signal dc = { .ddr = &DDRD, .port = &PORTD, .pin = 7 };
+  struct st7789 lcd = { .cs = &cs, .bl = &bl, .dc = &dc, .rs = &rs };
+  uint32_t pixels, bytes[2];
+  double ns[2], start;
+  uint16_t x, y;
+  uint8_t id, r;
+
+  HAL_Mock_Panel (&cs, &dc);
+  ST7789_Init (&lcd, ST77XX_ROTATE_0 | ST77XX_RGB);     // GRAM in screen order
+  pixels = (uint32_t) Screen.width * Screen.height;
+
+  printf ("%ux%u, ns/px & bytes on wire per draw\n", Screen.width, Screen.height);
+  for (id = 0; id < sizeof (fills) / sizeof (fills[0]); id++) {
+    ST7789_ClearScreen (&lcd, BLACK);
+    bytes[0] = Mock.bytes;
+    start = Bench_Now ();
+    for (r = 0; r < ROUNDS; r++) {
+      Bench_Fill (&lcd, id);
+    }
+    ns[0] = (Bench_Now () - start) / ((double) ROUNDS * pixels);
+    bytes[0] = (Mock.bytes - bytes[0]) / ROUNDS;
+
+    for (y = 0; y < Screen.height; y++) {
+      for (x = 0; x < Screen.width; x++) {
+        image[y * Screen.width + x] = Mock.gram[y + Screen.offsetY][x + Screen.offsetX];
+      }
+    }
+
+    ST7789_ClearScreen (&lcd, BLACK);
+    bytes[1] = Mock.bytes;
+    start = Bench_Now ();
+    for (r = 0; r < ROUNDS; r++) {
+      ST7789_DrawImage (&lcd, 0, Screen.width - 1, 0, Screen.height - 1, image);
+    }
+    ns[1] = (Bench_Now () - start) / ((double) ROUNDS * pixels);
+    bytes[1] = (Mock.bytes - bytes[1]) / ROUNDS;
+
+    printf ("  %-18s fill %6.2f ns/px %6u B  image %6.2f ns/px %6u B  %u B of image saved\n",
+      fills[id], ns[0], bytes[0], ns[1], bytes[1], 2 * pixels);
+  }
+  return Mock.errors ? 1 : 0;
+}
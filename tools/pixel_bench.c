@@ -0,0 +1,123 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Pixel kernel benchmark
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        pixel_bench.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      src/pixel.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       make bench, built once with SIMD kernels and once with
+ *              -DST7789_PIXEL_SCALAR, same checksums = same bits
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "src/pixel.h"
+
+#if defined(ST7789_PIXEL_SCALAR)
+  #define KERNELS               "scalar"
+#elif defined(__AVX2__)
+  #define KERNELS               "avx2"
+#elif defined(__SSE2__)
+  #define KERNELS               "sse2"
+#else
+  #define KERNELS               "scalar"
+#endif
+
+#define PIXELS                (240 * 320)               // full frame
+#define WORK                  (1UL << 26)               // pixels per measurement
+
+/** @array Sizes, one row, one 16 px glyph, full frame */
+static const struct { const char * name; uint32_t count; } SIZES[] = {
+  { "row 240", 240 },
+  { "glyph 12x16", 12 * 16 },
+  { "frame 240x320", PIXELS }
+};
+
+static uint8_t rgb[PIXELS * 3];
+static uint32_t argb[PIXELS];
+static uint16_t source[PIXELS];
+static uint16_t destination[PIXELS];
+
+/* Nanoseconds now */
+static double Bench_Now (void)
+{
+  struct timespec now;
+
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/* Checksum of destination */
+static uint32_t Bench_Sum (uint32_t count)
+{
+  uint32_t sum = 0, i;
+
+  for (i = 0; i < count; i++) {
+    sum = sum * 31 + destination[i];
+  }
+  return sum;
+}
+
+/* One kernel at one size, ns per pixel */
+static void Bench_Run (const char * kernel, uint8_t id, uint32_t count)
+{
+  uint32_t rounds = WORK / count, r;
+  double start = Bench_Now ();
+
+  for (r = 0; r < rounds; r++) {
+    switch (id) {
+      case 0: ST7789_Pixel_Fill (destination, (uint16_t) r, count); break;
+      case 1: ST7789_Pixel_Swap (destination, source, count); break;
+      case 2: ST7789_Pixel_RGB888 (destination, rgb, count, ST7789_PIXEL_NO_DITHER); break;
+      case 3: ST7789_Pixel_RGB888 (destination, rgb, count, (int16_t) (r & 0xFF)); break;
+      case 4: ST7789_Pixel_ARGB8888 (destination, argb, count, ST7789_PIXEL_NO_DITHER); break;
+      case 5: ST7789_Pixel_ARGB8888 (destination, argb, count, (int16_t) (r & 0xFF)); break;
+      default: ST7789_Pixel_Blend (destination, source, count, (uint8_t) r); break;
+    }
+  }
+  printf ("  %-16s %7.3f ns/px  sum %08x\n", kernel, (Bench_Now () - start) / ((double) rounds * count), Bench_Sum (count));
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const char * kernels[] = { "fill", "swap", "rgb888", "rgb888 dither", "argb8888", "argb8888 dither", "blend" };
+  uint32_t i;
+  uint8_t s, k;
+
+  srand (1);
+  for (i = 0; i < PIXELS; i++) {
+    rgb[3 * i] = rand ();
+    rgb[3 * i + 1] = rand ();
+    rgb[3 * i + 2] = rand ();
+    argb[i] = ((uint32_t) rand () << 16) ^ rand ();
+    source[i] = rand ();
+  }
+
+  printf ("%s\n", KERNELS);
+  for (s = 0; s < sizeof (SIZES) / sizeof (SIZES[0]); s++) {
+    printf (" %s\n", SIZES[s].name);
+    for (k = 0; k < sizeof (kernels) / sizeof (kernels[0]); k++) {
+      for (i = 0; i < SIZES[s].count; i++) {
+        destination[i] = (uint16_t) (i * 2654435761u >> 16);  // same blend background
+      }
+      Bench_Run (kernels[k], k, SIZES[s].count);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,382 @@
+#!/usr/bin/env python3
+#
+# @description  Compile a screen layout to an ST7789 command stream in PROGMEM,
+#               played by ST7789_Stream_Play (src/st7789.c)
+#
+# @usage        tools/scr2stream.py page.scr PAGE_MAIN > src/screens/page_main.c
+#               tools/scr2stream.py --naive page_naive.c page.scr PAGE_MAIN > page_main.c
+#               tools/scr2stream.py --binary page_main.bin page.scr PAGE_MAIN > /dev/null
+#               tools/scr2stream.py --dither diffusion --depth 444 page.scr PAGE_MAIN > page_main.c
+#
+# @layout       one operation per line, later ones paint over earlier ones,
+#               colors RGB565 (0xF800) or #rrggbb, '#' at line start = comment
+#
+#                 fill   xs xe ys ye color
+#                 frame  xs xe ys ye color
+#                 hline  xs xe y color
+#                 vline  x ys ye color
+#                 text   x y fg bg FONT_16 "string"
+#                 image  x y file.ppm
+#
+# @compile      the layout is painted on the host, the final pixels are covered
+#               by rectangles (runs of equal columns merged over rows), windows
+#               are emitted top to bottom so CASET / RASET repeat as little as
+#               possible, pixels inside a window are sent as color repeats or
+#               literal data (RAMWR, then RAMWRC), nothing is painted twice
+#
+# @dither       images are truncated to RGB565 by default, --dither ordered adds
+#               the 4x4 Bayer threshold of ST7789_Pixel_Dither_565 / _444,
+#               --dither diffusion is Floyd-Steinberg of ST7789_Pixel_Diffuse
+#               (src/pixel.c), --depth 444 keeps 4 bits per channel for longer
+#               color repeats
+#
+import argparse
+import glob
+import os
+import re
+import shlex
+import sys
+
+CASET, RASET, RAMWR, RAMWRC = 0x2A, 0x2B, 0x2C, 0x3C
+LONG, REPEAT = 0xFE, 0xFF
+SHORT_MAX = 0xFC
+REPEAT_MIN = 4                       # shorter runs stay literal (repeat = 6 bytes)
+BAYER = [[0, 8, 2, 10], [12, 4, 14, 6], [3, 11, 1, 9], [15, 7, 13, 5]]
+LEVELS = {"565": (31, 63, 31), "444": (15, 15, 15)}
+
+
+def color(text):
+    if text.startswith("#"):
+        v = int(text[1:], 16)
+        return ((v >> 19) & 0x1F) << 11 | ((v >> 10) & 0x3F) << 5 | ((v >> 3) & 0x1F)
+    return int(text, 0) & 0xFFFF
+
+
+def load_fonts(path):
+    """Fonts generated by bdf2font.py: {name: (height, spacing, bpp, widths, offsets, bitmap)}."""
+    fonts = {}
+    for file in glob.glob(os.path.join(path, "*.c")):
+        text = open(file).read()
+        m = re.search(r"const struct S_FONT (\w+) PROGMEM", text)
+        if not m:
+            continue
+        name = m.group(1)
+        array = lambda suffix: [int(v, 0) for v in re.findall(
+            r"0x[0-9a-fA-F]+|\d+", re.search(r"%s_%s\[\] PROGMEM = \{([^}]*)\}" % (name, suffix), text).group(1))]
+        field = lambda key: int(re.search(r"\.%s = (0x[0-9a-fA-F]+|\d+)" % key, text).group(1), 0)
+        fonts[name] = dict(height=field("height"), first=field("first"), last=field("last"),
+                           spacing=field("spacing"), bpp=field("bpp"),
+                           widths=array("WIDTHS"), offsets=array("OFFSETS"), bitmap=array("BITMAP"))
+    return fonts
+
+
+def blend(fg, bg, a):
+    """ST7789_Text_Blend, alpha 0..32."""
+    r, g, b = bg >> 11, (bg >> 5) & 0x3F, bg & 0x1F
+    r += ((fg >> 11) - r) * a >> 5
+    g += (((fg >> 5) & 0x3F) - g) * a >> 5
+    b += ((fg & 0x1F) - b) * a >> 5
+    return (r << 11) | (g << 5) | b
+
+
+def word(levels, q):
+    """Channel levels to RGB565 word, 4 bit levels replicated into 5 / 6 bits."""
+    r, g, b = q
+    if levels[0] == 15:
+        r, g, b = r << 1 | r >> 3, g << 2 | g >> 2, b << 1 | b >> 3
+    return r << 11 | g << 5 | b
+
+
+def quantize(w, h, rgb, dither, depth):
+    """RGB888 bytes to RGB565 words, same results as src/pixel.c."""
+    levels = LEVELS[depth]
+    out = []
+    if dither == "diffusion":
+        below = [[0, 0, 0] for _ in range(w)]         # error to next row
+        for y in range(h):
+            right, diagonal = [0, 0, 0], [0, 0, 0]
+            for x in range(w):
+                q = []
+                for c in range(3):
+                    n = levels[c]
+                    v = min(max(rgb[3 * (y * w + x) + c] + right[c] + below[x][c], 0), 255)
+                    level = (v * n + 127) // 255
+                    e = v - (level * 255 + n // 2) // n
+                    right[c] = int(e * 7 / 16)              # C division, towards zero
+                    if x > 0:
+                        below[x - 1][c] += int(e * 3 / 16)
+                    below[x][c] = int(e * 5 / 16) + diagonal[c]
+                    diagonal[c] = int(e / 16)
+                    q.append(level)
+                out.append(word(levels, q))
+        return out
+    for y in range(h):
+        for x in range(w):
+            t = BAYER[y & 3][x & 3] if dither == "ordered" else 0
+            q = []
+            for c in range(3):
+                step = 256 // (levels[c] + 1)
+                q.append(min(rgb[3 * (y * w + x) + c] + t * step // 16, 255) // step)
+            out.append(word(levels, q))
+    return out
+
+
+def load_ppm(path, dither="none", depth="565"):
+    data = open(path, "rb").read()
+    fields = re.match(rb"P6\s+(?:#.*\s+)*(\d+)\s+(\d+)\s+(\d+)\s", data)
+    if not fields:
+        sys.exit("scr2stream: %s is not binary PPM (P6)" % path)
+    w, h = int(fields.group(1)), int(fields.group(2))
+    return w, h, quantize(w, h, data[fields.end():], dither, depth)
+
+
+class Screen:
+    def __init__(self, width, height):
+        self.width, self.height = width, height
+        self.pixels = [[None] * width for _ in range(height)]
+        self.naive = []
+        self.wire = 0                # bytes sent by the naive calls
+
+    def rect(self, xs, xe, ys, ye, source):
+        """Paint clipped rectangle, source(x, y) gives color, return pixels sent."""
+        xs, xe = min(xs, xe), max(xs, xe)
+        ys, ye = min(ys, ye), max(ys, ye)
+        x1, x2, y1, y2 = max(xs, 0), min(xe, self.width - 1), max(ys, 0), min(ye, self.height - 1)
+        if x1 > x2 or y1 > y2:
+            return
+        for y in range(y1, y2 + 1):
+            for x in range(x1, x2 + 1):
+                self.pixels[y][x] = source(x, y)
+        self.wire += 11 + 2 * (x2 - x1 + 1) * (y2 - y1 + 1)
+
+    def fill(self, xs, xe, ys, ye, c):
+        self.rect(xs, xe, ys, ye, lambda x, y: c)
+        self.naive.append("ST7789_FillRect (lcd, %d, %d, %d, %d, 0x%04x);" % (xs, xe, ys, ye, c))
+
+    def text(self, x, y, fg, bg, font, name, string):
+        levels = (1 << font["bpp"]) - 1
+        alpha = [((i << 5) + (levels >> 1)) // levels for i in range(levels + 1)]
+        ramp = [blend(fg, bg, a) for a in alpha]
+        col = x
+        for ch in string.encode("latin-1"):
+            if not font["first"] <= ch <= font["last"]:
+                continue                                   # ST7789_Text_DrawChar refuses
+            i = ch - font["first"]
+            width, base = font["widths"][i], font["offsets"][i]
+            advance = width + font["spacing"]
+            if col + advance > self.width:
+                sys.exit("scr2stream: text \"%s\" does not fit in one row" % string)
+
+            def glyph(px, py, left=col, width=width, base=base):
+                if px - left >= width:
+                    return bg                              # spacing
+                bit = ((py - y) * width + (px - left)) * font["bpp"]
+                byte = font["bitmap"][base + (bit >> 3)]
+                return ramp[(byte >> (8 - font["bpp"] - (bit & 7))) & levels]
+            self.rect(col, col + advance - 1, y, y + font["height"] - 1, glyph)
+            col += advance
+        self.naive.append("ST7789_SetPosition (%d, %d);" % (x, y))
+        self.naive.append("ST7789_Text_DrawString (lcd, &%s, \"%s\", 0x%04x, 0x%04x);" % (name, string, fg, bg))
+
+    def image(self, x, y, w, h, data, name):
+        self.rect(x, x + w - 1, y, y + h - 1, lambda px, py: data[(py - y) * w + (px - x)])
+        self.naive.append("ST7789_DrawImage (lcd, %d, %d, %d, %d, %s);" % (x, x + w - 1, y, y + h - 1, name))
+
+
+def parse(path, screen, fonts, dither="none", depth="565"):
+    images = []
+    for number, line in enumerate(open(path), 1):
+        if line.lstrip().startswith("#"):
+            continue                                       # comment
+        words = shlex.split(line)
+        if not words:
+            continue
+        op, args = words[0], words[1:]
+        try:
+            if op == "fill":
+                xs, xe, ys, ye = (int(a, 0) for a in args[:4])
+                screen.fill(xs, xe, ys, ye, color(args[4]))
+            elif op == "frame":
+                xs, xe, ys, ye = (int(a, 0) for a in args[:4])
+                c = color(args[4])
+                screen.fill(xs, xe, ys, ys, c)
+                screen.fill(xs, xe, ye, ye, c)
+                screen.fill(xs, xs, ys + 1, ye - 1, c)
+                screen.fill(xe, xe, ys + 1, ye - 1, c)
+            elif op == "hline":
+                xs, xe, y = (int(a, 0) for a in args[:3])
+                screen.fill(xs, xe, y, y, color(args[3]))
+            elif op == "vline":
+                x, ys, ye = (int(a, 0) for a in args[:3])
+                screen.fill(x, x, ys, ye, color(args[3]))
+            elif op == "text":
+                if args[4] not in fonts:
+                    sys.exit("%s:%d: unknown font %s" % (path, number, args[4]))
+                screen.text(int(args[0], 0), int(args[1], 0), color(args[2]), color(args[3]),
+                            fonts[args[4]], args[4], args[5])
+            elif op == "image":
+                w, h, data = load_ppm(os.path.join(os.path.dirname(path), args[2]), dither, depth)
+                name = "IMAGE_%d" % len(images)
+                images.append((name, data))
+                screen.image(int(args[0], 0), int(args[1], 0), w, h, data, name)
+            else:
+                sys.exit("%s:%d: unknown operation %s" % (path, number, op))
+        except (IndexError, ValueError):
+            sys.exit("%s:%d: bad arguments" % (path, number))
+    return images
+
+
+def rectangles(screen):
+    """Cover painted pixels by rectangles, runs with equal columns merged over rows."""
+    done, open_ = [], {}
+    for y in range(screen.height + 1):
+        runs = set()
+        row = screen.pixels[y] if y < screen.height else [None] * screen.width
+        x = 0
+        while x < screen.width:
+            if row[x] is None:
+                x += 1
+                continue
+            start = x
+            while x < screen.width and row[x] is not None:
+                x += 1
+            runs.add((start, x - 1))
+        for run in list(open_):
+            if run not in runs:
+                done.append((run[0], run[1], open_.pop(run), y - 1))
+        for run in runs:
+            open_.setdefault(run, y)
+    return sorted(done, key=lambda r: (r[2], r[0]))
+
+
+def encode(screen, offset_x, offset_y):
+    """Return list of (comment, bytes) records."""
+    records = []
+    window = [None, None]
+    for xs, xe, ys, ye in rectangles(screen):
+        cols = (xs + offset_x, xe + offset_x)
+        rows = (ys + offset_y, ye + offset_y)
+        if window[0] != cols:
+            records.append(("CASET %d..%d" % (xs, xe),
+                            [CASET, 4, cols[0] >> 8, cols[0] & 0xFF, cols[1] >> 8, cols[1] & 0xFF]))
+            window[0] = cols
+        if window[1] != rows:
+            records.append(("RASET %d..%d" % (ys, ye),
+                            [RASET, 4, rows[0] >> 8, rows[0] & 0xFF, rows[1] >> 8, rows[1] & 0xFF]))
+            window[1] = rows
+
+        pixels = [screen.pixels[y][x] for y in range(ys, ye + 1) for x in range(xs, xe + 1)]
+        chunks = []                  # ("repeat", color, count) / ("literal", [colors])
+        i = 0
+        while i < len(pixels):
+            j = i
+            while j < len(pixels) and pixels[j] == pixels[i]:
+                j += 1
+            if j - i >= REPEAT_MIN:
+                while j - i > 0xFFFF:
+                    chunks.append(("repeat", pixels[i], 0xFFFF))
+                    i += 0xFFFF
+                chunks.append(("repeat", pixels[i], j - i))
+            elif chunks and chunks[-1][0] == "literal" and len(chunks[-1][1]) + j - i <= 0x7FFF:
+                chunks[-1][1].extend(pixels[i:j])
+            else:
+                chunks.append(("literal", pixels[i:j]))
+            i = j
+
+        command = RAMWR
+        for chunk in chunks:
+            if chunk[0] == "repeat":
+                c, n = chunk[1], chunk[2]
+                records.append(("%s 0x%04x x %d" % ("RAMWR" if command == RAMWR else "RAMWRC", c, n),
+                                [command, REPEAT, c >> 8, c & 0xFF, n >> 8, n & 0xFF]))
+            else:
+                data = [b for c in chunk[1] for b in (c >> 8, c & 0xFF)]
+                head = [command, len(data)] if len(data) <= SHORT_MAX else [command, LONG, len(data) >> 8, len(data) & 0xFF]
+                records.append(("%s %d pixels" % ("RAMWR" if command == RAMWR else "RAMWRC", len(chunk[1])), head + data))
+            command = RAMWRC
+    return records
+
+
+def wire_bytes(data):
+    """Bytes on SPI of one record: command + data."""
+    if data[1] == REPEAT:
+        return 1 + 2 * ((data[4] << 8) | data[5])
+    if data[1] == LONG:
+        return 1 + len(data) - 4
+    return 1 + len(data) - 2
+
+
+def main():
+    ap = argparse.ArgumentParser(description="compile screen layout to ST7789 command stream")
+    ap.add_argument("layout", help="layout file")
+    ap.add_argument("name", help="C name of the stream, e.g. PAGE_MAIN")
+    ap.add_argument("--size", type=int, nargs=2, default=(240, 280), metavar=("W", "H"), help="screen size")
+    ap.add_argument("--offset", type=int, nargs=2, default=(0, 20), metavar=("X", "Y"),
+                    help="RAM offset of screen, Screen.offsetX / offsetY of target orientation")
+    ap.add_argument("--fonts", default=os.path.join(os.path.dirname(__file__), "..", "src", "fonts"),
+                    help="directory of fonts generated by bdf2font.py")
+    ap.add_argument("--include", default="st7789.h", help="header included by generated file")
+    ap.add_argument("--naive", metavar="FILE", help="also write the layout as plain driver calls")
+    ap.add_argument("--binary", metavar="FILE",
+                    help="also write raw stream for external memory, ST7789_Stream_Run")
+    ap.add_argument("--dither", choices=("none", "ordered", "diffusion"), default="none",
+                    help="dithering of images to RGB565 / RGB444")
+    ap.add_argument("--depth", choices=sorted(LEVELS), default="565", help="color levels of images")
+    args = ap.parse_args()
+
+    screen = Screen(*args.size)
+    images = parse(args.layout, screen, load_fonts(args.fonts), args.dither, args.depth)
+    records = encode(screen, *args.offset)
+    size = sum(len(r[1]) for r in records) + 1
+    wire = sum(wire_bytes(r[1]) for r in records)
+
+    lines = []
+    lines.append("/** ")
+    lines.append(" * ---------------------------------------------------------------+ ")
+    lines.append(" * @brief       %s command stream" % args.name)
+    lines.append(" * ---------------------------------------------------------------+ ")
+    lines.append(" * @source      %s" % args.layout)
+    lines.append(" *")
+    lines.append(" * @notes       generated by tools/scr2stream.py, do not edit")
+    lines.append(" *              screen %dx%d, RAM offset %d, %d" % (args.size[0], args.size[1], args.offset[0], args.offset[1]))
+    lines.append(" *              flash %d bytes, wire %d bytes (plain calls %d bytes)" % (size, wire, screen.wire))
+    lines.append(" * ---------------------------------------------------------------+")
+    lines.append(" */")
+    lines.append('#include "%s"' % args.include)
+    lines.append("")
+    lines.append("/** @array Command stream, ST7789_Stream_Play */")
+    lines.append("const uint8_t %s[] PROGMEM = {" % args.name)
+    for comment, data in records:
+        if len(data) <= 16:
+            lines.append("  " + ", ".join("0x%02x" % b for b in data) + ",  // " + comment)
+        else:
+            lines.append("  // " + comment)
+            for i in range(0, len(data), 16):
+                lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines.append("  0x00                                  // end")
+    lines.append("};")
+    print("\n".join(lines))
+
+    if args.binary:
+        with open(args.binary, "wb") as f:
+            f.write(bytes(b for r in records for b in r[1]) + b"\x00")
+
+    if args.naive:
+        with open(args.naive, "w") as f:
+            f.write('#include "%s"\n#include "%s"\n\n' % (args.include, os.path.join(os.path.dirname(args.include), "text.h")))
+            for name, data in images:
+                f.write("static const uint16_t %s[] = {\n" % name)
+                for i in range(0, len(data), 12):
+                    f.write("  " + ", ".join("0x%04x" % v for v in data[i:i + 12]) + ",\n")
+                f.write("};\n\n")
+            f.write("/* %s as plain driver calls */\nvoid %s_Naive (struct st7789 * lcd)\n{\n" % (args.name, args.name))
+            for call in screen.naive:
+                f.write("  %s\n" % call)
+            f.write("}\n")
+
+    sys.stderr.write("%s: %d records, flash %d bytes, wire %d bytes, plain calls wire %d bytes\n" % (
+        args.name, len(records), size, wire, screen.wire))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,112 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Filled shapes benchmark
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2023 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @date        18.10.2026
+ * @file        shape_bench.c
+ * @version     1.0
+ * @tested      Linux x86_64, gcc
+ *
+ * @depend      src/shape.h, src/hal/model.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       make bench, host bus model: polygon, triangle, circle & ring segment,
+ *              spans sent (= runs in GRAM), ns & bytes on wire per span. Host time
+ *              includes the model, AVR cycles per span need the target
+ * --------------------------------------------------------------------------------------------+
+ */
+#include <stdio.h>
+#include <time.h>
+#include "src/shape.h"
+
+#define ROUNDS                50                        // draws per measurement
+
+/** @var Screen definition */
+extern struct S_SCREEN Screen;
+
+/** @var Star, concave, two spans on most rows */
+static const struct S_POINT star[] = {
+  { 120, 20 }, { 145, 110 }, { 230, 110 }, { 160, 160 },
+  { 190, 260 }, { 120, 200 }, { 50, 260 }, { 80, 160 }
+};
+
+/* Nanoseconds now */
+static double Bench_Now (void)
+{
+  struct timespec now;
+
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/* One shape */
+static void Bench_Shape (struct st7789 * lcd, uint8_t id, uint16_t color)
+{
+  switch (id) {
+    case 0: ST7789_FillPolygon (lcd, star, sizeof (star) / sizeof (star[0]), color); break;
+    case 1: ST7789_FillTriangle (lcd, 10, 10, 230, 90, 60, 270, color); break;
+    case 2: ST7789_FillCircle (lcd, 120, 140, 100, color); break;
+    default: ST7789_FillArc (lcd, 120, 140, 90, 100, 135, 270, color); break;
+  }
+}
+
+/* Runs of one color in GRAM = spans sent */
+static uint32_t Bench_Runs (uint16_t color)
+{
+  uint32_t runs = 0;
+  uint16_t x, y;
+
+  for (y = 0; y < HAL_MOCK_HEIGHT; y++) {
+    for (x = 0; x < HAL_MOCK_WIDTH; x++) {
+      if ((Mock.gram[y][x] == color) && ((x == 0) || (Mock.gram[y][x - 1] != color))) {
+        runs++;
+      }
+    }
+  }
+  return runs;
+}
+
+/**
+ * @desc    Main function
+ *
+ * @param   void
+ *
+ * @return  int
+ */
+int main (void)
+{
+  const char * shapes[] = { "polygon star 8", "triangle", "circle r 100", "ring 270 r 90..100" };
+  struct signal cs = { .ddr = &DDRB, .port = &PORTB, .pin = 2 };
+  struct signal bl = { .ddr = &DDRB, .port = &PORTB, .pin = 1 };
+  struct signal rs = { .ddr = &DDRB, .port = &PORTB, .pin = 0 };
+  struct signal dc = { .ddr = &DDRD, .port = &PORTD, .pin = 7 };
+  struct st7789 lcd = { .cs = &cs, .bl = &bl, .dc = &dc, .rs = &rs };
+  uint32_t spans, bytes;
+  double ns, start;
+  uint8_t id, r;
+
+  HAL_Mock_Panel (&cs, &dc);
+  ST7789_Init (&lcd, ST77XX_ROTATE_0);
+
+  printf ("%ux%u, spans sent, ns & bytes on wire per span (host, model included)\n", Screen.width, Screen.height);
+  for (id = 0; id < sizeof (shapes) / sizeof (shapes[0]); id++) {
+    ST7789_ClearScreen (&lcd, BLACK);
+    Bench_Shape (&lcd, id, WHITE);
+    spans = Bench_Runs (WHITE);
+
+    bytes = Mock.bytes;
+    start = Bench_Now ();
+    for (r = 0; r < ROUNDS; r++) {
+      Bench_Shape (&lcd, id, (r & 1) ? WHITE : RED);
+    }
+    ns = (Bench_Now () - start) / ((double) ROUNDS * spans);
+    bytes = (Mock.bytes - bytes) / ROUNDS;
+
+    printf ("  %-20s %5u spans %8.1f ns/span %6u B %6.1f B/span\n",
+      shapes[id], spans, ns, bytes, (double) bytes / spans);
+  }
+  return Mock.errors ? 1 : 0;
+}